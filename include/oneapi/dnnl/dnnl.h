@@ -589,6 +589,50 @@ dnnl_status_t DNNL_API dnnl_post_ops_get_params_binary(
         const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
         const_dnnl_memory_desc_t *src1_desc);
 
+/// Appends a binary post-op with support of ternary operators.
+///
+/// The kind of this post operation is #dnnl_binary.
+///
+/// In the simplest case when the binary is the only post operation, the
+/// computations would be:
+///
+///     dst[:] <- binary_op (dst[:], another_input[:], condition[:])
+///
+/// where binary_op is configured with the given parameters. For
+/// #dnnl_binary_select the result is dst[:] where condition[:] is non-zero
+/// and another_input[:] otherwise. binary_op supports broadcast semantics for
+/// both additional operands.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Binary algorithm for the post-op.
+/// @param src1_desc Memory descriptor of a second operand.
+/// @param src2_desc Memory descriptor of a third operand. Must be of
+///     #dnnl_s8 data type for #dnnl_binary_select and NULL or a zero memory
+///     descriptor otherwise.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_binary_v2(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src1_desc,
+        const_dnnl_memory_desc_t src2_desc);
+
+/// Returns the parameters of a binary post-op with support of ternary
+/// operators.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the binary post-op.
+/// @param alg_kind Output binary algorithm kind.
+/// @param src1_desc Output memory descriptor of a second operand.
+/// @param src2_desc Output memory descriptor of a third operand. A zero memory
+///     descriptor is returned for algorithms with two operands.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_invalid_arguments if @p index does not refer to a binary
+///     post-op.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_binary_v2(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
+        const_dnnl_memory_desc_t *src1_desc,
+        const_dnnl_memory_desc_t *src2_desc);
+
 /// Appends a prelu forward post-op.
 ///
 /// The kind of this post-op is #dnnl::primitive::kind::prelu.
@@ -715,6 +759,72 @@ dnnl_status_t DNNL_API dnnl_memory_desc_create_with_csr_encoding(
         dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
         dnnl_data_type_t data_type, dnnl_dim_t nnz, dnnl_data_type_t indices_dt,
         dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for BSR encoding.
+///
+/// The tensor is split into dense blocks of @p block_dims. Only blocks with
+/// at least one non-zero entry are stored. Each stored block keeps all of its
+/// entries in row-major order. Indices hold the block column of every stored
+/// block and pointers hold the offset of the first stored block of every
+/// block row, in blocks.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions. Each dimension must be divisible by the
+///     corresponding block dimension.
+/// @param data_type Elements data type.
+/// @param nnz Number of stored entries, that is the number of stored blocks
+///     multiplied by the block size.
+/// @param block_dims Array of block dimensions.
+/// @param indices_dt Data type of indices.
+/// @param pointers_dt Data type of pointers.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_bsr_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        const dnnl_dims_t block_dims, dnnl_data_type_t indices_dt,
+        dnnl_data_type_t pointers_dt);
+
+/// Creates a memory descriptor for COO encoding.
+///
+/// Every non-zero entry is stored with its coordinates. The values and the
+/// indices of each dimension are kept in separate buffers of @p nnz elements,
+/// with no particular order of the entries required.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions.
+/// @param data_type Elements data type.
+/// @param nnz Number of non-zero entries.
+/// @param indices_dt Data type of indices.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_coo_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t nnz,
+        dnnl_data_type_t indices_dt);
+
+/// Creates a memory descriptor for grouped encoding.
+///
+/// The rows of a dense row-major matrix are split into @p ngroups
+/// consecutive groups. The group sizes are known only at execution time and
+/// are passed as an array of @p ngroups + 1 row offsets, where the last
+/// element is equal to the number of rows.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param ndims Number of dimensions. Only 2 is supported.
+/// @param dims Array of dimensions. The 0th dimension is the total number of
+///     rows in all groups.
+/// @param data_type Elements data type.
+/// @param ngroups Number of groups.
+/// @param offsets_dt Data type of group offsets.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_grouped_encoding(
+        dnnl_memory_desc_t *memory_desc, int ndims, const dnnl_dims_t dims,
+        dnnl_data_type_t data_type, dnnl_dim_t ngroups,
+        dnnl_data_type_t offsets_dt);
 #endif
 
 /// Creates a memory descriptor for a region inside an area
@@ -1299,6 +1409,39 @@ dnnl_status_t DNNL_API dnnl_binary_primitive_desc_create(
         const_dnnl_memory_desc_t src1_desc, const_dnnl_memory_desc_t dst_desc,
         const_dnnl_primitive_attr_t attr);
 
+/// Creates a primitive descriptor for a binary primitive with support of
+/// ternary operators.
+///
+/// @note
+///     Memory descriptors @p src1_desc, @p src2_desc and @p dst_desc are
+///     allowed to be initialized with #dnnl_format_tag_any or with
+///     format_kind set to #dnnl_format_kind_any.
+///
+/// @note
+///     All memory descriptors must have the same number of dimensions.
+///     Element broadcasting is supported for memory descriptors @p src1_desc
+///     and @p src2_desc and is applied to their dimensions that have size
+///     equal to 1.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Algorithm kind. Valid values are the ones of
+///     #dnnl_binary_primitive_desc_create() and #dnnl_binary_select.
+/// @param src0_desc Source 0 memory descriptor.
+/// @param src1_desc Source 1 memory descriptor.
+/// @param src2_desc Source 2 memory descriptor holding the condition of
+///     #dnnl_binary_select. Must be of #dnnl_s8 data type for
+///     #dnnl_binary_select and NULL or a zero memory descriptor otherwise.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_binary_primitive_desc_create_v2(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src0_desc,
+        const_dnnl_memory_desc_t src1_desc, const_dnnl_memory_desc_t src2_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
 /// @} dnnl_api_binary
 
 /// @addtogroup dnnl_api_convolution
@@ -3243,6 +3386,135 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk TopK
+/// @{
+
+/// Creates a primitive descriptor for a TopK primitive.
+///
+/// The number of selected elements k is defined by the size of @p axis in
+/// @p dst_desc. Selected values are written in the order of selection (the
+/// largest first for #dnnl_topk_max) to the #DNNL_ARG_DST memory, and their
+/// s32 positions along @p axis are written to the #DNNL_ARG_DST_1 memory.
+///
+/// @note
+///     Destination and indices memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind TopK algorithm kind. Possible values: #dnnl_topk_max,
+///     #dnnl_topk_min.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor for selected values.
+/// @param indices_desc Destination memory descriptor for indices of selected
+///     values. Must have #dnnl_s32 data type and the same dimensions as
+///     @p dst_desc.
+/// @param axis Axis along which the selection is performed.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_topk_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t indices_desc, int axis,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_gather Gather
+/// @{
+
+/// Creates a primitive descriptor for a gather primitive.
+///
+/// The source is a two-dimensional table of `rows x dim` elements. For the
+/// #dnnl_gather_rows algorithm, row `i` of the destination is the table row
+/// `indices[i]`. For the #dnnl_gather_bag_sum and #dnnl_gather_bag_mean
+/// algorithms, row `b` of the destination is the sum or the mean of the
+/// table rows `indices[offsets[b]]`, ..., `indices[offsets[b + 1] - 1]`
+/// (up to the last index for the last bag). The mean over an empty bag is
+/// zero.
+///
+/// Scales set with #dnnl_primitive_attr_set_scales_mask for #DNNL_ARG_SRC
+/// are applied to table rows before the reduction. Mask 0 sets a common
+/// scale, and mask 1 sets a scale per table row.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Gather algorithm kind. Possible values:
+///     #dnnl_gather_rows, #dnnl_gather_bag_sum, #dnnl_gather_bag_mean.
+/// @param src_desc Source (table) memory descriptor.
+/// @param indices_desc Indices memory descriptor. Must be one-dimensional
+///     and have #dnnl_s32 data type. The indices must be in the range of
+///     table rows.
+/// @param offsets_desc Bag offsets memory descriptor. Must be
+///     one-dimensional and have #dnnl_s32 data type. Must be NULL or a zero
+///     memory descriptor for #dnnl_gather_rows.
+/// @param dst_desc Destination memory descriptor.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_gather_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t indices_desc,
+        const_dnnl_memory_desc_t offsets_desc,
+        const_dnnl_memory_desc_t dst_desc, const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_gather
+
+/// @addtogroup dnnl_api_rope RoPE
+/// @{
+
+/// Creates a primitive descriptor for a rotary position embedding (RoPE)
+/// primitive.
+///
+/// The last dimension of the source is split into pairs of elements, and
+/// each pair is rotated by an angle that depends on the position along
+/// @p axis and on the pair. The #dnnl_rope_interleaved algorithm pairs
+/// elements `2i` and `2i + 1`, and the #dnnl_rope_half algorithm pairs
+/// elements `i` and `i + D / 2`, where `D` is the size of the last
+/// dimension.
+///
+/// The angles are defined by the #DNNL_ARG_SRC_1 memory which is either:
+///  - A two-dimensional #dnnl_f32 table of `T x D` elements, where `T` is the
+///    size of @p axis. The first `D / 2` columns hold the cosines and the
+///    last `D / 2` columns hold the sines of the angles of the pairs.
+///  - A one-dimensional #dnnl_s32 array of `T` positions. The angle of pair
+///    `i` at position `p` is then `p * theta ^ (-2i / D)`.
+///
+/// @note
+///     Destination memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind RoPE algorithm kind. Possible values:
+///     #dnnl_rope_interleaved, #dnnl_rope_half.
+/// @param src_desc Source memory descriptor.
+/// @param dst_desc Destination memory descriptor.
+/// @param cos_sin_desc Memory descriptor for the table of cosines and sines
+///     or for the positions.
+/// @param axis Axis of positions. Must not be the last dimension.
+/// @param theta Base of the angles computed from positions. Ignored for the
+///     table of cosines and sines.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_rope_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t src_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t cos_sin_desc, int axis, float theta,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_rope
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -3637,6 +3909,503 @@ dnnl_status_t DNNL_API dnnl_gemm_s8s8s32(char transa, char transb, char offsetc,
         dnnl_dim_t lda, int8_t ao, const int8_t *B, dnnl_dim_t ldb, int8_t bo,
         float beta, int32_t *C, dnnl_dim_t ldc, const int32_t *co);
 
+/// Performs bfloat16 matrix-matrix multiply with a single-precision resulting
+/// matrix.
+///
+/// The operation is defined as:
+///
+/// `C := alpha * op( A ) * op( B ) + beta * C`
+///
+/// where
+///  - `op( X ) = X` or `op( X ) = X**T`,
+///  - `alpha` and `beta` are scalars, and
+///  - `A`, `B`, and `C` are matrices:
+///     - `op( A )` is an `MxK` bf16 matrix,
+///     - `op( B )` is an `KxN` bf16 matrix,
+///     - `C` is an `MxN` f32 matrix.
+///
+/// The matrices are assumed to be stored in row-major order (the elements in
+/// each of the matrix rows are contiguous in memory). The bf16 values are
+/// passed as their raw 16-bit representation.
+///
+/// @note
+///     This API does not support XERBLA. Instead, unlike the standard BLAS
+///     functions, this one returns a dnnl_status_t value to allow error
+///     handling.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of a buffer required to pack the matrix A or B for
+/// dnnl_gemm_bf16bf16f32_compute().
+///
+/// Packing lets the application reorder a matrix that stays constant across
+/// many multiplications, for example weights, once instead of on every call.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise. #dnnl_unimplemented is returned when
+///     packing is not supported on the current CPU.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs the matrix A or B for dnnl_gemm_bf16bf16f32_compute().
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed buffer of at least the size returned
+///     by dnnl_gemm_bf16bf16f32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, void *dst);
+
+/// Performs bfloat16 matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// A matrix that was packed with dnnl_gemm_bf16bf16f32_pack() is passed
+/// with the 'P' or 'p' transposition flag and points to the packed buffer.
+/// The dimensions and the transposition flags of the other matrix must match
+/// the ones used for packing. The leading dimension of a packed matrix is
+/// ignored.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n', 'T' or 't', or
+///     'P' or 'p' if A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n', 'T' or 't', or
+///     'P' or 'p' if B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Performs float16 matrix-matrix multiply with a single-precision resulting
+/// matrix.
+///
+/// The operation is defined as:
+///
+/// `C := alpha * op( A ) * op( B ) + beta * C`
+///
+/// where
+///  - `op( X ) = X` or `op( X ) = X**T`,
+///  - `alpha` and `beta` are scalars, and
+///  - `A`, `B`, and `C` are matrices:
+///     - `op( A )` is an `MxK` f16 matrix,
+///     - `op( B )` is an `KxN` f16 matrix,
+///     - `C` is an `MxN` f32 matrix.
+///
+/// The matrices are assumed to be stored in row-major order (the elements in
+/// each of the matrix rows are contiguous in memory). The f16 values are
+/// passed as their raw 16-bit representation.
+///
+/// @note
+///     This API does not support XERBLA. Instead, unlike the standard BLAS
+///     functions, this one returns a dnnl_status_t value to allow error
+///     handling.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the product of
+///     matrices A and B.
+/// @param A A pointer to the A matrix data.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint16_t *A, dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb,
+        float beta, float *C, dnnl_dim_t ldc);
+
+/// Returns the size of a buffer required to pack the matrix A or B for
+/// dnnl_gemm_f16f16f32_compute().
+///
+/// Packing lets the application reorder a matrix that stays constant across
+/// many multiplications, for example weights, once instead of on every call.
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param size Output size of the packed buffer in bytes.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise. #dnnl_unimplemented is returned when
+///     packing is not supported on the current CPU.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32_pack_get_size(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, size_t *size);
+
+/// Packs the matrix A or B for dnnl_gemm_f16f16f32_compute().
+///
+/// @param identifier The matrix to pack: 'A' or 'a' for the matrix A, and
+///     'B' or 'b' for the matrix B.
+/// @param transa Transposition flag for matrix A.
+/// @param transb Transposition flag for matrix B.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param lda The leading dimension for the matrix A.
+/// @param ldb The leading dimension for the matrix B.
+/// @param src A pointer to the data of the matrix to pack.
+/// @param dst A pointer to the packed buffer of at least the size returned
+///     by dnnl_gemm_f16f16f32_pack_get_size().
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32_pack(char identifier,
+        char transa, char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        dnnl_dim_t lda, dnnl_dim_t ldb, const uint16_t *src, void *dst);
+
+/// Performs float16 matrix-matrix multiply with packed matrices.
+///
+/// The operation is defined as:
+///
+/// `C := op( A ) * op( B ) + beta * C`
+///
+/// A matrix that was packed with dnnl_gemm_f16f16f32_pack() is passed
+/// with the 'P' or 'p' transposition flag and points to the packed buffer.
+/// The dimensions and the transposition flags of the other matrix must match
+/// the ones used for packing. The leading dimension of a packed matrix is
+/// ignored.
+///
+/// @param transa Transposition flag for matrix A: 'N' or 'n', 'T' or 't', or
+///     'P' or 'p' if A is packed.
+/// @param transb Transposition flag for matrix B: 'N' or 'n', 'T' or 't', or
+///     'P' or 'p' if B is packed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param A A pointer to the A matrix data or to the packed buffer.
+/// @param lda The leading dimension for the matrix A.
+/// @param B A pointer to the B matrix data or to the packed buffer.
+/// @param ldb The leading dimension for the matrix B.
+/// @param beta The beta parameter that is used to scale the matrix C.
+/// @param C A pointer to the C matrix data.
+/// @param ldc The leading dimension for the matrix C.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_f16f16f32_compute(char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, const void *A,
+        dnnl_dim_t lda, const void *B, dnnl_dim_t ldb, float beta, float *C,
+        dnnl_dim_t ldc);
+
+/// Performs a batch of single-precision matrix-matrix multiplies.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// for every `i` in `[0, batch_size)`, where all the problems share the same
+/// transposition flags, dimensions, and scalars, but each of them uses its
+/// own matrices and leading dimensions. Refer to dnnl_sgemm() for the
+/// description of a single problem.
+///
+/// The problems in the batch must not write to overlapping memory. When the
+/// individual problems are small, the library executes them concurrently
+/// instead of splitting each of them between the threads.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda An array of @p batch_size leading dimensions for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb An array of @p batch_size leading dimensions for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc An array of @p batch_size leading dimensions for the matrices C.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        float beta, float *const *C, const dnnl_dim_t *ldc,
+        dnnl_dim_t batch_size);
+
+/// Performs a strided batch of single-precision matrix-matrix multiplies.
+///
+/// The operation is defined as:
+///
+/// `C[i] := alpha * op( A[i] ) * op( B[i] ) + beta * C[i]`
+///
+/// for every `i` in `[0, batch_size)`, where the matrices of the `i`-th
+/// problem start at `A + i * stride_a`, `B + i * stride_b`, and
+/// `C + i * stride_c` respectively. Refer to dnnl_sgemm() for the
+/// description of a single problem.
+///
+/// The problems in the batch must not write to overlapping memory. When the
+/// individual problems are small, the library executes them concurrently
+/// instead of splitting each of them between the threads.
+///
+/// @param transa Transposition flag for matrices A: 'N' or 'n' means A is not
+///     transposed, and 'T' or 't' means that A is transposed.
+/// @param transb Transposition flag for matrices B: 'N' or 'n' means B is not
+///     transposed, and 'T' or 't' means that B is transposed.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+///     Must be at least `(M - 1) * ldc + N` when @p batch_size is greater
+///     than 1, so that the matrices C do not overlap.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_sgemm_batch_strided(char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit unsigned
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C.
+///
+/// All the problems share the same transposition flags, dimensions, offsets,
+/// and scalars, but each of them uses its own matrices and leading
+/// dimensions. Refer to dnnl_gemm_u8s8s32() for the description of a single
+/// problem and to dnnl_sgemm_batch() for the description of the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda An array of @p batch_size leading dimensions for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb An array of @p batch_size leading dimensions for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc An array of @p batch_size leading dimensions for the matrices C.
+/// @param co An array of offset values for the matrices C, shared by all the
+///     problems in the batch.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, const dnnl_dim_t *lda, uint8_t ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, int8_t bo, float beta,
+        int32_t *const *C, const dnnl_dim_t *ldc, const int32_t *co,
+        dnnl_dim_t batch_size);
+
+/// Performs a strided batch of integer matrix-matrix multiplies on 8-bit
+/// unsigned matrices A, 8-bit signed matrices B, and 32-bit signed resulting
+/// matrices C.
+///
+/// The matrices of the `i`-th problem start at `A + i * stride_a`,
+/// `B + i * stride_b`, and `C + i * stride_c` respectively. Refer to
+/// dnnl_gemm_u8s8s32() for the description of a single problem and to
+/// dnnl_sgemm_batch_strided() for the description of the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+///     Must be at least `(M - 1) * ldc + N` when @p batch_size is greater
+///     than 1, so that the matrices C do not overlap.
+/// @param co An array of offset values for the matrices C, shared by all the
+///     problems in the batch.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_u8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        uint8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
+/// Performs a batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C.
+///
+/// All the problems share the same transposition flags, dimensions, offsets,
+/// and scalars, but each of them uses its own matrices and leading
+/// dimensions. Refer to dnnl_gemm_s8s8s32() for the description of a single
+/// problem and to dnnl_sgemm_batch() for the description of the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A An array of @p batch_size pointers to the A matrices data.
+/// @param lda An array of @p batch_size leading dimensions for the matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B An array of @p batch_size pointers to the B matrices data.
+/// @param ldb An array of @p batch_size leading dimensions for the matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C An array of @p batch_size pointers to the C matrices data.
+/// @param ldc An array of @p batch_size leading dimensions for the matrices C.
+/// @param co An array of offset values for the matrices C, shared by all the
+///     problems in the batch.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, const dnnl_dim_t *lda, int8_t ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, int8_t bo, float beta,
+        int32_t *const *C, const dnnl_dim_t *ldc, const int32_t *co,
+        dnnl_dim_t batch_size);
+
+/// Performs a strided batch of integer matrix-matrix multiplies on 8-bit signed
+/// matrices A, 8-bit signed matrices B, and 32-bit signed resulting matrices
+/// C.
+///
+/// The matrices of the `i`-th problem start at `A + i * stride_a`,
+/// `B + i * stride_b`, and `C + i * stride_c` respectively. Refer to
+/// dnnl_gemm_s8s8s32() for the description of a single problem and to
+/// dnnl_sgemm_batch_strided() for the description of the batch.
+///
+/// @param transa Transposition flag for matrices A.
+/// @param transb Transposition flag for matrices B.
+/// @param offsetc Flag specifying how offsets should be applied to matrices
+///     C.
+/// @param M The M dimension.
+/// @param N The N dimension.
+/// @param K The K dimension.
+/// @param alpha The alpha parameter that is used to scale the products of
+///     matrices A and B.
+/// @param A A pointer to the first A matrix data.
+/// @param lda The leading dimension for the matrices A.
+/// @param stride_a The distance in elements between consecutive matrices A.
+/// @param ao The offset value for the matrices A.
+/// @param B A pointer to the first B matrix data.
+/// @param ldb The leading dimension for the matrices B.
+/// @param stride_b The distance in elements between consecutive matrices B.
+/// @param bo The offset value for the matrices B.
+/// @param beta The beta parameter that is used to scale the matrices C.
+/// @param C A pointer to the first C matrix data.
+/// @param ldc The leading dimension for the matrices C.
+/// @param stride_c The distance in elements between consecutive matrices C.
+///     Must be at least `(M - 1) * ldc + N` when @p batch_size is greater
+///     than 1, so that the matrices C do not overlap.
+/// @param co An array of offset values for the matrices C, shared by all the
+///     problems in the batch.
+/// @param batch_size The number of problems in the batch.
+/// @returns #dnnl_success/#dnnl::status::success on success and a status
+///     describing the error otherwise.
+dnnl_status_t DNNL_API dnnl_gemm_s8s8s32_batch_strided(char transa,
+        char transb, char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K,
+        float alpha, const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a,
+        int8_t ao, const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b,
+        int8_t bo, float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size);
+
 /// @} dnnl_api_blas
 
 /// @} dnnl_api
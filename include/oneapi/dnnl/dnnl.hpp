@@ -148,6 +148,12 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// A TopK primitive.
+        topk = dnnl_topk,
+        /// A gather primitive.
+        gather = dnnl_gather,
+        /// A rotary position embedding (RoPE) primitive.
+        rope = dnnl_rope,
     };
 
     using handle::handle;
@@ -453,6 +459,8 @@ enum class algorithm {
     binary_eq = dnnl_binary_eq,
     /// Binary not equal
     binary_ne = dnnl_binary_ne,
+    /// Binary select
+    binary_select = dnnl_binary_select,
     /// Nearest Neighbor resampling method
     resampling_nearest = dnnl_resampling_nearest,
     /// Linear (Bilinear, Trilinear) resampling method
@@ -479,6 +487,20 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// TopK selecting the largest values
+    topk_max = dnnl_topk_max,
+    /// TopK selecting the smallest values
+    topk_min = dnnl_topk_min,
+    /// Gather of table rows
+    gather_rows = dnnl_gather_rows,
+    /// Gather of table rows with a sum over each bag of rows
+    gather_bag_sum = dnnl_gather_bag_sum,
+    /// Gather of table rows with a mean over each bag of rows
+    gather_bag_mean = dnnl_gather_bag_mean,
+    /// RoPE rotating pairs of adjacent elements
+    rope_interleaved = dnnl_rope_interleaved,
+    /// RoPE rotating pairs of elements from the two halves of a row
+    rope_half = dnnl_rope_half,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -530,6 +552,19 @@ enum class normalization_flags : unsigned {
     /// On training, normalization will require the workspace to implement
     /// backward propagation. On inference, the workspace is not required.
     fuse_norm_add_relu = dnnl_fuse_norm_add_relu,
+
+    /// Use Root Mean Square (RMS) Normalization. In forward propagation, the
+    /// mean is considered zero, and the mean of squared source values is
+    /// used instead of the variance. The mean is neither computed nor used.
+    /// In backward propagation, the derivative is computed with respect to
+    /// the RMS statistic only. Supported by layer normalization only.
+    rms_norm = dnnl_rms_norm,
+
+    /// Fuse residual addition with normalization. The residual tensor passed
+    /// as #DNNL_ARG_SRC_1 is added to the source tensor, the sum is written
+    /// to #DNNL_ARG_DST_1 and then normalized. Supported by layer
+    /// normalization forward propagation only.
+    fuse_residual_add = dnnl_fuse_residual_add,
 };
 
 /// Converts normalization flags enum value from C++ API to C API type.
@@ -883,6 +918,12 @@ struct memory : public handle<dnnl_memory_t> {
             undef = dnnl_sparse_encoding_undef,
             /// Compressed Sparse Row (CSR) encoding.
             csr = dnnl_csr,
+            /// Block Compressed Sparse Row (BSR) encoding.
+            bsr = dnnl_bsr,
+            /// Coordinate (COO) encoding.
+            coo = dnnl_coo,
+            /// Grouped encoding.
+            grouped = dnnl_grouped,
     };
 #endif
 
@@ -2667,6 +2708,108 @@ struct memory : public handle<dnnl_memory_t> {
                         "encoding");
             return desc {md};
         }
+
+        /// Function for creating a memory descriptor for BSR sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 3 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, stored block by block
+        ///  - 1: indices of the block columns
+        ///  - 2: pointers to the first block of each block row
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of stored entries, that is the number of stored
+        ///     blocks multiplied by the block size.
+        /// @param block_dims Block dimensions.
+        /// @param index_dt Data type of indices.
+        /// @param pointer_dt Data type of pointers.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        static desc bsr(const dims &adims, data_type adata_type, dim nnz,
+                const dims &block_dims, data_type index_dt,
+                data_type pointer_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            validate_dims(block_dims, (int)adims.size());
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_bsr_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, block_dims.data(),
+                    convert_to_c(index_dt), convert_to_c(pointer_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for BSR sparse "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for COO sparse encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 1 + ndims buffers. The buffers have the following meaning
+        /// and assigned numbers (index):
+        ///  - 0: values
+        ///  - 1: indices of the 0th dimension (rows)
+        ///  - 2: indices of the 1st dimension (columns)
+        ///
+        /// @param adims Tensor dimensions.
+        /// @param adata_type Data precision/type.
+        /// @param nnz Number of non-zero entries.
+        /// @param index_dt Data type of indices.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        static desc coo(const dims &adims, data_type adata_type, dim nnz,
+                data_type index_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status = dnnl_memory_desc_create_with_coo_encoding(
+                    &md, (int)adims.size(), adims.data(),
+                    convert_to_c(adata_type), nnz, convert_to_c(index_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for COO sparse "
+                        "encoding");
+            return desc {md};
+        }
+
+        /// Function for creating a memory descriptor for grouped encoding.
+        ///
+        /// The created memory descriptor will describe a memory object that
+        /// contains 2 buffers. The buffers have the following meaning and
+        /// assigned numbers (index):
+        ///  - 0: values, a dense row-major matrix with rows of all groups
+        ///  - 1: offsets of the first row of each group, followed by the
+        ///    total number of rows (ngroups + 1 elements)
+        ///
+        /// @param adims Tensor dimensions. The 0th dimension is the total
+        ///     number of rows in all groups.
+        /// @param adata_type Data precision/type.
+        /// @param ngroups Number of groups.
+        /// @param offset_dt Data type of group offsets.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case a
+        ///     zero memory descriptor will be constructed. This flag is
+        ///     optional and defaults to false.
+        static desc grouped(const dims &adims, data_type adata_type,
+                dim ngroups, data_type offset_dt, bool allow_empty = false) {
+            validate_dims(adims);
+            dnnl_memory_desc_t md = nullptr;
+            dnnl_status_t status
+                    = dnnl_memory_desc_create_with_grouped_encoding(&md,
+                            (int)adims.size(), adims.data(),
+                            convert_to_c(adata_type), ngroups,
+                            convert_to_c(offset_dt));
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a memory descriptor for grouped "
+                        "sparse encoding");
+            return desc {md};
+        }
 #endif
         /// Construct a memory descriptor from a C API ::dnnl_memory_desc_t
         /// handle. The resulting handle is not weak and the C handle will be
@@ -3604,6 +3747,54 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         src1_desc = memory::desc(cloned_md);
     }
 
+    /// Appends a binary post-op with support of ternary operators.
+    ///
+    /// The kind of this post operation is #dnnl_binary.
+    ///
+    /// In the simplest case when the binary is the only post operation, the
+    /// computations would be:
+    ///
+    ///     dst[:] <- binary_op (dst[:], another_input[:], condition[:])
+    ///
+    /// where binary_op is configured with the given parameters. For
+    /// #dnnl::algorithm::binary_select the result is dst[:] where
+    /// condition[:] is non-zero and another_input[:] otherwise.
+    ///
+    /// @param aalgorithm Binary algorithm for the post-op.
+    /// @param src1_desc Memory descriptor of a second operand.
+    /// @param src2_desc Memory descriptor of a third operand.
+    void append_binary(algorithm aalgorithm, const memory::desc &src1_desc,
+            const memory::desc &src2_desc) {
+        error::wrap_c_api(
+                dnnl_post_ops_append_binary_v2(get(), convert_to_c(aalgorithm),
+                        src1_desc.get(), src2_desc.get()),
+                "could not append a binary post-op");
+    }
+
+    /// Returns the parameters of a binary post-op with support of ternary
+    /// operators.
+    ///
+    /// @param index Index of the binary post-op.
+    /// @param aalgorithm Output binary algorithm kind.
+    /// @param src1_desc Output memory descriptor of a second operand.
+    /// @param src2_desc Output memory descriptor of a third operand.
+    void get_params_binary(int index, algorithm &aalgorithm,
+            memory::desc &src1_desc, memory::desc &src2_desc) const {
+        dnnl_alg_kind_t c_alg;
+        const_dnnl_memory_desc_t cdesc1, cdesc2;
+        error::wrap_c_api(dnnl_post_ops_get_params_binary_v2(
+                                  get(), index, &c_alg, &cdesc1, &cdesc2),
+                "could not get parameters of a binary post-op");
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+        dnnl_memory_desc_t cloned_md1 = nullptr, cloned_md2 = nullptr;
+        error::wrap_c_api(dnnl_memory_desc_clone(&cloned_md1, cdesc1),
+                "could not clone a memory descriptor");
+        src1_desc = memory::desc(cloned_md1);
+        error::wrap_c_api(dnnl_memory_desc_clone(&cloned_md2, cdesc2),
+                "could not clone a memory descriptor");
+        src2_desc = memory::desc(cloned_md2);
+    }
+
     /// Appends a prelu forward post-op.
     ///
     /// The kind of this post-op is #dnnl::primitive::kind::prelu.
@@ -4841,6 +5032,29 @@ struct concat : public primitive {
 
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+
+        /// Returns a memory descriptor of the region of the destination that
+        /// a source is copied to.
+        ///
+        /// A memory object with this descriptor and the destination data
+        /// handle is a view of the destination. If the producer of a source
+        /// writes its result to such a view, and the concat primitive is
+        /// created with the view as the source descriptor, the primitive
+        /// skips copying this source.
+        ///
+        /// @param idx Source index.
+        /// @returns Memory descriptor for the region of the source.
+        memory::desc src_view_desc(int idx = 0) const {
+            const memory::desc dst = dst_desc();
+            const int axis = get_axis();
+            memory::dims offsets(dst.get_ndims(), 0);
+            for (int i = 0; i < idx; i++)
+                offsets[axis] += src_desc(i).get_dims()[axis];
+            return dst.submemory_desc(src_desc(idx).get_dims(), offsets);
+        }
     };
 
     /// Default constructor. Produces an empty object.
@@ -12036,6 +12250,41 @@ struct binary : public primitive {
             reset(pd);
         }
 
+        /// Constructs a primitive descriptor for an elementwise binary operator
+        /// primitive with support of ternary operators.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Elementwise binary algorithm.
+        /// @param src0 Memory descriptor for source tensor #0.
+        /// @param src1 Memory descriptor for source tensor #1.
+        /// @param src2 Memory descriptor for source tensor #2 for ternary
+        ///     operations, i.e. the condition of
+        ///     #dnnl::algorithm::binary_select.
+        /// @param dst Memory descriptor for destination tensor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src0, const memory::desc &src1,
+                const memory::desc &src2, const memory::desc &dst,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_binary_primitive_desc_create_v2(&pd,
+                    aengine.get(), dnnl::convert_to_c(aalgorithm), src0.get(),
+                    src1.get(), src2.get(), dst.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a binary "
+                        "operation primitive");
+            reset(pd);
+        }
+
         /// Constructs a primitive descriptor for a binary primitive from a C
         /// API primitive descriptor that must have a matching kind.
         ///
@@ -12052,6 +12301,9 @@ struct binary : public primitive {
         /// Returns the memory descriptor for source #1.
         memory::desc src1_desc() const { return base::src_desc(1); }
 
+        /// Returns the memory descriptor for source #2.
+        memory::desc src2_desc() const { return base::src_desc(2); }
+
         /// @copydoc dnnl::primitive_desc_base::dst_desc()const
         memory::desc dst_desc() const { return base::dst_desc(0); }
 
@@ -13024,6 +13276,326 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_topk TopK
+///
+/// A primitive to select the k largest or smallest values of a tensor along
+/// an axis together with their indices.
+///
+/// @sa @ref dev_guide_topk in developer guide
+///
+/// @{
+
+/// TopK.
+struct topk : public primitive {
+    /// Primitive descriptor for a TopK primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a TopK primitive.
+        ///
+        /// @note
+        ///     Destination and indices memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm TopK algorithm kind. Possible values:
+        ///     #dnnl::algorithm::topk_max, #dnnl::algorithm::topk_min.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor for selected values.
+        ///     The size of @p axis defines the number of selected elements.
+        /// @param indices_desc Destination memory descriptor for indices of
+        ///     selected values. Must have #dnnl::memory::data_type::s32 data
+        ///     type.
+        /// @param axis Axis along which the selection is performed.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &indices_desc, int axis,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_topk_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), indices_desc.get(), axis, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a topk "
+                        "primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a TopK primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a TopK primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::topk) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// Returns a memory descriptor for indices of selected values.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::dst_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    topk() = default;
+
+    /// Constructs a TopK primitive.
+    /// @param pd Primitive descriptor for a TopK primitive.
+    topk(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a TopK primitive from a cache blob.
+    /// @param pd Primitive descriptor for a TopK primitive.
+    /// @param cache_blob Cache blob.
+    topk(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_topk
+
+/// @addtogroup dnnl_api_gather Gather
+///
+/// A primitive to gather rows of a table by indices, optionally reducing
+/// bags of gathered rows as an embedding bag does.
+///
+/// @sa @ref dev_guide_gather in developer guide
+///
+/// @{
+
+/// Gather.
+struct gather : public primitive {
+    /// Primitive descriptor for a gather primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a gather primitive without
+        /// bags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Gather algorithm kind. Possible value:
+        ///     #dnnl::algorithm::gather_rows.
+        /// @param src_desc Source (table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    nullptr, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a gather primitive with
+        /// bags.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Gather algorithm kind. Possible values:
+        ///     #dnnl::algorithm::gather_bag_sum,
+        ///     #dnnl::algorithm::gather_bag_mean.
+        /// @param src_desc Source (table) memory descriptor.
+        /// @param indices_desc Indices memory descriptor.
+        /// @param offsets_desc Bag offsets memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc &offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false)
+            : primitive_desc(aengine, aalgorithm, src_desc, indices_desc,
+                    &offsets_desc, dst_desc, attr, allow_empty) {}
+
+        /// Constructs a primitive descriptor for a gather primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a gather primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::gather) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a memory descriptor for indices.
+        /// @returns Indices memory descriptor.
+        memory::desc indices_desc() const { return base::src_desc(1); }
+
+        /// Returns a memory descriptor for bag offsets.
+        /// @returns Bag offsets memory descriptor or a zero memory descriptor
+        ///     if the primitive has no bags.
+        memory::desc offsets_desc() const { return base::src_desc(2); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+    private:
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &indices_desc,
+                const memory::desc *offsets_desc, const memory::desc &dst_desc,
+                const primitive_attr &attr, bool allow_empty) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_gather_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    indices_desc.get(), optional_arg(offsets_desc),
+                    dst_desc.get(), attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a "
+                        "gather primitive");
+            reset(pd);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    gather() = default;
+
+    /// Constructs a gather primitive.
+    /// @param pd Primitive descriptor for a gather primitive.
+    gather(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a gather primitive from a cache blob.
+    /// @param pd Primitive descriptor for a gather primitive.
+    /// @param cache_blob Cache blob.
+    gather(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_gather
+
+/// @addtogroup dnnl_api_rope RoPE
+///
+/// A primitive to apply rotary position embedding (RoPE) to a tensor of
+/// queries or keys.
+///
+/// @sa @ref dev_guide_rope in developer guide
+///
+/// @{
+
+/// Rotary position embedding (RoPE).
+struct rope : public primitive {
+    /// Primitive descriptor for a RoPE primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a RoPE primitive.
+        ///
+        /// @note
+        ///     Destination memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm RoPE algorithm kind. Possible values:
+        ///     #dnnl::algorithm::rope_interleaved,
+        ///     #dnnl::algorithm::rope_half.
+        /// @param src_desc Source memory descriptor.
+        /// @param dst_desc Destination memory descriptor.
+        /// @param cos_sin_desc Memory descriptor for the table of cosines and
+        ///     sines or for the positions.
+        /// @param axis Axis of positions.
+        /// @param theta Base of the angles computed from positions.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &src_desc, const memory::desc &dst_desc,
+                const memory::desc &cos_sin_desc, int axis,
+                float theta = 10000.f,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_rope_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm), src_desc.get(),
+                    dst_desc.get(), cos_sin_desc.get(), axis, theta,
+                    attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a rope "
+                        "primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a RoPE primitive from a C
+        /// API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a RoPE primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::rope) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// Returns a memory descriptor for the table of cosines and sines or
+        /// for the positions.
+        /// @returns Cosines and sines or positions memory descriptor.
+        memory::desc cos_sin_desc() const { return base::src_desc(1); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_axis()const
+        int get_axis() const { return base::get_axis(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+    };
+
+    /// Default constructor. Produces an empty object.
+    rope() = default;
+
+    /// Constructs a RoPE primitive.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    rope(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a RoPE primitive from a cache blob.
+    /// @param pd Primitive descriptor for a RoPE primitive.
+    /// @param cache_blob Cache blob.
+    rope(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_rope
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13269,6 +13841,141 @@ inline status gemm_s8s8s32(char transa, char transb, char offsetc, dnnl_dim_t M,
             K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co));
 }
 
+/// @copydoc dnnl_gemm_bf16bf16f32()
+inline status gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack_get_size()
+inline status gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_pack()
+inline status gemm_bf16bf16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_bf16bf16f32_compute()
+inline status gemm_bf16bf16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_bf16bf16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32()
+inline status gemm_f16f16f32(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const uint16_t *A,
+        dnnl_dim_t lda, const uint16_t *B, dnnl_dim_t ldb, float beta,
+        float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_f16f16f32(
+            transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32_pack_get_size()
+inline status gemm_f16f16f32_pack_get_size(char identifier, char transa,
+        char transb, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, size_t *size) {
+    return static_cast<status>(dnnl_gemm_f16f16f32_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32_pack()
+inline status gemm_f16f16f32_pack(char identifier, char transa, char transb,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, dnnl_dim_t lda,
+        dnnl_dim_t ldb, const uint16_t *src, void *dst) {
+    return static_cast<status>(dnnl_gemm_f16f16f32_pack(
+            identifier, transa, transb, M, N, K, lda, ldb, src, dst));
+}
+
+/// @copydoc dnnl_gemm_f16f16f32_compute()
+inline status gemm_f16f16f32_compute(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, const void *A, dnnl_dim_t lda,
+        const void *B, dnnl_dim_t ldb, float beta, float *C, dnnl_dim_t ldc) {
+    return static_cast<status>(dnnl_gemm_f16f16f32_compute(
+            transa, transb, M, N, K, A, lda, B, ldb, beta, C, ldc));
+}
+
+/// @copydoc dnnl_sgemm_batch()
+inline status sgemm_batch(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *const *A,
+        const dnnl_dim_t *lda, const float *const *B, const dnnl_dim_t *ldb,
+        float beta, float *const *C, const dnnl_dim_t *ldc,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch(transa, transb, M, N, K, alpha,
+            A, lda, B, ldb, beta, C, ldc, batch_size));
+}
+
+/// @copydoc dnnl_sgemm_batch_strided()
+inline status sgemm_batch_strided(char transa, char transb, dnnl_dim_t M,
+        dnnl_dim_t N, dnnl_dim_t K, float alpha, const float *A,
+        dnnl_dim_t lda, dnnl_dim_t stride_a, const float *B, dnnl_dim_t ldb,
+        dnnl_dim_t stride_b, float beta, float *C, dnnl_dim_t ldc,
+        dnnl_dim_t stride_c, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_sgemm_batch_strided(transa, transb, M, N,
+            K, alpha, A, lda, stride_a, B, ldb, stride_b, beta, C, ldc,
+            stride_c, batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch()
+inline status gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *const *A, const dnnl_dim_t *lda, uint8_t ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, int8_t bo, float beta,
+        int32_t *const *C, const dnnl_dim_t *ldc, const int32_t *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
+/// @copydoc dnnl_gemm_u8s8s32_batch_strided()
+inline status gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const uint8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, uint8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_u8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch()
+inline status gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *const *A, const dnnl_dim_t *lda, int8_t ao,
+        const int8_t *const *B, const dnnl_dim_t *ldb, int8_t bo, float beta,
+        int32_t *const *C, const dnnl_dim_t *ldc, const int32_t *co,
+        dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, ao, B, ldb, bo, beta, C, ldc, co,
+            batch_size));
+}
+
+/// @copydoc dnnl_gemm_s8s8s32_batch_strided()
+inline status gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dnnl_dim_t M, dnnl_dim_t N, dnnl_dim_t K, float alpha,
+        const int8_t *A, dnnl_dim_t lda, dnnl_dim_t stride_a, int8_t ao,
+        const int8_t *B, dnnl_dim_t ldb, dnnl_dim_t stride_b, int8_t bo,
+        float beta, int32_t *C, dnnl_dim_t ldc, dnnl_dim_t stride_c,
+        const int32_t *co, dnnl_dim_t batch_size) {
+    return static_cast<status>(dnnl_gemm_s8s8s32_batch_strided(transa, transb,
+            offsetc, M, N, K, alpha, A, lda, stride_a, ao, B, ldb, stride_b,
+            bo, beta, C, ldc, stride_c, co, batch_size));
+}
+
 /// @} dnnl_api_blas
 
 // implementation section
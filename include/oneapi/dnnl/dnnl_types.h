@@ -68,6 +68,13 @@ typedef enum {
     dnnl_sparse_encoding_undef = 0,
     /// Compressed Sparse Row (CSR) encoding.
     dnnl_csr,
+    /// Block Compressed Sparse Row (BSR) encoding.
+    dnnl_bsr,
+    /// Coordinate (COO) encoding.
+    dnnl_coo,
+    /// Grouped encoding: rows of a dense matrix split into groups of
+    /// variable size.
+    dnnl_grouped,
 } dnnl_sparse_encoding_t;
 #endif
 
@@ -1886,6 +1893,12 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// A TopK primitive.
+    dnnl_topk,
+    /// A gather primitive.
+    dnnl_gather,
+    /// A rotary position embedding (RoPE) primitive.
+    dnnl_rope,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2016,6 +2029,9 @@ typedef enum {
     dnnl_binary_eq = 0x1fffa,
     /// Binary not equal
     dnnl_binary_ne = 0x1fffb,
+    /// Binary select: takes src0 where the condition src2 is non-zero and
+    /// src1 otherwise
+    dnnl_binary_select = 0x1fffc,
     /// Nearest Neighbor Resampling Method
     dnnl_resampling_nearest = 0x2fff0,
     /// Linear Resampling Method
@@ -2042,6 +2058,20 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// TopK selecting the largest values
+    dnnl_topk_max = 0x40000,
+    /// TopK selecting the smallest values
+    dnnl_topk_min,
+    /// Gather of table rows
+    dnnl_gather_rows = 0x50000,
+    /// Gather of table rows with a sum over each bag of rows
+    dnnl_gather_bag_sum,
+    /// Gather of table rows with a mean over each bag of rows
+    dnnl_gather_bag_mean,
+    /// RoPE rotating pairs of adjacent elements
+    dnnl_rope_interleaved = 0x60000,
+    /// RoPE rotating pairs of elements from the two halves of a row
+    dnnl_rope_half,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2113,6 +2143,28 @@ typedef enum {
     ///    tensor and then perform backward normalization.
     dnnl_fuse_norm_add_relu = 0x10U,
 
+    /// Use Root Mean Square (RMS) Normalization
+    ///
+    /// If specified (supported by layer normalization only):
+    ///  - on forward propagation the mean is considered to be zero and the
+    ///    variance is replaced with the mean of squared source values. Only
+    ///    the variance is output on forward propagation for training and the
+    ///    mean is not used.
+    ///  - on backward propagation the derivative is computed with respect
+    ///    to the RMS statistic only, assuming the mean is zero.
+    dnnl_rms_norm = 0x20U,
+
+    /// Fuse residual addition with normalization
+    ///
+    /// If specified (supported by layer normalization forward propagation
+    /// only):
+    ///  - a residual tensor is passed with the #DNNL_ARG_SRC_1 argument and
+    ///    added to the source tensor before normalization;
+    ///  - the sum is written to the #DNNL_ARG_DST_1 argument and is the
+    ///    tensor being normalized.
+    /// Both tensors use the source memory descriptor.
+    dnnl_fuse_residual_add = 0x40U,
+
 } dnnl_normalization_flags_t;
 
 /// @} dnnl_api_primitives_common
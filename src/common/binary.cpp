@@ -87,12 +87,26 @@ status_t dnnl_binary_primitive_desc_create(
         alg_kind_t alg_kind, const memory_desc_t *src0_md,
         const memory_desc_t *src1_md, const memory_desc_t *dst_md,
         const primitive_attr_t *attr) {
+    return dnnl_binary_primitive_desc_create_v2(primitive_desc_iface, engine,
+            alg_kind, src0_md, src1_md, nullptr, dst_md, attr);
+}
+
+status_t dnnl_binary_primitive_desc_create_v2(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src0_md,
+        const memory_desc_t *src1_md, const memory_desc_t *src2_md,
+        const memory_desc_t *dst_md, const primitive_attr_t *attr) {
     VCHECK_BINARY(!any_null(src0_md, src1_md, dst_md), VERBOSE_NULL_ARG);
     VCHECK_BINARY(
             one_of(alg_kind, binary_add, binary_mul, binary_max, binary_min,
                     binary_div, binary_sub, binary_ge, binary_gt, binary_le,
-                    binary_lt, binary_eq, binary_ne),
+                    binary_lt, binary_eq, binary_ne, binary_select),
             VERBOSE_BAD_ALGORITHM);
+    const bool is_select = alg_kind == binary_select;
+    const bool with_src2 = src2_md && !types::is_zero_md(src2_md);
+    VCHECK_BINARY(IMPLICATION(is_select, with_src2), VERBOSE_NULL_ARG);
+    VCHECK_BINARY(IMPLICATION(!is_select, !with_src2), VERBOSE_BAD_PARAM,
+            "src2");
     // TODO - Add support for mutual or bi-directional broadcasts
     VCHECK_BINARY(!memory_desc_wrapper(src0_md).format_any(),
             VERBOSE_UNSUPPORTED_TAG_S, "src0");
@@ -113,6 +127,16 @@ status_t dnnl_binary_primitive_desc_create(
 
     bod.src_desc[0] = *src0_md;
     bod.src_desc[1] = *src1_md;
+    if (is_select) {
+        VCONDCHECK(create, check, binary,
+                !memory_desc_wrapper(src2_md).has_runtime_dims_or_strides(),
+                status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        // The condition is a boolean-like tensor, any non-zero value selects
+        // src0.
+        VCHECK_BINARY(src2_md->data_type == data_type::s8,
+                VERBOSE_INVALID_DATATYPE, "src2");
+        bod.src_desc[2] = *src2_md;
+    }
     bod.dst_desc = *dst_md;
 
     const int ndims = dst_md->ndims;
@@ -122,6 +146,8 @@ status_t dnnl_binary_primitive_desc_create(
             src0_md->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src0", "dst");
     VCHECK_BINARY(
             src1_md->ndims == ndims, VERBOSE_INCONSISTENT_NDIMS, "src1", "dst");
+    VCHECK_BINARY(IMPLICATION(is_select, src2_md->ndims == ndims),
+            VERBOSE_INCONSISTENT_NDIMS, "src2", "dst");
     for (int d = 0; d < ndims; ++d) {
         //dims must equal eachother or equal 1 (broadcast)
         VCHECK_BINARY(utils::one_of(src0_md->dims[d], 1, dims[d]),
@@ -131,6 +157,9 @@ status_t dnnl_binary_primitive_desc_create(
         VCHECK_BINARY(IMPLICATION(src0_md->dims[d] != dims[d],
                               src1_md->dims[d] == dims[d]),
                 VERBOSE_INCONSISTENT_DIM, "src1", d, "dst", d);
+        VCHECK_BINARY(
+                IMPLICATION(is_select, one_of(src2_md->dims[d], 1, dims[d])),
+                VERBOSE_BAD_DIM, "src2", d);
     }
 
     CHECK(binary_attr_check(bod, engine, attr));
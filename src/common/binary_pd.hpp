@@ -53,6 +53,9 @@ struct binary_pd_t : public primitive_desc_t {
         if (arg == DNNL_ARG_SRC_0 || arg == DNNL_ARG_SRC_1)
             return arg_usage_t::input;
 
+        if (arg == DNNL_ARG_SRC_2)
+            return is_select() ? arg_usage_t::input : arg_usage_t::unused;
+
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
         return primitive_desc_t::arg_usage(arg);
@@ -63,6 +66,7 @@ struct binary_pd_t : public primitive_desc_t {
         switch (arg) {
             case DNNL_ARG_SRC_0: return src_md(0);
             case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_SRC_2: return src_md(2);
             case DNNL_ARG_DST: return dst_md(0, user_input);
             default: return primitive_desc_t::arg_md(arg);
         }
@@ -72,6 +76,8 @@ struct binary_pd_t : public primitive_desc_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc[0] : &src0_md_;
         if (index == 1) return user_input ? &desc()->src_desc[1] : &src1_md_;
+        if (index == 2 && is_select())
+            return user_input ? &desc()->src_desc[2] : &src2_md_;
         return &glob_zero_md;
     }
     const memory_desc_t *dst_md(
@@ -80,7 +86,9 @@ struct binary_pd_t : public primitive_desc_t {
         return &glob_zero_md;
     }
 
-    int n_inputs() const override { return 2 + n_binary_po_inputs(); }
+    int n_inputs() const override {
+        return 2 + is_select() + n_binary_po_inputs();
+    }
     int n_outputs() const override { return 1; }
 
     const dims_t &broadcast_dims() const { return broadcast_dims_; }
@@ -91,6 +99,10 @@ struct binary_pd_t : public primitive_desc_t {
 
     int ndims() const { return memory_desc_wrapper(src_md(0)).ndims(); }
 
+    bool is_select() const {
+        return desc_.alg_kind == alg_kind::binary_select;
+    }
+
     bool is_tensor_op() const {
         const memory_desc_wrapper src0_d(src_md(0));
         const memory_desc_wrapper src1_d(src_md(1));
@@ -102,6 +114,7 @@ protected:
 
     memory_desc_t src0_md_;
     memory_desc_t src1_md_;
+    memory_desc_t src2_md_;
     memory_desc_t dst_md_;
 
     dims_t broadcast_dims_;
@@ -112,6 +125,7 @@ protected:
         , desc_(*adesc)
         , src0_md_(desc_.src_desc[0])
         , src1_md_(desc_.src_desc[1])
+        , src2_md_(desc_.src_desc[2])
         , dst_md_(desc_.dst_desc) {
         init_broadcast_dims();
     }
@@ -125,6 +139,14 @@ protected:
             }
         }
 
+        if (is_select() && src2_md_.format_kind == format_kind::any) {
+            const memory_desc_wrapper src_d(src_md(0));
+            if (src_d.is_blocking_desc()) {
+                CHECK(memory_desc_init_by_blocking_desc(
+                        src2_md_, src_d.blocking_desc()));
+            }
+        }
+
         if (dst_md_.format_kind == format_kind::any) {
             const memory_desc_wrapper src_d(src_md(0));
             if (src_d.is_blocking_desc()) {
@@ -126,6 +126,7 @@ const alg_kind_t binary_le = dnnl_binary_le;
 const alg_kind_t binary_lt = dnnl_binary_lt;
 const alg_kind_t binary_eq = dnnl_binary_eq;
 const alg_kind_t binary_ne = dnnl_binary_ne;
+const alg_kind_t binary_select = dnnl_binary_select;
 const alg_kind_t resampling_nearest = dnnl_resampling_nearest;
 const alg_kind_t resampling_linear = dnnl_resampling_linear;
 const alg_kind_t reduction_max = dnnl_reduction_max;
@@ -141,6 +142,13 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t topk_max = dnnl_topk_max;
+const alg_kind_t topk_min = dnnl_topk_min;
+const alg_kind_t gather_rows = dnnl_gather_rows;
+const alg_kind_t gather_bag_sum = dnnl_gather_bag_sum;
+const alg_kind_t gather_bag_mean = dnnl_gather_bag_mean;
+const alg_kind_t rope_interleaved = dnnl_rope_interleaved;
+const alg_kind_t rope_half = dnnl_rope_half;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -180,6 +188,9 @@ using sparse_encoding_t = dnnl_sparse_encoding_t;
 namespace sparse_encoding {
 const sparse_encoding_t undef = dnnl_sparse_encoding_undef;
 const sparse_encoding_t csr = dnnl_csr;
+const sparse_encoding_t bsr = dnnl_bsr;
+const sparse_encoding_t coo = dnnl_coo;
+const sparse_encoding_t grouped = dnnl_grouped;
 } // namespace sparse_encoding
 #else
 // Declare dummy values to avoid guarding internal implementation.
@@ -187,6 +198,9 @@ using sparse_encoding_t = int;
 namespace sparse_encoding {
 const sparse_encoding_t undef = 0;
 const sparse_encoding_t csr = 1;
+const sparse_encoding_t bsr = 2;
+const sparse_encoding_t coo = 3;
+const sparse_encoding_t grouped = 4;
 } // namespace sparse_encoding
 #endif
 
@@ -1736,6 +1750,8 @@ const normalization_flags_t use_scale = dnnl_use_scale;
 const normalization_flags_t use_shift = dnnl_use_shift;
 const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
+const normalization_flags_t rms_norm = dnnl_rms_norm;
+const normalization_flags_t fuse_residual_add = dnnl_fuse_residual_add;
 } // namespace normalization_flags
 
 using rnn_flags_t = dnnl_rnn_flags_t;
@@ -1796,10 +1812,14 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t topk = dnnl_topk;
+const primitive_kind_t gather = dnnl_gather;
+const primitive_kind_t rope = dnnl_rope;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
+const primitive_kind_t sdpa = (primitive_kind_t)(internal_only_start + 1);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -1926,6 +1946,7 @@ struct deconvolution_pd_t;
 struct eltwise_bwd_pd_t;
 struct eltwise_fwd_pd_t;
 struct eltwise_pd_t;
+struct gather_pd_t;
 struct gemm_pd_t;
 struct group_normalization_bwd_pd_t;
 struct group_normalization_fwd_pd_t;
@@ -1948,6 +1969,7 @@ struct prelu_pd_t;
 struct reduction_pd_t;
 struct reorder_pd_t;
 struct resampling_pd_t;
+struct rope_pd_t;
 struct rnn_bwd_pd_t;
 struct rnn_fwd_pd_t;
 struct rnn_pd_t;
@@ -1956,6 +1978,7 @@ struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
 struct sum_pd_t;
+struct topk_pd_t;
 
 } // namespace impl
 } // namespace dnnl
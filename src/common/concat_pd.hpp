@@ -64,6 +64,14 @@ struct concat_pd_t : public primitive_desc_t {
         return &glob_zero_md;
     }
 
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::axis_s32: *(int *)result = concat_dim(); break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
     int n_inputs() const override { return n_; }
     int n_outputs() const override { return 1; }
 
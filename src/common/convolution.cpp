@@ -76,7 +76,23 @@ status_t conv_desc_init(convolution_desc_t *conv_desc, prop_kind_t prop_kind,
     if (with_bias)
         runtime_dims_or_strides = runtime_dims_or_strides
                 || memory_desc_wrapper(bias_desc).has_runtime_dims_or_strides();
-    VCONDCHECK(create, check, conv, !runtime_dims_or_strides,
+    // Forward propagation supports a minibatch defined at execution time,
+    // every other dimension and all the strides have to be known here.
+    const auto only_mb_is_runtime = [](const memory_desc_t *md) {
+        const memory_desc_wrapper mdw(md);
+        if (!is_runtime_value(mdw.dims()[0]) || mdw.has_runtime_strides())
+            return false;
+        for (int d = 1; d < mdw.ndims(); d++)
+            if (is_runtime_value(mdw.dims()[d])) return false;
+        return true;
+    };
+    const bool runtime_mb = is_fwd && only_mb_is_runtime(src_desc)
+            && only_mb_is_runtime(dst_desc)
+            && !memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+            && IMPLICATION(with_bias,
+                    !memory_desc_wrapper(bias_desc)
+                             .has_runtime_dims_or_strides());
+    VCONDCHECK(create, check, conv, !runtime_dims_or_strides || runtime_mb,
             status::unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
 
     (prop_kind == backward_data ? cd.diff_src_desc : cd.src_desc) = *src_desc;
@@ -234,6 +250,12 @@ status_t dnnl_convolution_forward_primitive_desc_create(
     CHECK(dnnl::impl::conv_desc_init(&conv_desc, prop_kind, alg_kind, src_desc,
             weights_desc, bias_desc, dst_desc, strides, dilates, padding_l,
             padding_r));
+    // A runtime minibatch is supported by the CPU implementations only.
+    VCONDCHECK(create, check, conv,
+            IMPLICATION(memory_desc_wrapper(conv_desc.src_desc)
+                                .has_runtime_dims(),
+                    engine && engine->kind() == engine_kind::cpu),
+            unimplemented, VERBOSE_RUNTIMEDIM_UNSUPPORTED);
     CHECK(dnnl::impl::conv_attr_check(conv_desc, engine, attr));
     return primitive_desc_create(primitive_desc_iface, engine,
             (const op_desc_t *)&conv_desc, nullptr, attr);
@@ -77,6 +77,9 @@ const char *dnnl_engine_kind2str(dnnl_engine_kind_t v) {
 const char *dnnl_sparse_encoding2str(dnnl_sparse_encoding_t v) {
     if (v == dnnl_sparse_encoding_undef) return "undef";
     if (v == dnnl_csr) return "csr";
+    if (v == dnnl_bsr) return "bsr";
+    if (v == dnnl_coo) return "coo";
+    if (v == dnnl_grouped) return "grouped";
     assert(!"unknown sparse_encoding");
     return "unknown sparse_encoding";
 }
@@ -1607,6 +1610,9 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_topk) return "topk";
+    if (v == dnnl_gather) return "gather";
+    if (v == dnnl_rope) return "rope";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1670,6 +1676,7 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_binary_lt) return "binary_lt";
     if (v == dnnl_binary_eq) return "binary_eq";
     if (v == dnnl_binary_ne) return "binary_ne";
+    if (v == dnnl_binary_select) return "binary_select";
     if (v == dnnl_resampling_nearest) return "resampling_nearest";
     if (v == dnnl_resampling_linear) return "resampling_linear";
     if (v == dnnl_reduction_max) return "reduction_max";
@@ -1683,6 +1690,13 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_topk_max) return "topk_max";
+    if (v == dnnl_topk_min) return "topk_min";
+    if (v == dnnl_gather_rows) return "gather_rows";
+    if (v == dnnl_gather_bag_sum) return "gather_bag_sum";
+    if (v == dnnl_gather_bag_mean) return "gather_bag_mean";
+    if (v == dnnl_rope_interleaved) return "rope_interleaved";
+    if (v == dnnl_rope_half) return "rope_half";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
@@ -141,6 +141,10 @@ PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(topk);
+PKIND_TRAITS_INST(gather);
+PKIND_TRAITS_INST(rope);
+PKIND_TRAITS_INST(sdpa);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
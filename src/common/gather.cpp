@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "gather_pd.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_GATHER(cond, msg, ...) \
+    VCONDCHECK(create, check, gather, (cond), status::invalid_arguments, \
+            msg, ##__VA_ARGS__);
+
+#define VCHECK_GATHER_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(create, check, gather, (cond), status::unimplemented, msg, \
+            ##__VA_ARGS__);
+
+namespace dnnl {
+namespace impl {
+
+status_t gather_desc_init(gather_desc_t *gather_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *dst_desc) {
+
+    VCHECK_GATHER(!any_null(src_desc, indices_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_GATHER(
+            one_of(alg_kind, gather_rows, gather_bag_sum, gather_bag_mean),
+            VERBOSE_BAD_ALGORITHM);
+
+    const bool with_bags = alg_kind != gather_rows;
+    const bool with_offsets
+            = offsets_desc != nullptr && offsets_desc->ndims != 0;
+    VCHECK_GATHER(with_bags == with_offsets, VERBOSE_NULL_ARG);
+
+    VCHECK_GATHER(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_GATHER(indices_desc->ndims == 1, VERBOSE_BAD_NDIMS, "indices",
+            indices_desc->ndims);
+    VCHECK_GATHER(dst_desc->ndims == 2, VERBOSE_BAD_NDIMS, "dst",
+            dst_desc->ndims);
+    VCHECK_GATHER(indices_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "indices");
+
+    const dim_t n_rows = with_bags ? offsets_desc->dims[0]
+                                   : indices_desc->dims[0];
+    if (with_bags) {
+        VCHECK_GATHER(offsets_desc->ndims == 1, VERBOSE_BAD_NDIMS, "offsets",
+                offsets_desc->ndims);
+        VCHECK_GATHER(offsets_desc->data_type == data_type::s32,
+                VERBOSE_INVALID_DATATYPE, "offsets");
+    }
+    VCHECK_GATHER(dst_desc->dims[0] == n_rows, VERBOSE_INCONSISTENT_DIM,
+            with_bags ? "offsets" : "indices", 0, "dst", 0);
+    VCHECK_GATHER(dst_desc->dims[1] == src_desc->dims[1],
+            VERBOSE_INCONSISTENT_DIM, "src", 1, "dst", 1);
+
+    for (auto md : {src_desc, indices_desc, offsets_desc, dst_desc}) {
+        if (md == nullptr || md->ndims == 0) continue;
+        VCHECK_GATHER(!memory_desc_wrapper(md).has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    }
+    VCHECK_GATHER(src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "src");
+    VCHECK_GATHER(dst_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG,
+            "dst");
+    for (auto md : {src_desc, indices_desc, offsets_desc}) {
+        if (md == nullptr || md->ndims == 0) continue;
+        VCHECK_GATHER(md->format_kind == format_kind::blocked,
+                VERBOSE_UNSUPPORTED_TAG);
+    }
+    VCHECK_GATHER(one_of(dst_desc->format_kind, format_kind::blocked,
+                          format_kind::any),
+            VERBOSE_UNSUPPORTED_TAG_S, "dst");
+
+    auto gd = gather_desc_t();
+    gd.primitive_kind = primitive_kind::gather;
+    gd.alg_kind = alg_kind;
+
+    gd.src_desc = *src_desc;
+    gd.indices_desc = *indices_desc;
+    if (with_bags) gd.offsets_desc = *offsets_desc;
+    gd.dst_desc = *dst_desc;
+
+    (*gather_desc) = gd;
+    return success;
+}
+
+status_t gather_attr_check(const gather_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Only table scales are supported: either common or one per table row.
+    VCHECK_GATHER_UNIMPL(attr->has_default_values(smask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &sc = attr->scales_;
+    VCHECK_GATHER_UNIMPL(sc.has_default_values({DNNL_ARG_SRC}),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VCHECK_GATHER_UNIMPL(one_of(sc.get(DNNL_ARG_SRC).mask_, 0, 1),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+} // namespace impl
+} // namespace dnnl
+
+dnnl_status_t dnnl_gather_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *src_desc,
+        const memory_desc_t *indices_desc, const memory_desc_t *offsets_desc,
+        const memory_desc_t *dst_desc, const primitive_attr_t *attr) {
+
+    auto gather_desc = gather_desc_t();
+    CHECK(gather_desc_init(&gather_desc, alg_kind, src_desc, indices_desc,
+            offsets_desc, dst_desc));
+    CHECK(gather_attr_check(gather_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&gather_desc, nullptr, attr);
+}
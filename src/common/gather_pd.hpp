@@ -0,0 +1,143 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_GATHER_PD_HPP
+#define COMMON_GATHER_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_GATHER(cond, msg, ...) \
+    VCONDCHECK(create, dispatch, gather, (cond), status::unimplemented, \
+            "%s," msg, this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t gather_desc_init(gather_desc_t *gather_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *indices_desc,
+        const memory_desc_t *offsets_desc, const memory_desc_t *dst_desc);
+
+struct gather_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::gather;
+
+    typedef gather_pd_t hint_class;
+
+    const gather_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_1: return arg_usage_t::input;
+            case DNNL_ARG_SRC_2:
+                return with_bags() ? arg_usage_t::input : arg_usage_t::unused;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_SRC_2: return src_md(2);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.indices_desc;
+            case 2: return &desc_.offsets_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *indices_md() const { return src_md(1); }
+    const memory_desc_t *offsets_md() const { return src_md(2); }
+
+    int n_inputs() const override { return 2 + int(with_bags()); }
+    int n_outputs() const override { return 1; }
+
+    bool with_bags() const { return desc_.alg_kind != alg_kind::gather_rows; }
+    bool is_mean() const {
+        return desc_.alg_kind == alg_kind::gather_bag_mean;
+    }
+
+    // Number of table rows and the length of a row.
+    dim_t table_rows() const { return desc_.src_desc.dims[0]; }
+    dim_t row_size() const { return desc_.src_desc.dims[1]; }
+    dim_t n_indices() const { return desc_.indices_desc.dims[0]; }
+    // Number of destination rows: one per index or one per bag.
+    dim_t dst_rows() const { return dst_md_.dims[0]; }
+
+    bool with_scales() const {
+        return !attr()->scales_.get(DNNL_ARG_SRC).has_default_values();
+    }
+    bool with_row_scales() const {
+        return with_scales() && attr()->scales_.get(DNNL_ARG_SRC).mask_ != 0;
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(dst_md_).has_zero_dim();
+    }
+
+protected:
+    gather_desc_t desc_;
+
+    memory_desc_t dst_md_;
+
+    gather_pd_t(const gather_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // The destination is dense row-major unless the user provided a layout.
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_tag(dst_md_, format_tag::ab);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
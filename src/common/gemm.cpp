@@ -25,6 +25,7 @@
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "cpu/gemm/gemm.hpp"
+#include "cpu/gemm/gemm_pack.hpp"
 #endif
 
 #include "common/bfloat16.hpp"
@@ -46,6 +47,22 @@ const char *c2f_offsetC(const char *offC) {
     return offC;
 }
 
+// The row-major problem is computed as the column-major one with swapped A
+// and B, so packing A of the former means packing B of the latter.
+char c2f_identifier(char identifier) {
+    if (identifier == 'A' || identifier == 'a') return 'B';
+    if (identifier == 'B' || identifier == 'b') return 'A';
+    return identifier;
+}
+
+// The problems of a batch may run concurrently, so the matrices C of a
+// strided batch must not overlap.
+bool batch_stride_c_ok(
+        dim_t M, dim_t N, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+    if (batch_size <= 1 || M <= 0 || N <= 0) return true;
+    return stride_c >= (M - 1) * ldc + N;
+}
+
 std::string get_descriptor(dim_t M, dim_t N, dim_t K) {
     std::string s_ = std::to_string(M);
     s_ += "x";
@@ -142,22 +159,260 @@ dnnl_status_t dnnl_gemm_s8s8s32(char transa, char transb, char offsetc, dim_t M,
 #endif
 }
 
-extern "C" dnnl_status_t DNNL_API dnnl_gemm_bf16bf16f32(char transa,
-        char transb, dim_t M, dim_t N, dim_t K, float alpha,
-        const bfloat16_t *A, dim_t lda, const bfloat16_t *B, dim_t ldb,
-        float beta, float *C, dim_t ldc) {
+dnnl_status_t dnnl_sgemm_batch(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const float *const *A, const dim_t *lda,
+        const float *const *B, const dim_t *ldb, float beta, float *const *C,
+        const dim_t *ldc, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return dnnl::impl::status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, lda, B, ldb, C, ldc))
+        return dnnl::impl::status::invalid_arguments;
+
+    // The leading dimensions vary across the batch, so the call is not
+    // reported by the gemm_api verbose line.
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha, B[i],
+                &ldb[i], A[i], &lda[i], &beta, C[i], &ldc[i], nullptr, false);
+    };
+    return MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_batch, cpu::gemm_batch,
+            batch_size, M, N, K, gemm_exec);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_sgemm_batch_strided(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
+        dim_t stride_a, const float *B, dim_t ldb, dim_t stride_b, float beta,
+        float *C, dim_t ldc, dim_t stride_c, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0 || stride_a < 0 || stride_b < 0 || stride_c < 0)
+        return dnnl::impl::status::invalid_arguments;
+    if (!batch_stride_c_ok(M, N, ldc, stride_c, batch_size))
+        return dnnl::impl::status::invalid_arguments;
+
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::extended_sgemm(&transb, &transa, &N, &M, &K, &alpha,
+                B + i * stride_b, &ldb, A + i * stride_a, &lda, &beta,
+                C + i * stride_c, &ldc, nullptr, false);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f32", "f32", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_sgemm_batch_strided,
+                    cpu::gemm_batch, batch_size, M, N, K, gemm_exec));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *const *A,
+        const dim_t *lda, uint8_t ao, const int8_t *const *B, const dim_t *ldb,
+        int8_t bo, float beta, int32_t *const *C, const dim_t *ldc,
+        const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return dnnl::impl::status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, lda, B, ldb, C, ldc))
+        return dnnl::impl::status::invalid_arguments;
+
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::gemm_s8x8s32<uint8_t>(&transb, &transa,
+                c2f_offsetC(&offsetc), &N, &M, &K, &alpha, B[i], &ldb[i], &bo,
+                A[i], &lda[i], &ao, &beta, C[i], &ldc[i], co);
+    };
+    return MAYBE_RUN_STACK_CHECKER(dnnl_gemm_u8s8s32_batch, cpu::gemm_batch,
+            batch_size, M, N, K, gemm_exec);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_u8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const uint8_t *A,
+        dim_t lda, dim_t stride_a, uint8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0 || stride_a < 0 || stride_b < 0 || stride_c < 0)
+        return dnnl::impl::status::invalid_arguments;
+    if (!batch_stride_c_ok(M, N, ldc, stride_c, batch_size))
+        return dnnl::impl::status::invalid_arguments;
+
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::gemm_s8x8s32<uint8_t>(&transb, &transa,
+                c2f_offsetC(&offsetc), &N, &M, &K, &alpha, B + i * stride_b,
+                &ldb, &bo, A + i * stride_a, &lda, &ao, &beta,
+                C + i * stride_c, &ldc, co);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "u8", "s8", "s32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_u8s8s32_batch_strided,
+                    cpu::gemm_batch, batch_size, M, N, K, gemm_exec));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch(char transa, char transb, char offsetc,
+        dim_t M, dim_t N, dim_t K, float alpha, const int8_t *const *A,
+        const dim_t *lda, int8_t ao, const int8_t *const *B, const dim_t *ldb,
+        int8_t bo, float beta, int32_t *const *C, const dim_t *ldc,
+        const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0) return dnnl::impl::status::invalid_arguments;
+    if (batch_size > 0 && utils::any_null(A, lda, B, ldb, C, ldc))
+        return dnnl::impl::status::invalid_arguments;
+
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::gemm_s8x8s32<int8_t>(&transb, &transa,
+                c2f_offsetC(&offsetc), &N, &M, &K, &alpha, B[i], &ldb[i], &bo,
+                A[i], &lda[i], &ao, &beta, C[i], &ldc[i], co);
+    };
+    return MAYBE_RUN_STACK_CHECKER(dnnl_gemm_s8s8s32_batch, cpu::gemm_batch,
+            batch_size, M, N, K, gemm_exec);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_s8s8s32_batch_strided(char transa, char transb,
+        char offsetc, dim_t M, dim_t N, dim_t K, float alpha, const int8_t *A,
+        dim_t lda, dim_t stride_a, int8_t ao, const int8_t *B, dim_t ldb,
+        dim_t stride_b, int8_t bo, float beta, int32_t *C, dim_t ldc,
+        dim_t stride_c, const int32_t *co, dim_t batch_size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (batch_size < 0 || stride_a < 0 || stride_b < 0 || stride_c < 0)
+        return dnnl::impl::status::invalid_arguments;
+    if (!batch_stride_c_ok(M, N, ldc, stride_c, batch_size))
+        return dnnl::impl::status::invalid_arguments;
+
+    auto gemm_exec = [&](dim_t i) {
+        return cpu::gemm_s8x8s32<int8_t>(&transb, &transa,
+                c2f_offsetC(&offsetc), &N, &M, &K, &alpha, B + i * stride_b,
+                &ldb, &bo, A + i * stride_a, &lda, &ao, &beta,
+                C + i * stride_c, &ldc, co);
+    };
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "s8", "s8", "s32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_s8s8s32_batch_strided,
+                    cpu::gemm_batch, batch_size, M, N, K, gemm_exec));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, float alpha, const uint16_t *A, dim_t lda,
+        const uint16_t *B, dim_t ldb, float beta, float *C, dim_t ldc) {
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
     status_t status = dnnl_success;
     MAYBE_VERBOSE(status, "bf16", "bf16", "f32",
             MAYBE_RUN_STACK_CHECKER(dnnl_gemm_bf16bf16f32,
                     cpu::gemm_bf16bf16f32, &transb, &transa, &N, &M, &K, &alpha,
-                    B, &ldb, A, &lda, &beta, C, &ldc));
+                    reinterpret_cast<const bfloat16_t *>(B), &ldb,
+                    reinterpret_cast<const bfloat16_t *>(A), &lda, &beta, C,
+                    &ldc));
     return status;
 #else
     return dnnl::impl::status::unimplemented;
 #endif
 }
 
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    const char identifier_f = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack_get_size(&identifier_f, &transb,
+            &transa, &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char identifier_f = c2f_identifier(identifier);
+    return cpu::gemm_bf16bf16f32_pack(&identifier_f, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, reinterpret_cast<const bfloat16_t *>(src),
+            static_cast<bfloat16_t *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_bf16bf16f32_compute(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_bf16bf16f32_compute(&transb, &transa, &N, &M, &K,
+            static_cast<const bfloat16_t *>(B), &ldb,
+            static_cast<const bfloat16_t *>(A), &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32(char transa, char transb, dim_t M, dim_t N,
+        dim_t K, float alpha, const uint16_t *A, dim_t lda, const uint16_t *B,
+        dim_t ldb, float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    status_t status = dnnl_success;
+    MAYBE_VERBOSE(status, "f16", "f16", "f32",
+            MAYBE_RUN_STACK_CHECKER(dnnl_gemm_f16f16f32,
+                    cpu::gemm_f16f16f32, &transb, &transa, &N, &M, &K, &alpha,
+                    reinterpret_cast<const float16_t *>(B), &ldb,
+                    reinterpret_cast<const float16_t *>(A), &lda, &beta, C,
+                    &ldc));
+    return status;
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32_pack_get_size(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        size_t *size) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (size == nullptr) return dnnl::impl::status::invalid_arguments;
+    const char identifier_f = c2f_identifier(identifier);
+    return cpu::gemm_f16f16f32_pack_get_size(&identifier_f, &transb, &transa,
+            &N, &M, &K, &ldb, &lda, size);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32_pack(char identifier, char transa,
+        char transb, dim_t M, dim_t N, dim_t K, dim_t lda, dim_t ldb,
+        const uint16_t *src, void *dst) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    const char identifier_f = c2f_identifier(identifier);
+    return cpu::gemm_f16f16f32_pack(&identifier_f, &transb, &transa, &N, &M,
+            &K, &ldb, &lda, reinterpret_cast<const float16_t *>(src),
+            static_cast<float *>(dst));
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
+dnnl_status_t dnnl_gemm_f16f16f32_compute(char transa, char transb, dim_t M,
+        dim_t N, dim_t K, const void *A, dim_t lda, const void *B, dim_t ldb,
+        float beta, float *C, dim_t ldc) {
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    return cpu::gemm_f16f16f32_compute(
+            &transb, &transa, &N, &M, &K, B, &ldb, A, &lda, &beta, C, &ldc);
+#else
+    return dnnl::impl::status::unimplemented;
+#endif
+}
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
 dnnl_status_t dnnl_threadpool_interop_sgemm(char transa, char transb, dim_t M,
         dim_t N, dim_t K, float alpha, const float *A, dim_t lda,
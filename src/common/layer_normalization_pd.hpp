@@ -75,6 +75,16 @@ struct layer_normalization_pd_t : public primitive_desc_t {
     bool use_global_stats() const {
         return desc_.flags & normalization_flags::use_global_stats;
     }
+    // RMS normalization: the mean is assumed to be zero, neither computed
+    // nor passed by the user.
+    bool skip_mean() const {
+        return desc_.flags & normalization_flags::rms_norm;
+    }
+    // The residual tensor is added to the source before normalization and
+    // the sum is written out as an additional destination.
+    bool fuse_residual_add() const {
+        return desc_.flags & normalization_flags::fuse_residual_add;
+    }
 
     bool is_fwd() const {
         return utils::one_of(desc_.prop_kind, prop_kind::forward_training,
@@ -90,6 +100,10 @@ struct layer_normalization_pd_t : public primitive_desc_t {
 
     const memory_desc_t *stat_md() const { return &stat_md_; }
 
+    // Number of user statistics tensors: mean and variance, or the variance
+    // only for RMS normalization.
+    int n_stats() const { return 2 - skip_mean(); }
+
 protected:
     layer_normalization_desc_t desc_;
     const layer_normalization_fwd_pd_t *hint_fwd_pd_;
@@ -154,6 +168,12 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     arg_usage_t arg_usage(int arg) const override {
         if (arg == DNNL_ARG_SRC) return arg_usage_t::input;
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        if (utils::one_of(arg, DNNL_ARG_SRC_1, DNNL_ARG_DST_1)
+                && fuse_residual_add())
+            return arg == DNNL_ARG_SRC_1 ? arg_usage_t::input
+                                         : arg_usage_t::output;
+
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
 
         if (utils::one_of(arg, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE)) {
             if (stats_are_src()) return arg_usage_t::input;
@@ -172,6 +192,8 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         switch (arg) {
             case DNNL_ARG_SRC: return src_md(0);
             case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_SRC_1: return src_md(3);
+            case DNNL_ARG_DST_1: return dst_md(3);
             case DNNL_ARG_MEAN: return stats_are_src() ? src_md(1) : dst_md(1);
             case DNNL_ARG_VARIANCE:
                 return stats_are_src() ? src_md(2) : dst_md(2);
@@ -185,6 +207,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
             int index = 0, bool user_input = false) const override {
         if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
         if (stats_are_src() && (index == 1 || index == 2)) return &stat_md_;
+        if (fuse_residual_add() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -193,6 +216,7 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
         if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
         if (!stats_are_src() && is_training() && (index == 1 || index == 2))
             return &stat_md_;
+        if (fuse_residual_add() && index == 3) return &src_md_;
         return &glob_zero_md;
     }
 
@@ -202,10 +226,12 @@ struct layer_normalization_fwd_pd_t : public layer_normalization_pd_t {
     }
 
     int n_inputs() const override {
-        return 1 + 2 * stats_are_src() + use_scale() + use_shift();
+        return 1 + n_stats() * stats_are_src() + use_scale() + use_shift()
+                + fuse_residual_add();
     }
     int n_outputs() const override {
-        return 1 + 2 * (!stats_are_src()) * is_training();
+        return 1 + n_stats() * (!stats_are_src()) * is_training()
+                + fuse_residual_add();
     }
 
 protected:
@@ -245,6 +271,8 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
     typedef layer_normalization_fwd_pd_t hint_class;
 
     arg_usage_t arg_usage(int arg) const override {
+        if (arg == DNNL_ARG_MEAN && skip_mean()) return arg_usage_t::unused;
+
         if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_MEAN, DNNL_ARG_VARIANCE,
                     DNNL_ARG_DIFF_DST))
             return arg_usage_t::input;
@@ -306,7 +334,9 @@ struct layer_normalization_bwd_pd_t : public layer_normalization_pd_t {
         return index == 0 ? &diff_scaleshift_md_ : &glob_zero_md;
     }
 
-    int n_inputs() const override { return 4 + use_scale() + use_shift(); }
+    int n_inputs() const override {
+        return 2 + n_stats() + use_scale() + use_shift();
+    }
     int n_outputs() const override {
         return 1
                 + (desc_.prop_kind == prop_kind::backward)
@@ -126,20 +126,32 @@ status_t dnnl_matmul_primitive_desc_create(
     const int ndims = dst_md->ndims;
     VCHECK_MATMUL(ndims >= 2 && ndims <= DNNL_MAX_NDIMS, VERBOSE_BAD_NDIMS,
             "dst", ndims);
-    VCHECK_MATMUL(everyone_is(ndims, src_md->ndims, weights_md->ndims),
+    // With a grouped src every group of rows is multiplied by its own
+    // weights matrix, so the weights have an extra leading groups dimension.
+    const bool is_grouped_src = src_md->format_kind == format_kind::sparse
+            && src_md->format_desc.sparse_desc.encoding
+                    == sparse_encoding::grouped;
+    const int wei_off = is_grouped_src ? 1 : 0;
+    VCHECK_MATMUL(
+            everyone_is(ndims, src_md->ndims, weights_md->ndims - wei_off),
             VERBOSE_INCONSISTENT_NDIMS, "src", "weights");
+    VCHECK_MATMUL(IMPLICATION(is_grouped_src,
+                          weights_md->dims[0]
+                                  == src_md->format_desc.sparse_desc.ngroups),
+            VERBOSE_BAD_DIM, "weights", 0);
     VCHECK_MATMUL(IMPLICATION(with_bias, op_d.bias_desc.ndims == ndims),
             VERBOSE_BAD_NDIMS, "bias", op_d.bias_desc.ndims);
 
     // check: m, n, k
     const int m_idx = ndims - 2;
     const int k_idx_src = m_idx + 1;
-    const int k_idx_wei = m_idx;
+    const int k_idx_wei = m_idx + wei_off;
     const int n_idx = ndims - 1;
+    const int n_idx_wei = n_idx + wei_off;
     VCHECK_MATMUL(dst_md->dims[m_idx] == src_md->dims[m_idx],
             VERBOSE_INCONSISTENT_DIM, "dst", m_idx, "src", m_idx);
-    VCHECK_MATMUL(dst_md->dims[n_idx] == weights_md->dims[n_idx],
-            VERBOSE_INCONSISTENT_DIM, "dst", n_idx, "weights", n_idx);
+    VCHECK_MATMUL(dst_md->dims[n_idx] == weights_md->dims[n_idx_wei],
+            VERBOSE_INCONSISTENT_DIM, "dst", n_idx, "weights", n_idx_wei);
     VCHECK_MATMUL(src_md->dims[k_idx_src] == weights_md->dims[k_idx_wei],
             VERBOSE_INCONSISTENT_DIM, "src", k_idx_src, "weights", k_idx_wei);
     VCHECK_MATMUL(
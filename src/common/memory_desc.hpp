@@ -144,7 +144,15 @@ struct sparse_desc_t {
     // Metadata types. Each encoding defines how to interpret these.
     // - CSR: 0th - index data type
     //        1st - pointer data type
+    // - BSR: 0th - block column index data type
+    //        1st - block row pointer data type
+    // - COO: 0th - index data type
+    // - grouped: 0th - group offset data type
     dnnl_data_type_t metadata_types[max_metadata_types];
+    // Block dimensions. Used by BSR only, zeros otherwise.
+    dnnl_dims_t block_dims;
+    // Number of groups. Used by the grouped encoding only, zero otherwise.
+    dnnl_dim_t ngroups;
 };
 
 // Description of extra information stored in memory
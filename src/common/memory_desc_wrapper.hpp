@@ -92,6 +92,22 @@ struct memory_desc_wrapper : public c_compatible {
         return sparse_desc().nnz;
     }
 
+    const dims_t &block_dims() const {
+        assert(is_sparse_desc());
+        return sparse_desc().block_dims;
+    }
+
+    dim_t ngroups() const {
+        assert(is_sparse_desc());
+        return sparse_desc().ngroups;
+    }
+
+    // Returns the number of stored blocks for the BSR encoding.
+    dim_t nnz_blocks() const {
+        assert(is_sparse_desc() && encoding() == sparse_encoding::bsr);
+        return nnz() / utils::array_product(block_dims(), ndims());
+    }
+
     const dims_t &strides() const { return blocking_desc().strides; }
 
     const memory_extra_desc_t &extra() const { return md_->extra; }
@@ -257,6 +273,44 @@ struct memory_desc_wrapper : public c_compatible {
                     }
                     default: assert(!"unknown component"); return 0;
                 }
+            } else if (sparse_desc().encoding == sparse_encoding::bsr) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for block column indices.
+                    case 1: {
+                        const auto idx_dt = metadata_type(0);
+                        return nnz_blocks() * types::data_type_size(idx_dt);
+                    }
+                    // Return size for block row pointers.
+                    case 2: {
+                        const auto ptr_dt = metadata_type(1);
+                        return (dims()[0] / block_dims()[0] + 1)
+                                * types::data_type_size(ptr_dt);
+                    }
+                    default: assert(!"unknown component"); return 0;
+                }
+            } else if (sparse_desc().encoding == sparse_encoding::coo) {
+                // Return size for values.
+                if (index == 0) return nnz() * data_type_size();
+                // Return size for indices of every dimension.
+                if (index <= ndims()) {
+                    const auto idx_dt = metadata_type(0);
+                    return nnz() * types::data_type_size(idx_dt);
+                }
+                assert(!"unknown component");
+                return 0;
+            } else if (sparse_desc().encoding == sparse_encoding::grouped) {
+                switch (index) {
+                    // Return size for values.
+                    case 0: return nnz() * data_type_size();
+                    // Return size for group offsets.
+                    case 1: {
+                        const auto off_dt = metadata_type(0);
+                        return (ngroups() + 1) * types::data_type_size(off_dt);
+                    }
+                    default: assert(!"unknown component"); return 0;
+                }
             } else {
                 assert(!"unknown sparse encoding");
                 return 0;
@@ -239,6 +239,9 @@ enum {
     key_lnorm_tmp_diff_ss,
     key_lnorm_reduction,
     key_matmul_dst_in_acc_dt,
+    key_matmul_grouped_tile_ptr,
+    key_matmul_sparse_col_idx,
+    key_matmul_sparse_col_ptr,
     key_pool_dst_bf16cvt,
     key_pool_dst_plain2blocked_cvt,
     key_pool_ind_plain2blocked_cvt,
@@ -263,10 +266,15 @@ enum {
     key_reorder_rnn_weights_quantization,
     key_reorder_rnn_weights_reduction,
     key_reorder_rnn_weights_transposition,
+    key_reorder_sparse_row_counts,
+    key_reorder_sparse_sort_hist,
+    key_reorder_sparse_sort_keys,
+    key_reorder_sparse_sort_perm,
     key_rnn_space,
     key_rnn_bf32_attention_trans,
     key_rnn_bf32_wei_layer_trans,
     key_rnn_bf32_wei_iter_trans,
+    key_rnn_bctx,
     key_rnn_cell,
     key_rnn_diff_states,
     key_rnn_gates,
@@ -279,10 +287,19 @@ enum {
     key_rnn_ptrs_wei_layer,
     key_rnn_ptrs_wei_iter,
     key_rnn_ptrs_wei_projection,
+    key_rope_cos_sin,
+    key_sdpa_acc,
+    key_sdpa_keys_packed,
+    key_sdpa_probs,
+    key_sdpa_scores,
+    key_sdpa_stats,
+    key_sdpa_values_packed,
     key_softmax_reduction,
     key_softmax_interim_store,
     key_sum_reduction,
     key_sum_srcs_cvt,
+    key_topk_candidates,
+    key_topk_partial,
     key_wino_U,
     key_wino_V,
     key_wino_M,
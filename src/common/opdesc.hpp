@@ -21,6 +21,7 @@
 
 #include "common/c_types_map.hpp"
 #include "common/gemm_types.hpp"
+#include "common/sdpa_types.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -417,6 +418,65 @@ struct reduction_desc_t {
     float p, eps;
 };
 
+// A descriptor of TopK operation.
+struct topk_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_topk.
+    primitive_kind_t primitive_kind;
+    // The kind of TopK algorithm. Possible values: #dnnl_topk_max,
+    // #dnnl_topk_min.
+    alg_kind_t alg_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor for selected values.
+    memory_desc_t dst_desc;
+    // Destination memory descriptor for indices of selected values.
+    memory_desc_t indices_desc;
+    // The axis along which selection is performed.
+    int axis;
+    // The number of selected elements, equals to dst_desc.dims[axis].
+    dim_t k;
+};
+
+// A descriptor of gather operation.
+struct gather_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_gather.
+    primitive_kind_t primitive_kind;
+    // The kind of gather algorithm. Possible values: #dnnl_gather_rows,
+    // #dnnl_gather_bag_sum, #dnnl_gather_bag_mean.
+    alg_kind_t alg_kind;
+    // Source (table) memory descriptor.
+    memory_desc_t src_desc;
+    // Indices memory descriptor.
+    memory_desc_t indices_desc;
+    // Bag offsets memory descriptor. Zero for #dnnl_gather_rows.
+    memory_desc_t offsets_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+};
+
+// A descriptor of rotary position embedding (RoPE) operation.
+struct rope_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_rope.
+    primitive_kind_t primitive_kind;
+    // The kind of RoPE algorithm. Possible values: #dnnl_rope_interleaved,
+    // #dnnl_rope_half.
+    alg_kind_t alg_kind;
+    // Source memory descriptor.
+    memory_desc_t src_desc;
+    // Destination memory descriptor.
+    memory_desc_t dst_desc;
+    // Memory descriptor of either f32 table of cosines and sines or s32
+    // positions.
+    memory_desc_t cos_sin_desc;
+    // The axis of positions.
+    int axis;
+    // The base of angles computed from positions.
+    float theta;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -447,10 +507,12 @@ struct binary_desc_t {
     primitive_kind_t primitive_kind;
     // The kind of the binary algorithm. Possible values:
     // #dnnl_binary_add, #dnnl_binary_mul, #dnnl_binary_max, #dnnl_binary_min,
-    // #dnnl_binary_div and #dnnl_binary_sub.
+    // #dnnl_binary_div, #dnnl_binary_sub, the comparisons and
+    // #dnnl_binary_select.
     alg_kind_t alg_kind;
-    // Source memory descriptors.
-    memory_desc_t src_desc[2];
+    // Source memory descriptors. The third one is the condition of
+    // #dnnl_binary_select and is a zero memory descriptor otherwise.
+    memory_desc_t src_desc[3];
     // Destination memory descriptor.
     memory_desc_t dst_desc;
 };
@@ -614,6 +676,10 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        topk_desc_t topk;
+        gather_desc_t gather;
+        rope_desc_t rope;
+        sdpa_desc_t sdpa;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -646,6 +712,10 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(topk_desc_t);
+    DECL_CTOR_AND_CONVERTERS(gather_desc_t);
+    DECL_CTOR_AND_CONVERTERS(rope_desc_t);
+    DECL_CTOR_AND_CONVERTERS(sdpa_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
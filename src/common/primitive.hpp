@@ -145,8 +145,18 @@ private:
 #define ARG_TYPE(t) \
     typename std::remove_cv<typename std::remove_pointer<t>::type>::type
 
+#define CTX_OUT_MEM_COMMON(type, arg, index) \
+    static_cast<ARG_TYPE(type) *>(ctx.host_ptr(arg, false, nullptr, index))
+
+#define CTX_OUT_MEm(type, arg) CTX_OUT_MEM_COMMON(type, arg, 0)
+#define CTX_OUT_MEm0(type, arg) CTX_OUT_MEM_COMMON(type, arg, 0)
+#define CTX_OUT_MEm1(type, arg) CTX_OUT_MEM_COMMON(type, arg, 1)
+#define CTX_OUT_MEm2(type, arg) CTX_OUT_MEM_COMMON(type, arg, 2)
+
 // Returns destination memory which may not have been zero pad initialized.
-#define CTX_OUT_MEM(type, arg) static_cast<ARG_TYPE(type) *>(ctx.host_ptr(arg))
+// __VA_ARGS__here is an index of the buffer. It is empty unless the memory
+// argument is sparse.
+#define CTX_OUT_MEM(type, arg, ...) CTX_OUT_MEm##__VA_ARGS__(type, arg)
 
 // Returns destination memory which has been zero pad initialized. This macro
 // may result in a failure returned via the `status` input since zero pad
@@ -209,14 +209,15 @@ status_t post_ops_t::append_dw(data_type_t wei_dt, data_type_t bias_dt,
     return success;
 }
 
-status_t post_ops_t::validate_binary(
-        alg_kind_t alg, const memory_desc_t *user_src1_desc) const {
+status_t post_ops_t::validate_binary(alg_kind_t alg,
+        const memory_desc_t *user_src1_desc,
+        const memory_desc_t *user_src2_desc) const {
 
     if (len() == post_ops_limit) return out_of_memory;
     using namespace alg_kind;
     bool alg_ok = one_of(alg, binary_add, binary_mul, binary_max, binary_min,
             binary_div, binary_sub, binary_ge, binary_gt, binary_le, binary_lt,
-            binary_eq, binary_ne);
+            binary_eq, binary_ne, binary_select);
     if (!alg_ok) return invalid_arguments;
     if (!memory_desc_sanity_check(*user_src1_desc)) return invalid_arguments;
 
@@ -226,12 +227,28 @@ status_t post_ops_t::validate_binary(
             return invalid_arguments;
     }
 
+    const bool with_src2
+            = user_src2_desc && !types::is_zero_md(user_src2_desc);
+    if (alg != binary_select) return with_src2 ? invalid_arguments : success;
+
+    // The condition of select is a s8 tensor of the same rank as src1.
+    if (!with_src2) return invalid_arguments;
+    if (!memory_desc_sanity_check(*user_src2_desc)) return invalid_arguments;
+    if (user_src2_desc->data_type != data_type::s8) return invalid_arguments;
+    if (user_src2_desc->ndims != user_src1_desc->ndims)
+        return invalid_arguments;
+    for (int d = 0; d < user_src2_desc->ndims; ++d) {
+        if (user_src2_desc->dims[d] == DNNL_RUNTIME_DIM_VAL)
+            return invalid_arguments;
+    }
+
     return success;
 }
 
-status_t post_ops_t::append_binary(
-        alg_kind_t alg, const memory_desc_t *user_src1_desc) {
-    auto status = validate_binary(alg, user_src1_desc);
+status_t post_ops_t::append_binary(alg_kind_t alg,
+        const memory_desc_t *user_src1_desc,
+        const memory_desc_t *user_src2_desc) {
+    auto status = validate_binary(alg, user_src1_desc, user_src2_desc);
     if (status != success) return status;
 
     entry_.emplace_back();
@@ -240,12 +257,16 @@ status_t post_ops_t::append_binary(
     e.binary.alg = alg;
     e.binary.user_src1_desc = *user_src1_desc;
     e.binary.src1_desc = *user_src1_desc;
+    e.binary.user_src2_desc
+            = alg == alg_kind::binary_select ? *user_src2_desc : glob_zero_md;
+    e.binary.src2_desc = e.binary.user_src2_desc;
     return success;
 }
 
-status_t post_ops_t::prepend_binary(
-        alg_kind_t alg, const memory_desc_t *user_src1_desc) {
-    auto status = validate_binary(alg, user_src1_desc);
+status_t post_ops_t::prepend_binary(alg_kind_t alg,
+        const memory_desc_t *user_src1_desc,
+        const memory_desc_t *user_src2_desc) {
+    auto status = validate_binary(alg, user_src1_desc, user_src2_desc);
     if (status != success) return status;
 
     entry_.emplace(entry_.begin());
@@ -254,6 +275,9 @@ status_t post_ops_t::prepend_binary(
     e.binary.alg = alg;
     e.binary.user_src1_desc = *user_src1_desc;
     e.binary.src1_desc = *user_src1_desc;
+    e.binary.user_src2_desc
+            = alg == alg_kind::binary_select ? *user_src2_desc : glob_zero_md;
+    e.binary.src2_desc = e.binary.user_src2_desc;
     return success;
 }
 
@@ -292,19 +316,21 @@ status_t post_ops_t::set_default_formats(const memory_desc_t *dst_md) {
     for (int idx = 0; idx < len(); ++idx) {
         if (!contain(primitive_kind::binary, idx)) continue;
 
-        auto &src1_md = entry_[idx].binary.src1_desc;
-        const memory_desc_wrapper src1_mdw(src1_md);
-        if (!src1_mdw.format_any()) continue;
+        auto &b = entry_[idx].binary;
+        for (auto *md : {&b.src1_desc, &b.src2_desc}) {
+            const memory_desc_wrapper mdw(md);
+            if (mdw.is_zero() || !mdw.format_any()) continue;
 
-        const memory_desc_wrapper dst_mdw(dst_md);
-        assert(!dst_mdw.format_any());
+            const memory_desc_wrapper dst_mdw(dst_md);
+            assert(!dst_mdw.format_any());
 
-        // 1D tensors should be plain abx.
-        if (src1_mdw.count_non_unit_dims(1))
-            CHECK(memory_desc_init_by_strides(src1_md, nullptr));
-        else
-            CHECK(memory_desc_init_by_blocking_desc(
-                    src1_md, dst_mdw.blocking_desc()));
+            // 1D tensors should be plain abx.
+            if (mdw.count_non_unit_dims(1))
+                CHECK(memory_desc_init_by_strides(*md, nullptr));
+            else
+                CHECK(memory_desc_init_by_blocking_desc(
+                        *md, dst_mdw.blocking_desc()));
+        }
     }
 
     return status::success;
@@ -587,14 +613,30 @@ status_t dnnl_post_ops_append_binary(post_ops_t *post_ops, alg_kind_t alg_kind,
     return post_ops->append_binary(alg_kind, user_src1_desc);
 }
 
+status_t dnnl_post_ops_append_binary_v2(post_ops_t *post_ops,
+        alg_kind_t alg_kind, const memory_desc_t *user_src1_desc,
+        const memory_desc_t *user_src2_desc) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_binary(alg_kind, user_src1_desc, user_src2_desc);
+}
+
 status_t dnnl_post_ops_get_params_binary(const post_ops_t *post_ops, int index,
         alg_kind_t *alg_kind, const memory_desc_t **user_src1_desc) {
+    return dnnl_post_ops_get_params_binary_v2(
+            post_ops, index, alg_kind, user_src1_desc, nullptr);
+}
+
+status_t dnnl_post_ops_get_params_binary_v2(const post_ops_t *post_ops,
+        int index, alg_kind_t *alg_kind, const memory_desc_t **user_src1_desc,
+        const memory_desc_t **user_src2_desc) {
     if (!simple_get_params_check(post_ops, index, primitive_kind::binary))
         return invalid_arguments;
 
     const auto &b = post_ops->entry_[index].binary;
     if (alg_kind) *alg_kind = b.alg;
     if (user_src1_desc) *user_src1_desc = &b.user_src1_desc;
+    if (user_src2_desc) *user_src2_desc = &b.user_src2_desc;
 
     return success;
 }
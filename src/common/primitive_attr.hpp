@@ -409,6 +409,10 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             // and tag of md in case user passed format_kind::any. To be used
             // everywhere internally.
             dnnl::impl::memory_desc_t src1_desc;
+            // Same pair of memory descriptors for the condition of
+            // binary_select. Zero memory descriptors for other algorithms.
+            dnnl::impl::memory_desc_t user_src2_desc;
+            dnnl::impl::memory_desc_t src2_desc;
         };
 
         struct prelu_t {
@@ -502,7 +506,9 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 case primitive_kind::binary:
                     ret = binary.alg == rhs.binary.alg
                             && binary.user_src1_desc
-                                    == rhs.binary.user_src1_desc;
+                                    == rhs.binary.user_src1_desc
+                            && binary.user_src2_desc
+                                    == rhs.binary.user_src2_desc;
                     break;
                 case primitive_kind::prelu:
                     ret = prelu.mask == rhs.prelu.mask;
@@ -538,11 +544,13 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             dnnl::impl::dim_t kernel_size, dnnl::impl::dim_t stride_size,
             dnnl::impl::dim_t padding_l_size);
     dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
-            const dnnl::impl::memory_desc_t *user_src1_desc);
+            const dnnl::impl::memory_desc_t *user_src1_desc,
+            const dnnl::impl::memory_desc_t *user_src2_desc = nullptr);
     dnnl::impl::status_t append_prelu(int mask);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
-            const dnnl::impl::memory_desc_t *user_src1_desc);
+            const dnnl::impl::memory_desc_t *user_src1_desc,
+            const dnnl::impl::memory_desc_t *user_src2_desc = nullptr);
 
     int find(dnnl::impl::primitive_kind_t kind, int start = 0,
             int stop = -1) const {
@@ -630,7 +638,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
 private:
     dnnl::impl::status_t validate_binary(dnnl::impl::alg_kind_t alg,
-            const dnnl::impl::memory_desc_t *user_src1_desc) const;
+            const dnnl::impl::memory_desc_t *user_src1_desc,
+            const dnnl::impl::memory_desc_t *user_src2_desc) const;
 
     bool check_sum_consistent_dt(const dnnl::impl::data_type_t dst_dt,
             const bool diverse_sum_dt_allowed = false) const;
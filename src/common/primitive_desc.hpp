@@ -38,7 +38,12 @@ namespace impl {
 static int po_inputs(const post_ops_t &post_ops, const primitive_kind_t kind) {
     int n_inputs = 0;
     for (int idx = 0; idx < post_ops.len(); ++idx) {
-        if (post_ops.contain(kind, idx)) n_inputs++;
+        if (!post_ops.contain(kind, idx)) continue;
+        n_inputs++;
+        // The select post-op takes its condition as one more input.
+        const auto &e = post_ops.entry_[idx];
+        if (e.is_binary() && e.binary.alg == alg_kind::binary_select)
+            n_inputs++;
     }
     return n_inputs;
 }
@@ -171,6 +176,11 @@ struct primitive_desc_t : public c_compatible {
                     || post_op_has_proper_input(
                             attr(), prelu, idx, arg, DNNL_ARG_WEIGHTS))
                 return arg_usage_t::input;
+            if (post_op_has_proper_input(
+                        attr(), binary, idx, arg, DNNL_ARG_SRC_2)
+                    && attr()->post_ops_.entry_[idx].binary.alg
+                            == alg_kind::binary_select)
+                return arg_usage_t::input;
         }
 
         return arg_usage_t::unused;
@@ -186,11 +196,13 @@ struct primitive_desc_t : public c_compatible {
             const auto &po = attr()->post_ops_;
             for (int idx = 0; idx < po.len(); ++idx) {
                 if (arg
-                        != (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                        == (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
                                 | DNNL_ARG_SRC_1))
-                    continue;
-
-                return &po.entry_[idx].binary.src1_desc;
+                    return &po.entry_[idx].binary.src1_desc;
+                if (arg
+                        == (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                                | DNNL_ARG_SRC_2))
+                    return &po.entry_[idx].binary.src2_desc;
             }
         }
 
@@ -69,6 +69,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(convolution)
             CASE(deconvolution)
             CASE(eltwise)
+            CASE(gather)
             CASE(gemm)
             CASE(group_normalization)
             CASE(inner_product)
@@ -81,10 +82,13 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(reorder)
             CASE(resampling)
             CASE(rnn)
+            CASE(rope)
             CASE(shuffle)
             CASE(softmax)
             CASE(sum)
+            CASE(topk)
             CASE(zero_pad)
+            CASE(sdpa)
             default: assert(!"unknown primitive kind");
         }
 #undef CASE
@@ -163,6 +167,9 @@ size_t get_md_hash(const memory_desc_t &md) {
             seed = get_array_hash(seed,
                     md.format_desc.sparse_desc.metadata_types,
                     sparse_desc_t::max_metadata_types);
+            seed = get_array_hash(seed, md.format_desc.sparse_desc.block_dims,
+                    md.ndims);
+            seed = hash_combine(seed, md.format_desc.sparse_desc.ngroups);
             break;
 #endif
         default: assert(!"unknown format_kind");
@@ -256,6 +263,8 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                         seed, static_cast<size_t>(entry.binary.alg));
                 seed = hash_combine(
                         seed, get_md_hash(entry.binary.user_src1_desc));
+                seed = hash_combine(
+                        seed, get_md_hash(entry.binary.user_src2_desc));
                 break;
             case primitive_kind::prelu:
                 seed = hash_combine(
@@ -329,6 +338,7 @@ size_t get_desc_hash(const binary_desc_t &desc) {
     // Memory descriptors
     seed = hash_combine(seed, get_md_hash(desc.src_desc[0]));
     seed = hash_combine(seed, get_md_hash(desc.src_desc[1]));
+    seed = hash_combine(seed, get_md_hash(desc.src_desc[2]));
     seed = hash_combine(seed, get_md_hash(desc.dst_desc));
     // Combined hash for binary op desc
     return seed;
@@ -380,6 +390,20 @@ size_t get_desc_hash(const eltwise_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const gather_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    seed = hash_combine(seed, get_md_hash(desc.offsets_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    // Combined hash for gather desc
+    return seed;
+}
+
 size_t get_desc_hash(const gemm_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -623,6 +647,39 @@ size_t get_desc_hash(const rnn_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const rope_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.cos_sin_desc));
+    // Axis, theta
+    seed = hash_combine(seed, desc.axis);
+    seed = hash_combine(seed, desc.theta);
+    // Combined hash for rope desc
+    return seed;
+}
+
+size_t get_desc_hash(const sdpa_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.q_desc));
+    seed = hash_combine(seed, get_md_hash(desc.k_desc));
+    seed = hash_combine(seed, get_md_hash(desc.v_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.attn_mask_desc));
+    // Scale type
+    seed = hash_combine(seed, static_cast<size_t>(desc.scale_dt));
+    seed = hash_combine(seed, desc.invert_scale);
+    // Combined hash for sdpa desc
+    return seed;
+}
+
 // Shuffle
 size_t get_desc_hash(const shuffle_desc_t &desc) {
     size_t seed = 0;
@@ -673,6 +730,22 @@ size_t get_desc_hash(const sum_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const topk_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.indices_desc));
+    // Axis, k
+    seed = hash_combine(seed, desc.axis);
+    seed = hash_combine(seed, desc.k);
+    // Combined hash for topk desc
+    return seed;
+}
+
 size_t get_desc_hash(const zero_pad_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -0,0 +1,134 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_ROPE_PD_HPP
+#define COMMON_ROPE_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_ROPE(cond, msg, ...) \
+    VCONDCHECK(create, dispatch, rope, (cond), status::unimplemented, \
+            "%s," msg, this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+status_t rope_desc_init(rope_desc_t *rope_desc, alg_kind_t alg_kind,
+        const memory_desc_t *src_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *cos_sin_desc, int axis, float theta);
+
+struct rope_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::rope;
+
+    typedef rope_pd_t hint_class;
+
+    const rope_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::axis_s32: *(int *)result = desc()->axis; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC:
+            case DNNL_ARG_SRC_1: return arg_usage_t::input;
+            case DNNL_ARG_DST: return arg_usage_t::output;
+            default: return primitive_desc_t::arg_usage(arg);
+        }
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0);
+            case DNNL_ARG_SRC_1: return src_md(1);
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        switch (index) {
+            case 0: return &desc_.src_desc;
+            case 1: return &desc_.cos_sin_desc;
+            default: return &glob_zero_md;
+        }
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *cos_sin_md() const { return src_md(1); }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 1; }
+
+    int axis() const { return desc_.axis; }
+    int ndims() const { return desc_.src_desc.ndims; }
+    // The number of positions and the size of a rotated row.
+    dim_t seq_len() const { return desc_.src_desc.dims[axis()]; }
+    dim_t row_size() const { return desc_.src_desc.dims[ndims() - 1]; }
+    bool is_interleaved() const {
+        return desc_.alg_kind == alg_kind::rope_interleaved;
+    }
+    // Angles are computed from positions instead of read from a table.
+    bool with_positions() const {
+        return desc_.cos_sin_desc.data_type == data_type::s32;
+    }
+
+    bool has_zero_dim_memory() const {
+        return memory_desc_wrapper(desc_.src_desc).has_zero_dim();
+    }
+
+protected:
+    rope_desc_t desc_;
+
+    memory_desc_t dst_md_;
+
+    rope_pd_t(const rope_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , dst_md_(desc_.dst_desc) {}
+
+    // The destination inherits the layout of the source.
+    status_t set_default_params() {
+        if (dst_md_.format_kind != format_kind::any) return status::success;
+        return memory_desc_init_by_blocking_desc(
+                dst_md_, desc_.src_desc.format_desc.blocking);
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,74 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SDPA_TYPES_HPP
+#define COMMON_SDPA_TYPES_HPP
+
+#include <assert.h>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+
+namespace dnnl {
+namespace impl {
+
+#define DNNL_ARG_QUERIES DNNL_ARG_SRC_0
+#define DNNL_ARG_KEYS DNNL_ARG_SRC_1
+#define DNNL_ARG_VALUES DNNL_ARG_SRC_2
+#define DNNL_ARG_ATTN_MASK DNNL_ARG_SHIFT
+
+// A descriptor for a scaled dot-product attention (SDPA) operation:
+//     dst = softmax(scale(Q * K) + attn_mask) * V
+// Keys are expected in a [..., head_size, keys] logical shape, i.e. as the
+// weights of the first matrix multiplication.
+struct sdpa_desc_t {
+    // The kind of primitive. Used for self identifying the primitive
+    // descriptor. Must be primitive_kind::sdpa.
+    primitive_kind_t primitive_kind;
+    memory_desc_t q_desc; /* queries */
+    memory_desc_t k_desc; /* keys */
+    memory_desc_t v_desc; /* values */
+    memory_desc_t dst_desc;
+    // Optional additive mask, broadcastable to [..., queries, keys].
+    memory_desc_t attn_mask_desc;
+    // Data type of the scale passed as DNNL_ARG_SCALE. Undefined data type
+    // means no scaling is applied.
+    data_type_t scale_dt;
+    // invert_scale = false: multiply by scale
+    // invert_scale = true:  divide by scale
+    bool invert_scale;
+
+    // Number of queries.
+    dnnl_dim_t queries() const { return q_desc.dims[q_desc.ndims - 2]; }
+    // Head size.
+    dnnl_dim_t head_size() const { return q_desc.dims[q_desc.ndims - 1]; }
+    // Number of keys.
+    dnnl_dim_t keys() const { return k_desc.dims[k_desc.ndims - 1]; }
+    // Number of values.
+    dnnl_dim_t values() const { return v_desc.dims[v_desc.ndims - 1]; }
+    // Total batch size.
+    dnnl_dim_t batch_size() const {
+        dnnl_dim_t batch = 1;
+        for (int i = 0; i < dst_desc.ndims - 2; i++)
+            batch *= dst_desc.dims[i];
+        return batch;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
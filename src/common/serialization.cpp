@@ -36,6 +36,7 @@ status_t serialize_desc(
         CASE(convolution)
         CASE(deconvolution)
         CASE(eltwise)
+        CASE(gather)
         CASE(gemm)
         CASE(group_normalization)
         CASE(inner_product)
@@ -48,9 +49,12 @@ status_t serialize_desc(
         CASE(reorder)
         CASE(resampling)
         CASE(rnn)
+        CASE(rope)
+        CASE(sdpa)
         CASE(shuffle)
         CASE(softmax)
         CASE(sum)
+        CASE(topk)
         default: return status::invalid_arguments;
     }
 #undef CASE
@@ -158,6 +162,7 @@ void serialize_post_ops(
             case primitive_kind::binary:
                 sstream.write(&entry.binary.alg);
                 serialize_md(sstream, entry.binary.user_src1_desc);
+                serialize_md(sstream, entry.binary.user_src2_desc);
                 break;
             case primitive_kind::prelu: sstream.write(&entry.prelu.mask); break;
             default: assert(!"unknown post_op");
@@ -230,6 +235,44 @@ void serialize_desc(
         serialize_md(sstream, *desc.src_mds[i]);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const topk_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.indices_desc);
+    // Axis, k
+    sstream.write(&desc.axis);
+    sstream.write(&desc.k);
+}
+
+void serialize_desc(
+        serialization_stream_t &sstream, const gather_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.indices_desc);
+    serialize_md(sstream, desc.offsets_desc);
+    serialize_md(sstream, desc.dst_desc);
+}
+
+void serialize_desc(serialization_stream_t &sstream, const rope_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.cos_sin_desc);
+    // Axis, theta
+    sstream.write(&desc.axis);
+    sstream.write(&desc.theta);
+}
+
 void serialize_desc(serialization_stream_t &sstream,
         const batch_normalization_desc_t &desc) {
     // Kinds
@@ -257,6 +300,7 @@ void serialize_desc(
     // Memory descriptors
     serialize_md(sstream, desc.src_desc[0]);
     serialize_md(sstream, desc.src_desc[1]);
+    serialize_md(sstream, desc.src_desc[2]);
     serialize_md(sstream, desc.dst_desc);
 }
 
@@ -517,6 +561,20 @@ void serialize_desc(serialization_stream_t &sstream, const rnn_desc_t &desc) {
     sstream.write(&desc.beta);
 }
 
+void serialize_desc(serialization_stream_t &sstream, const sdpa_desc_t &desc) {
+    // Kind
+    sstream.write(&desc.primitive_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.q_desc);
+    serialize_md(sstream, desc.k_desc);
+    serialize_md(sstream, desc.v_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.attn_mask_desc);
+    // Scale
+    sstream.write(&desc.scale_dt);
+    sstream.write(&desc.invert_scale);
+}
+
 // Shuffle
 void serialize_desc(
         serialization_stream_t &sstream, const shuffle_desc_t &desc) {
@@ -236,11 +236,14 @@ inline bool rnn_packed_desc_is_equal(
 
 inline bool sparse_desc_is_equal(
         const sparse_desc_t &lhs, const sparse_desc_t &rhs) {
-    bool ok = lhs.encoding == rhs.encoding && lhs.nnz == rhs.nnz;
+    bool ok = lhs.encoding == rhs.encoding && lhs.nnz == rhs.nnz
+            && lhs.ngroups == rhs.ngroups;
     if (!ok) return false;
 
     for (int i = 0; i < sparse_desc_t::max_metadata_types; i++)
         ok = ok && lhs.metadata_types[i] == rhs.metadata_types[i];
+    for (int d = 0; d < DNNL_MAX_NDIMS; d++)
+        ok = ok && lhs.block_dims[d] == rhs.block_dims[d];
 
     return ok;
 }
@@ -444,6 +447,7 @@ inline bool operator==(const binary_desc_t &lhs, const binary_desc_t &rhs) {
             && COMPARE_DESC_MEMBERS(alg_kind)
             && COMPARE_DESC_MEMBERS(src_desc[0])
             && COMPARE_DESC_MEMBERS(src_desc[1])
+            && COMPARE_DESC_MEMBERS(src_desc[2])
             && COMPARE_DESC_MEMBERS(dst_desc);
     return ret;
 }
@@ -497,6 +501,16 @@ inline bool operator==(const eltwise_desc_t &lhs, const eltwise_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const gather_desc_t &lhs, const gather_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(offsets_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc);
+    return ret;
+}
+
 inline bool operator==(const gemm_desc_t &lhs, const gemm_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(a_desc)
@@ -624,6 +638,18 @@ inline bool operator==(
     return ret;
 }
 
+inline bool operator==(const sdpa_desc_t &lhs, const sdpa_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(q_desc)
+            && COMPARE_DESC_MEMBERS(k_desc)
+            && COMPARE_DESC_MEMBERS(v_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(attn_mask_desc)
+            && COMPARE_DESC_MEMBERS(scale_dt)
+            && COMPARE_DESC_MEMBERS(invert_scale);
+    return ret;
+}
+
 inline bool operator==(const reorder_desc_t &lhs, const reorder_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(src_md)
@@ -680,6 +706,17 @@ inline bool operator==(const rnn_desc_t &lhs, const rnn_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const rope_desc_t &lhs, const rope_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(cos_sin_desc)
+            && COMPARE_DESC_MEMBERS(axis)
+            && COMPARE_FLOAT_DESC_MEMBERS(theta);
+    return ret;
+}
+
 inline bool operator==(const shuffle_desc_t &lhs, const shuffle_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && COMPARE_DESC_MEMBERS(prop_kind)
@@ -723,6 +760,17 @@ inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(const topk_desc_t &lhs, const topk_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(indices_desc)
+            && COMPARE_DESC_MEMBERS(axis)
+            && COMPARE_DESC_MEMBERS(k);
+    return ret;
+}
+
 inline bool operator==(const zero_pad_desc_t &lhs, const zero_pad_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind);
     return ret;
@@ -998,6 +1046,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(convolution);
         CASE_OP_DESC(deconvolution);
         CASE_OP_DESC(eltwise);
+        CASE_OP_DESC(gather);
         CASE_OP_DESC(gemm);
         CASE_OP_DESC(group_normalization);
         CASE_OP_DESC(inner_product);
@@ -1009,11 +1058,14 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(reduction);
         CASE_OP_DESC(resampling);
         CASE_OP_DESC(rnn);
+        CASE_OP_DESC(rope);
         CASE_OP_DESC(shuffle);
         CASE_OP_DESC(softmax);
+        CASE_OP_DESC(topk);
 
         // Internal descs
         CASE_OP_DESC(zero_pad);
+        CASE_OP_DESC(sdpa);
         default: assert(!"unknown C primitive kind");
     }
 #undef CASE_OP_DESC
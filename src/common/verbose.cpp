@@ -40,6 +40,7 @@
 #include "convolution_pd.hpp"
 #include "deconvolution_pd.hpp"
 #include "eltwise_pd.hpp"
+#include "gather_pd.hpp"
 #include "gemm_pd.hpp"
 #include "group_normalization_pd.hpp"
 #include "inner_product_pd.hpp"
@@ -52,9 +53,12 @@
 #include "reorder_pd.hpp"
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
+#include "rope_pd.hpp"
+#include "sdpa_pd.hpp"
 #include "shuffle_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
+#include "topk_pd.hpp"
 
 #if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
 #include "common/dnnl_thread.hpp"
@@ -213,6 +217,7 @@ std::ostream &operator<<(std::ostream &ss, const engine_t *engine) {
 const char *prim_kind2str(primitive_kind_t prim_kind) {
     switch ((int)prim_kind) {
         case primitive_kind::zero_pad: return "zero_pad";
+        case primitive_kind::sdpa: return "sdpa";
         default: return dnnl_prim_kind2str(prim_kind);
     }
 }
@@ -256,6 +261,8 @@ std::string normalization_flags2str(unsigned flags) {
     if (flags & normalization_flags::use_shift) s += "H";
     if (flags & normalization_flags::fuse_norm_relu) s += "R";
     if (flags & normalization_flags::fuse_norm_add_relu) s += "A";
+    if (flags & normalization_flags::rms_norm) s += "M";
+    if (flags & normalization_flags::fuse_residual_add) s += "S";
     return s;
 }
 
@@ -610,6 +617,13 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                         case format_kind::any: ss << ":any"; break;
                         default: assert(!"unsupported format_kind");
                     }
+                    if (eb.alg == alg_kind::binary_select) {
+                        const auto &md2 = eb.src2_desc;
+                        int mask2 = 0;
+                        for (int d = 0; d < md2.ndims; ++d)
+                            mask2 += md2.dims[d] != 1 ? (1 << d) : 0;
+                        ss << ":" << md2.data_type << ":" << mask2;
+                    }
                 } break;
                 case primitive_kind::prelu: {
                     const auto &ep = e.prelu;
@@ -666,11 +680,17 @@ std::string init_info_binary(const engine_t *e, const pd_t *pd) {
 
     ss << "src_" << md2fmt_str(src0_md, pd->invariant_src_user_format_kind(0));
     ss << " src_" << md2fmt_str(src1_md, pd->invariant_src_user_format_kind(1));
+    if (pd->is_select()) {
+        auto src2_md = pd->invariant_src_md(2);
+        ss << " src_"
+           << md2fmt_str(src2_md, pd->invariant_src_user_format_kind(2));
+    }
     ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
 
     ss << "," << pd->attr() << ",";
     ss << "alg:" << pd->desc()->alg_kind << ",";
     ss << md2dim_str(src0_md) << ":" << md2dim_str(src1_md);
+    if (pd->is_select()) ss << ":" << md2dim_str(pd->invariant_src_md(2));
 
     return ss.str();
 }
@@ -1063,6 +1083,105 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_topk(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto dst_md = pd->invariant_dst_md();
+    auto idx_md = pd->indices_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+    ss << " idx_" << md2fmt_str(idx_md, format_kind::undef);
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->desc()->axis
+       << " k:" << pd->desc()->k << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_gather(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto idx_md = pd->indices_md();
+    auto off_md = pd->offsets_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << " idx_" << md2fmt_str(idx_md, format_kind::undef);
+    if (pd->with_bags())
+        ss << " off_" << md2fmt_str(off_md, format_kind::undef);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << ",";
+    ss << md2dim_str(src_md) << ":" << md2dim_str(idx_md);
+    if (pd->with_bags()) ss << ":" << md2dim_str(off_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_rope(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->invariant_src_md();
+    auto cs_md = pd->cos_sin_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "src_" << md2fmt_str(src_md, pd->invariant_src_user_format_kind());
+    ss << (pd->with_positions() ? " pos_" : " cs_")
+       << md2fmt_str(cs_md, format_kind::undef);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    ss << "alg:" << pd->desc()->alg_kind << " axis:" << pd->desc()->axis;
+    if (pd->with_positions()) ss << " theta:" << pd->desc()->theta;
+    ss << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
+template <typename pd_t>
+std::string init_info_sdpa(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto q_md = pd->qry_md();
+    auto k_md = pd->key_md();
+    auto v_md = pd->val_md();
+    auto dst_md = pd->invariant_dst_md();
+
+    ss << "query_" << md2fmt_str(q_md, format_kind::undef);
+    ss << " key_" << md2fmt_str(k_md, format_kind::undef);
+    ss << " val_" << md2fmt_str(v_md, format_kind::undef);
+    if (pd->with_attn_mask())
+        ss << " msk_" << md2fmt_str(pd->attn_mask_md(), format_kind::undef);
+    ss << " dst_" << md2fmt_str(dst_md, pd->invariant_dst_user_format_kind());
+
+    ss << "," << pd->attr() << ",";
+    if (pd->with_attn_scale())
+        ss << "scale:" << pd->desc()->scale_dt
+           << (pd->desc()->invert_scale ? ":div" : ":mul");
+    ss << "," << md2dim_str(q_md) << ":" << md2dim_str(k_md) << ":"
+       << md2dim_str(v_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1281,7 +1400,12 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::gather:
+        case primitive_kind::rope:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1313,7 +1437,12 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
-        case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
+        case primitive_kind::sum:
+        case primitive_kind::topk:
+        case primitive_kind::gather:
+        case primitive_kind::rope:
+            assert(!"unsupported primitive kind");
+            break;
         default: assert(!"unknown primitive kind");
     }
     return s;
@@ -1336,6 +1465,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(convolution);
             CASE(deconvolution);
             CASE(eltwise);
+            CASE(gather);
             CASE(gemm);
             CASE(group_normalization);
             CASE(inner_product);
@@ -1348,9 +1478,12 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(reorder);
             CASE(resampling);
             CASE(rnn);
+            CASE(rope);
+            CASE(sdpa);
             CASE(shuffle);
             CASE(softmax);
             CASE(sum);
+            CASE(topk);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
               break;
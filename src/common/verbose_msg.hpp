@@ -72,6 +72,7 @@
 #define VERBOSE_UNSUPPORTED_SCALES_CFG "unsupported scales configuration"
 #define VERBOSE_UNSUPPORTED_ZP_CFG "unsupported zero-point configuration"
 #define VERBOSE_UNSUPPORTED_BIAS_CFG "unsupported bias configuration"
+#define VERBOSE_UNSUPPORTED_SPARSE_CFG "unsupported sparse md configuration"
 #define VERBOSE_UNSUPPORTED_DT_CFG "unsupported datatype combination"
 
 #define VERBOSE_UNSUPPORTED_TAG "unsupported format tag"
@@ -81,6 +82,8 @@
     "datatype configuration not supported on this isa"
 #define VERBOSE_BLOCKING_FAIL "blocking heuristic failed"
 #define VERBOSE_SMALL_SHAPES "small shapes fall back"
+#define VERBOSE_LARGE_SHAPES "large shapes fall back"
+#define VERBOSE_GEMV_SHAPES "gemv shapes fall back"
 #define VERBOSE_NONTRIVIAL_STRIDE "only trivial strides are supported"
 
 #endif
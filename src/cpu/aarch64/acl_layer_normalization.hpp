@@ -86,6 +86,10 @@ struct acl_layer_normalization_fwd_t : public primitive_t {
                     "are provided (use global stats)");
             ACL_CHECK_SUPPORT(use_scale() || use_shift(),
                     "ACL does not support lnorm scale and shift");
+            ACL_CHECK_SUPPORT(
+                    skip_mean(), "ACL does not support RMS normalization");
+            ACL_CHECK_SUPPORT(fuse_residual_add(),
+                    "ACL does not support residual add fusion");
 
             // attr-scales
             ACL_CHECK_SUPPORT(!attr()->has_default_values(),
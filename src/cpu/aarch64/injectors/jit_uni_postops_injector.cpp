@@ -37,8 +37,9 @@ bool is_supported(const post_ops_ok_args_t &post_ops_ok_args) {
             if (!res) return false;
         } else if (post_op.is_binary()) {
             const auto &src1_desc = post_op.binary.src1_desc;
-            const auto res = binary_injector::is_supported(
-                    isa, src1_desc, *dst_d, enabled_bcast_strategy);
+            const auto res = post_op.binary.alg != alg_kind::binary_select
+                    && binary_injector::is_supported(
+                            isa, src1_desc, *dst_d, enabled_bcast_strategy);
             if (!res) return false;
         }
     }
@@ -245,9 +246,11 @@ bool post_ops_ok(const post_ops_ok_args_t &post_ops_ok_args) {
                 case binary:
                     if (entry.is_binary()) {
                         assert(dst_d != nullptr && "dst_d is null");
-                        return binary_injector::is_supported(isa,
-                                entry.binary.src1_desc, *dst_d,
-                                enabled_bcast_strategy);
+                        // No binary select support on aarch64.
+                        return entry.binary.alg != alg_kind::binary_select
+                                && binary_injector::is_supported(isa,
+                                        entry.binary.src1_desc, *dst_d,
+                                        enabled_bcast_strategy);
                     }
                     break;
                 default: assert(false && "Unhandled post_op type");
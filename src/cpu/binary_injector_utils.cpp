@@ -33,6 +33,12 @@ std::vector<const void *> prepare_binary_args(const post_ops_t &post_ops,
         if (post_op.is_binary()) {
             post_ops_binary_rhs_arg_vec.emplace_back(CTX_IN_MEM(const void *,
                     DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1));
+            // The condition of binary select follows its src1.
+            if (post_op.binary.alg == alg_kind::binary_select)
+                post_ops_binary_rhs_arg_vec.emplace_back(
+                        CTX_IN_MEM(const void *,
+                                DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                                        | DNNL_ARG_SRC_2));
         }
 #if DNNL_X64
         else if (post_op.is_prelu()) {
@@ -732,6 +732,23 @@ const std::map<pk_dt_impl_key_t, std::vector<impl_list_item_t>> &impl_list_map()
     });
     return the_map;
 }
+
+// Only the brgemm based forward implementation supports a runtime minibatch.
+const std::vector<impl_list_item_t> &runtime_mb_impl_list() {
+    static const std::vector<impl_list_item_t> the_list = REG_CONV_P({
+        CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx_fp16>)
+        CPU_INSTANCE_AMX(brgemm_convolution_fwd_t<avx512_core_amx>)
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_fp16>)
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_bf16>)
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core_vnni>)
+        CPU_INSTANCE_AVX512(brgemm_convolution_fwd_t<avx512_core>)
+        CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni_2>)
+        CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2_vnni>)
+        CPU_INSTANCE_AVX2(brgemm_convolution_fwd_t<avx2>)
+        nullptr,
+    });
+    return the_list;
+}
 // clang-format on
 } // namespace
 
@@ -741,6 +758,10 @@ const impl_list_item_t *get_convolution_impl_list(
 
     const bool is_fwd = utils::one_of(
             desc->prop_kind, forward_training, forward_inference);
+    if (is_fwd
+            && memory_desc_wrapper(desc->src_desc).has_runtime_dims_or_strides())
+        return runtime_mb_impl_list().empty() ? empty_list
+                                              : runtime_mb_impl_list().data();
     prop_kind_t prop_kind = is_fwd ? forward : desc->prop_kind;
 
     pk_dt_impl_key_t key {
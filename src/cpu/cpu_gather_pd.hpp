@@ -0,0 +1,46 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_GATHER_PD_HPP
+#define CPU_CPU_GATHER_PD_HPP
+
+#include "common/gather_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_gather_pd_t : public gather_pd_t {
+    using gather_pd_t::gather_pd_t;
+
+protected:
+    // Indices and offsets are dense one-dimensional arrays.
+    bool index_mds_ok() const {
+        for (auto md : {indices_md(), offsets_md()}) {
+            if (md->ndims == 0) continue;
+            const memory_desc_wrapper mdw(md);
+            if (!mdw.is_dense() || mdw.blocking_desc().strides[0] != 1)
+                return false;
+        }
+        return true;
+    }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
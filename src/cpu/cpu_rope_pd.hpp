@@ -0,0 +1,42 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_CPU_ROPE_PD_HPP
+#define CPU_CPU_ROPE_PD_HPP
+
+#include <cmath>
+
+#include "common/rope_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct cpu_rope_pd_t : public rope_pd_t {
+    using rope_pd_t::rope_pd_t;
+};
+
+// Returns the angle of the i-th pair of a row of d elements at position pos.
+inline float rope_angle(dim_t pos, dim_t i, dim_t d, float theta) {
+    return static_cast<float>(pos)
+            * std::pow(theta, -2.f * static_cast<float>(i) / d);
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -15,6 +15,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <atomic>
+
 #include "oneapi/dnnl/dnnl.h"
 
 #include "common/bfloat16.hpp"
@@ -323,6 +325,132 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
             transa, transb, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+float *get_f16_gemm_cvt_buffer(size_t nelems) {
+    struct buffer_t {
+        ~buffer_t() { impl::free(ptr); }
+        float *ptr = nullptr;
+        size_t nelems = 0;
+    };
+    // Like the global scratchpad, the buffer is kept per thread, so that
+    // concurrent calls from different threads never share it.
+    static thread_local buffer_t buf;
+
+    nelems = nstl::max(nelems, size_t(1));
+    if (nelems > buf.nelems) {
+        impl::free(buf.ptr);
+        buf.ptr = (float *)impl::malloc(sizeof(float) * nelems, 64);
+        buf.nelems = buf.ptr ? nelems : 0;
+    }
+    return buf.ptr;
+}
+
+dnnl_status_t cvt_f16_gemm_operand_block(bool is_a, char trans, dim_t M,
+        dim_t N, dim_t k_start, dim_t k_size, const float16_t *src, dim_t ld,
+        float *dst, dim_t &ld_dst) {
+    const bool is_trans = utils::one_of(trans, 'T', 't');
+    const dim_t mn = is_a ? M : N;
+    // K is the contiguous dimension of transposed A and non-transposed B.
+    const bool is_k_contiguous = is_a == is_trans;
+    const dim_t nrows = is_k_contiguous ? k_start + k_size : mn;
+    if (src == nullptr || ld < nstl::max(dim_t(1), nrows))
+        return dnnl_invalid_arguments;
+
+    if (is_k_contiguous) {
+        ld_dst = nstl::max(dim_t(1), k_size);
+        parallel_nd(mn, [&](dim_t j) {
+            cvt_float16_to_float(
+                    dst + j * k_size, src + j * ld + k_start, k_size);
+        });
+    } else {
+        ld_dst = nstl::max(dim_t(1), mn);
+        parallel_nd(k_size, [&](dim_t j) {
+            cvt_float16_to_float(dst + j * mn, src + (k_start + j) * ld, mn);
+        });
+    }
+    return dnnl_success;
+}
+
+dnnl_status_t gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc) {
+    dnnl_status_t status = check_gemm_input(transa, transb, M, N, K, A, lda, B,
+            ldb, C, ldc, alpha, beta, false);
+    if (status != dnnl_success) return status;
+    // Packed matrices go through gemm_f16f16f32_compute().
+    if (utils::one_of(*transa, 'P', 'p') || utils::one_of(*transb, 'P', 'p'))
+        return dnnl_invalid_arguments;
+
+    // The problem is split along K and only the panels of A and B of the
+    // current K block are converted, right before the f32 gemm uses them.
+    // The converted panels stay in cache and the buffer size is bounded.
+    const dim_t max_block_nelems = 1 << 16;
+    const dim_t mn = *M + *N;
+    dim_t k_blk = max_block_nelems / nstl::max(dim_t(1), mn);
+    k_blk = nstl::max(dim_t(1), nstl::min(*K, nstl::max(dim_t(256), k_blk)));
+
+    float *buf = get_f16_gemm_cvt_buffer(mn * k_blk);
+    if (buf == nullptr) return dnnl_out_of_memory;
+    float *A_blk = buf, *B_blk = buf + *M * k_blk;
+
+    for (dim_t k_start = 0; k_start == 0 || k_start < *K; k_start += k_blk) {
+        const dim_t k_size = nstl::min(k_blk, *K - k_start);
+        dim_t lda_blk = 0, ldb_blk = 0;
+        CHECK(cvt_f16_gemm_operand_block(true, *transa, *M, *N, k_start,
+                k_size, A, *lda, A_blk, lda_blk));
+        CHECK(cvt_f16_gemm_operand_block(false, *transb, *M, *N, k_start,
+                k_size, B, *ldb, B_blk, ldb_blk));
+
+        const float beta_blk = k_start == 0 ? *beta : 1.f;
+        CHECK(extended_sgemm(transa, transb, M, N, &k_size, alpha, A_blk,
+                &lda_blk, B_blk, &ldb_blk, &beta_blk, C, ldc));
+    }
+    return dnnl_success;
+}
+
+dnnl_status_t gemm_batch(dim_t batch, dim_t M, dim_t N, dim_t K,
+        const std::function<dnnl_status_t(dim_t)> &gemm_exec) {
+    if (batch < 0) return dnnl_invalid_arguments;
+    if (batch == 0) return dnnl_success;
+
+    const int nthr = dnnl_get_current_num_threads();
+
+    // A problem is considered small when every thread would get less than
+    // a 64x64x64 block of work out of it. The gemm driver cannot amortize
+    // the threading overhead on such a split, while executing the whole
+    // problem on a single thread keeps all its data in that thread's cache.
+    // The batch is also distributed when it is evenly divisible between the
+    // threads, since no thread stays idle in that case.
+    const dim_t small_work_per_thr = 64 * 64 * 64;
+    const bool is_small = (double)M * N * K < (double)small_work_per_thr * nthr;
+    const bool parallel_over_batch
+            = nthr > 1 && batch > 1 && (is_small || batch % nthr == 0);
+
+    if (!parallel_over_batch) {
+        for (dim_t i = 0; i < batch; i++) {
+            dnnl_status_t st = gemm_exec(i);
+            if (st != dnnl_success) return st;
+        }
+        return dnnl_success;
+    }
+
+    // Nested gemm calls detect the parallel region and stay single-threaded.
+    std::atomic<dnnl_status_t> st(dnnl_success);
+    const int nthr_batch = (int)nstl::min<dim_t>(nthr, batch);
+    parallel(nthr_batch, [&](int ithr, int nthr_par) {
+        dim_t start {0}, end {0};
+        balance211(batch, nthr_par, ithr, start, end);
+        for (dim_t i = start; i < end; i++) {
+            dnnl_status_t st_thr = gemm_exec(i);
+            if (st_thr != dnnl_success) {
+                st = st_thr;
+                return;
+            }
+        }
+    });
+    return st;
+}
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -18,9 +18,12 @@
 #ifndef CPU_GEMM_GEMM_HPP
 #define CPU_GEMM_GEMM_HPP
 
+#include <functional>
+
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/bfloat16.hpp"
+#include "common/float16.hpp"
 
 #include "cpu/platform.hpp"
 
@@ -69,6 +72,35 @@ dnnl_status_t gemm_bf16bf16f32(const char *transa, const char *transb,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// There are no native f16 gemm kernels, so the f16 inputs are converted to f32
+// and the problem is computed by the f32 gemm.
+dnnl_status_t gemm_f16f16f32(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const float *alpha,
+        const float16_t *A, const dim_t *lda, const float16_t *B,
+        const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
+
+// Converts the block [k_start, k_start + k_size) along K of the f16 operand
+// A (if `is_a` is true) or B of a column-major MxNxK gemm to f32. The block
+// is stored densely into `dst`, which must hold (is_a ? M : N) * k_size
+// elements, and `ld_dst` is set to its leading dimension.
+dnnl_status_t cvt_f16_gemm_operand_block(bool is_a, char trans, dim_t M,
+        dim_t N, dim_t k_start, dim_t k_size, const float16_t *src, dim_t ld,
+        float *dst, dim_t &ld_dst);
+
+// Returns a buffer of at least `nelems` floats for the converted f16 gemm
+// operands. The buffer belongs to the calling thread and is reused by the
+// following calls on that thread, so it is valid until the next call only.
+float *get_f16_gemm_cvt_buffer(size_t nelems);
+
+// Executes a batch of independent problems of the same MxNxK size by calling
+// `gemm_exec(i)` for every problem `i` in the batch. Problems that are too
+// small to be split efficiently between all the threads are distributed
+// across the threads as a whole, so each of them runs single-threaded.
+// Otherwise, the problems are executed one after another and every problem
+// uses all the threads. Returns the first error reported by `gemm_exec`.
+dnnl_status_t gemm_batch(dim_t batch, dim_t M, dim_t N, dim_t K,
+        const std::function<dnnl_status_t(dim_t)> &gemm_exec);
+
 #if defined(USE_CBLAS)
 #define GEMM_IMPL_STR "x64:gemm:blas"
 #elif DNNL_X64
@@ -39,6 +39,9 @@ bool pack_gemm_bf16bf16f32_supported() {
 #endif
     return false;
 }
+bool pack_gemm_f16f16f32_supported() {
+    return pack_sgemm_supported();
+}
 
 dnnl_status_t sgemm_pack_get_size(const char *identifier, const char *transa,
         const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
@@ -61,6 +64,14 @@ dnnl_status_t gemm_bf16bf16f32_pack_get_size(const char *identifier,
     return dnnl_unimplemented;
 }
 
+dnnl_status_t gemm_f16f16f32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const dim_t *M, const dim_t *N,
+        const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
+        bool *pack) {
+    return sgemm_pack_get_size(
+            identifier, transa, transb, M, N, K, lda, ldb, size, pack);
+}
+
 dnnl_status_t gemm_s8u8s32_pack_get_size(const char *identifier,
         const char *transa, const char *transb, const dim_t *M, const dim_t *N,
         const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
@@ -104,6 +115,31 @@ dnnl_status_t gemm_bf16bf16f32_pack(const char *identifier, const char *transa,
     return dnnl_unimplemented;
 }
 
+dnnl_status_t gemm_f16f16f32_pack(const char *identifier, const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const dim_t *lda, const dim_t *ldb, const float16_t *src, float *dst) {
+    if (!pack_gemm_f16f16f32_supported()) return dnnl_unimplemented;
+    if (utils::any_null(identifier, transa, transb, M, N, K, lda, ldb))
+        return dnnl_invalid_arguments;
+
+    // Packing is done once, so the whole matrix is converted up front.
+    const bool do_a = utils::one_of(*identifier, 'a', 'A');
+    const dim_t nelems = nstl::max(dim_t(1), (do_a ? *M : *N) * *K);
+    float *src_f32 = (float *)impl::malloc(sizeof(float) * nelems, 64);
+    if (src_f32 == nullptr) return dnnl_out_of_memory;
+
+    dim_t ld_f32 = 0;
+    dnnl_status_t status = cvt_f16_gemm_operand_block(do_a,
+            do_a ? *transa : *transb, *M, *N, 0, *K, src, do_a ? *lda : *ldb,
+            src_f32, ld_f32);
+    if (status == dnnl_success)
+        status = sgemm_pack(identifier, transa, transb, M, N, K,
+                do_a ? &ld_f32 : lda, do_a ? ldb : &ld_f32, src_f32, dst);
+
+    impl::free(src_f32);
+    return status;
+}
+
 dnnl_status_t gemm_s8u8s32_pack(const char *identifier, const char *transa,
         const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
         const dim_t *lda, const dim_t *ldb, const void *src, void *dst) {
@@ -146,6 +182,45 @@ dnnl_status_t gemm_bf16bf16f32_compute(const char *transa, const char *transb,
     return dnnl_unimplemented;
 }
 
+dnnl_status_t gemm_f16f16f32_compute(const char *transa, const char *transb,
+        const dim_t *M, const dim_t *N, const dim_t *K, const void *A,
+        const dim_t *lda, const void *B, const dim_t *ldb, const float *beta,
+        float *C, const dim_t *ldc) {
+    if (!pack_gemm_f16f16f32_supported()) return dnnl_unimplemented;
+    if (utils::any_null(transa, transb, M, N, K, lda, ldb))
+        return dnnl_invalid_arguments;
+
+    const bool is_packed_a = utils::one_of(*transa, 'P', 'p');
+    const bool is_packed_b = utils::one_of(*transb, 'P', 'p');
+
+    if (!is_packed_a && !is_packed_b) {
+        const float alpha = 1.f;
+        return gemm_f16f16f32(transa, transb, M, N, K, &alpha,
+                (const float16_t *)A, lda, (const float16_t *)B, ldb, beta, C,
+                ldc);
+    }
+    if (is_packed_a && is_packed_b)
+        return sgemm_compute(transa, transb, M, N, K, (const float *)A, lda,
+                (const float *)B, ldb, beta, C, ldc);
+
+    // The packed operand already holds f32 data. The layout of a packed
+    // matrix depends on the whole problem, so the other operand can't be
+    // split into blocks and is converted as a whole into a buffer that is
+    // reused between the calls.
+    const bool cvt_a = !is_packed_a;
+    float *buf = get_f16_gemm_cvt_buffer((cvt_a ? *M : *N) * *K);
+    if (buf == nullptr) return dnnl_out_of_memory;
+
+    dim_t ld_cvt = 0;
+    CHECK(cvt_f16_gemm_operand_block(cvt_a, cvt_a ? *transa : *transb, *M, *N,
+            0, *K, (const float16_t *)(cvt_a ? A : B), cvt_a ? *lda : *ldb,
+            buf, ld_cvt));
+    const float *A_f32 = cvt_a ? buf : (const float *)A;
+    const float *B_f32 = cvt_a ? (const float *)B : buf;
+    return sgemm_compute(transa, transb, M, N, K, A_f32, cvt_a ? &ld_cvt : lda,
+            B_f32, cvt_a ? ldb : &ld_cvt, beta, C, ldc);
+}
+
 dnnl_status_t gemm_s8u8s32_compute(const char *transa, const char *transb,
         const char *offsetc, const dim_t *M, const dim_t *N, const dim_t *K,
         const int8_t *A, const dim_t *lda, const uint8_t *B, const dim_t *ldb,
@@ -21,6 +21,7 @@
 #include "oneapi/dnnl/dnnl_types.h"
 
 #include "common/bfloat16.hpp"
+#include "common/float16.hpp"
 
 namespace dnnl {
 namespace impl {
@@ -28,6 +29,7 @@ namespace cpu {
 
 bool pack_sgemm_supported();
 bool pack_gemm_bf16bf16f32_supported();
+bool pack_gemm_f16f16f32_supported();
 
 dnnl_status_t DNNL_API sgemm_pack_get_size(const char *identifier,
         const char *transa, const char *transb, const dim_t *M, const dim_t *N,
@@ -39,6 +41,12 @@ dnnl_status_t DNNL_API gemm_bf16bf16f32_pack_get_size(const char *identifier,
         const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
         bool *pack = nullptr);
 
+// f16 matrices are packed as f32 ones, so the packed buffer holds f32 data.
+dnnl_status_t DNNL_API gemm_f16f16f32_pack_get_size(const char *identifier,
+        const char *transa, const char *transb, const dim_t *M, const dim_t *N,
+        const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
+        bool *pack = nullptr);
+
 dnnl_status_t DNNL_API gemm_s8u8s32_pack_get_size(const char *identifier,
         const char *transa, const char *transb, const dim_t *M, const dim_t *N,
         const dim_t *K, const dim_t *lda, const dim_t *ldb, size_t *size,
@@ -58,6 +66,11 @@ dnnl_status_t DNNL_API gemm_bf16bf16f32_pack(const char *identifier,
         const dim_t *K, const dim_t *lda, const dim_t *ldb,
         const bfloat16_t *src, bfloat16_t *dst);
 
+dnnl_status_t DNNL_API gemm_f16f16f32_pack(const char *identifier,
+        const char *transa, const char *transb, const dim_t *M, const dim_t *N,
+        const dim_t *K, const dim_t *lda, const dim_t *ldb,
+        const float16_t *src, float *dst);
+
 dnnl_status_t DNNL_API gemm_s8u8s32_pack(const char *identifier,
         const char *transa, const char *transb, const dim_t *M, const dim_t *N,
         const dim_t *K, const dim_t *lda, const dim_t *ldb, const void *src,
@@ -78,6 +91,13 @@ dnnl_status_t DNNL_API gemm_bf16bf16f32_compute(const char *transa,
         const bfloat16_t *A, const dim_t *lda, const bfloat16_t *B,
         const dim_t *ldb, const float *beta, float *C, const dim_t *ldc);
 
+// A and B point to f16 data, unless they are packed ('P' transposition flag),
+// in which case they point to the f32 buffers filled by gemm_f16f16f32_pack().
+dnnl_status_t DNNL_API gemm_f16f16f32_compute(const char *transa,
+        const char *transb, const dim_t *M, const dim_t *N, const dim_t *K,
+        const void *A, const dim_t *lda, const void *B, const dim_t *ldb,
+        const float *beta, float *C, const dim_t *ldc);
+
 dnnl_status_t DNNL_API gemm_s8u8s32_compute(const char *transa,
         const char *transb, const char *offsetc, const dim_t *M, const dim_t *N,
         const dim_t *K, const int8_t *A, const dim_t *lda, const uint8_t *B,
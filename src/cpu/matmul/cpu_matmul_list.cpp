@@ -25,7 +25,10 @@
 #include "cpu/matmul/ref_sparse_matmul.hpp"
 
 #if DNNL_X64
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
 #include "cpu/x64/matmul/brgemm_matmul.hpp"
+#include "cpu/x64/matmul/jit_small_matmul.hpp"
 #include "cpu/x64/matmul/jit_uni_sparse_matmul.hpp"
 using namespace dnnl::impl::cpu::x64::matmul;
 using namespace dnnl::impl::cpu::x64;
@@ -68,6 +71,8 @@ using namespace dnnl::impl::cpu::matmul;
 // clang-format off
 constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE_AARCH64_ACL(acl_matmul_t)
+        CPU_INSTANCE_AVX512(jit_small_matmul_t<avx512_core>)
+        CPU_INSTANCE_AVX2(jit_small_matmul_t<avx2>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx_fp16>)
         CPU_INSTANCE_AMX(brgemm_matmul_t<avx512_core_amx>)
         CPU_INSTANCE_AVX512(brgemm_matmul_t<avx512_core_fp16>)
@@ -84,6 +89,10 @@ constexpr impl_list_item_t impl_list[] = REG_MATMUL_P({
         CPU_INSTANCE(ref_matmul_int8_t)
         // These implementations are enabled only when DNNL_EXPERIMENTAL_SPARSE
         // macro is defined.
+        CPU_INSTANCE_SPARSE_X64(brgemm_grouped_matmul_t<avx512_core>)
+        CPU_INSTANCE_SPARSE_X64(brgemm_grouped_matmul_t<avx2>)
+        CPU_INSTANCE_SPARSE_X64(brgemm_bsr_matmul_t<avx512_core>)
+        CPU_INSTANCE_SPARSE_X64(brgemm_bsr_matmul_t<avx2>)
         CPU_INSTANCE_SPARSE_X64(jit_uni_sparse_matmul_t)
         CPU_INSTANCE_SPARSE(ref_sparse_matmul_t)
         /* eol */
@@ -48,7 +48,8 @@ struct ref_matmul_int8_t : public primitive_t {
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
 
-            bool ok = utils::one_of(src_type, s8, u8) && wei_type == s8
+            bool ok = is_dense_data() && utils::one_of(src_type, s8, u8)
+                    && wei_type == s8
                     && IMPLICATION(with_bias(),
                             utils::one_of(bia_type, f32, bf16, s32, s8, u8))
                     && utils::one_of(dst_type, f32, bf16, s32, s8, u8)
@@ -40,7 +40,36 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
 
     parallel_nd(M, N, [&](dim_t i, dim_t j) { dst[i * N + j] = 0.0f; });
 
-    if (weights_d.is_sparse_desc()) {
+    if (weights_d.is_sparse_desc()
+            && weights_d.encoding() == sparse_encoding::bsr) {
+        const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+        const auto wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+        const auto wei_indices
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+        const auto wei_pointers
+                = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+
+        const dim_t k_blk = weights_d.block_dims()[0];
+        const dim_t n_blk = weights_d.block_dims()[1];
+        const dim_t nb_k = K / k_blk;
+
+        parallel_nd(M, [&](dim_t m) {
+            for (dim_t kb = 0; kb < nb_k; kb++) {
+                for (dim_t b = wei_pointers[kb]; b < wei_pointers[kb + 1];
+                        b++) {
+                    const float *blk = wei_values + b * k_blk * n_blk;
+                    const dim_t n0 = wei_indices[b] * n_blk;
+                    for_(dim_t k = 0; k < k_blk; k++)
+                    for (dim_t n = 0; n < n_blk; n++) {
+                        const dim_t src_idx = m * K + kb * k_blk + k;
+                        const dim_t dst_idx = m * N + n0 + n;
+                        dst[dst_idx] = dst[dst_idx]
+                                + src[src_idx] * blk[k * n_blk + n];
+                    }
+                }
+            }
+        });
+    } else if (weights_d.is_sparse_desc()) {
         const auto src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
         const auto wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
         const auto wei_indices
@@ -59,6 +88,46 @@ status_t ref_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
                 }
             }
         });
+    } else if (src_d.is_sparse_desc()
+            && src_d.encoding() == sparse_encoding::grouped) {
+        const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+        const auto src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+        const auto src_offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+        const dim_t ngroups = src_d.ngroups();
+
+        if (src_offsets[0] != 0 || src_offsets[ngroups] != M)
+            return status::invalid_arguments;
+        for (dim_t g = 0; g < ngroups; g++)
+            if (src_offsets[g + 1] < src_offsets[g])
+                return status::invalid_arguments;
+
+        // Every group of rows is multiplied by its own weights matrix.
+        parallel_nd(ngroups, N, [&](dim_t g, dim_t n) {
+            for_(dim_t m = src_offsets[g]; m < src_offsets[g + 1]; m++)
+            for (dim_t k = 0; k < K; k++) {
+                const dim_t src_idx = m * K + k;
+                const dim_t dst_idx = m * N + n;
+                const dim_t wei_idx = (g * K + k) * N + n;
+                dst[dst_idx]
+                        = dst[dst_idx] + src_values[src_idx] * weights[wei_idx];
+            }
+        });
+    } else if (src_d.is_sparse_desc()
+            && src_d.encoding() == sparse_encoding::coo) {
+        const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+        const auto src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+        const auto src_rows = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+        const auto src_cols = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+        const dim_t nnz = src_d.nnz();
+
+        // Entries may come in any order, so parallelize over dst columns.
+        parallel_nd(N, [&](dim_t n) {
+            for (dim_t k = 0; k < nnz; k++) {
+                const dim_t dst_idx = src_rows[k] * N + n;
+                const dim_t wei_idx = src_cols[k] * N + n;
+                dst[dst_idx] = dst[dst_idx] + src_values[k] * weights[wei_idx];
+            }
+        });
     } else if (src_d.is_sparse_desc()) {
         const auto weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
         const auto src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
@@ -43,6 +43,10 @@ struct ref_sparse_matmul_t : public primitive_t {
 
             memory_desc_wrapper src_d(src_md());
             memory_desc_wrapper wei_d(weights_md(0));
+            // COO and grouped encodings keep all the metadata in one type.
+            const bool src_single_metadata = src_d.is_sparse_desc()
+                    && utils::one_of(src_d.encoding(), sparse_encoding::coo,
+                            sparse_encoding::grouped);
 
             const bool ok
                     = utils::everyone_is(f32, src_type, wei_type, dst_type)
@@ -51,11 +55,18 @@ struct ref_sparse_matmul_t : public primitive_t {
                     && IMPLICATION(
                             wei_d.is_sparse_desc(), !src_d.is_sparse_desc())
                     && IMPLICATION(src_d.is_sparse_desc(),
-                            utils::everyone_is(s32, src_d.metadata_type(0),
-                                    src_d.metadata_type(1)))
+                            (src_d.encoding() == sparse_encoding::csr
+                                    && utils::everyone_is(s32,
+                                            src_d.metadata_type(0),
+                                            src_d.metadata_type(1)))
+                                    || (src_single_metadata
+                                            && src_d.metadata_type(0) == s32))
                     && IMPLICATION(wei_d.is_sparse_desc(),
-                            utils::everyone_is(s32, wei_d.metadata_type(0),
-                                    wei_d.metadata_type(1)))
+                            utils::one_of(wei_d.encoding(),
+                                    sparse_encoding::csr, sparse_encoding::bsr)
+                                    && utils::everyone_is(s32,
+                                            wei_d.metadata_type(0),
+                                            wei_d.metadata_type(1)))
                     && !with_bias() && attr()->has_default_values()
                     && set_default_formats() && formats_ok(src_d, wei_d);
             return ok ? status::success : status::unimplemented;
@@ -66,6 +77,9 @@ struct ref_sparse_matmul_t : public primitive_t {
             if (!memory_desc_wrapper(dst_md()).matches_one_of_tag(
                         format_tag::ab))
                 return false;
+            if (src_d.is_sparse_desc()
+                    && src_d.encoding() == sparse_encoding::grouped)
+                return wei_d.matches_one_of_tag(format_tag::abc);
             if (src_d.is_sparse_desc())
                 return wei_d.matches_one_of_tag(format_tag::ab);
             if (wei_d.is_sparse_desc())
@@ -44,6 +44,11 @@ float compute_binary_scalar(alg_kind_t alg, float x, float y) {
     }
 }
 
+float compute_binary_scalar(alg_kind_t alg, float x, float y, bool c) {
+    if (alg == binary_select) return c ? x : y;
+    return compute_binary_scalar(alg, x, y);
+}
+
 float compute_eltwise_scalar_fwd(
         const alg_kind_t alg, float s, float alpha, float beta) {
     float d = 0.f;
@@ -136,7 +141,7 @@ ref_binary_scalar_t::ref_binary_scalar_t(alg_kind_t alg) : alg_(alg) {
             alg_kind::binary_min, alg_kind::binary_mul, alg_kind::binary_div,
             alg_kind::binary_sub, alg_kind::binary_ge, alg_kind::binary_gt,
             alg_kind::binary_le, alg_kind::binary_lt, alg_kind::binary_eq,
-            alg_kind::binary_ne));
+            alg_kind::binary_ne, alg_kind::binary_select));
 }
 
 ref_binary_scalar_t::ref_binary_scalar_t(
@@ -147,6 +152,11 @@ float ref_binary_scalar_t::compute_scalar(float src0, float src1) const {
     return compute_binary_scalar(alg_, src0, src1);
 }
 
+float ref_binary_scalar_t::compute_scalar(
+        float src0, float src1, bool src2) const {
+    return compute_binary_scalar(alg_, src0, src1, src2);
+}
+
 ref_eltwise_scalar_fwd_t::ref_eltwise_scalar_fwd_t(
         alg_kind_t alg, float alpha, float beta, float scale)
     : alg_(alg), alpha_(alpha), beta_(beta), scale_(scale) {
@@ -235,14 +245,14 @@ dim_t get_prelu_weights_off(const dim_t l_offset, const dims_t &dst_dims,
             weights_md, l_offset, dst_dims, dst_ndims, weights_mask);
 }
 
-dim_t get_binary_src1_off(const memory_desc_t &src1_md, const dim_t l_offset,
+dim_t get_binary_src_off(const memory_desc_t &src_md, const dim_t l_offset,
         const dims_t &dst_dims, const int dst_ndims) {
 
     const int mask_binary_po
-            = utils::get_dims_mask(dst_dims, src1_md.dims, dst_ndims);
+            = utils::get_dims_mask(dst_dims, src_md.dims, dst_ndims);
 
     return get_po_tensor_off(
-            src1_md, l_offset, dst_dims, dst_ndims, mask_binary_po);
+            src_md, l_offset, dst_dims, dst_ndims, mask_binary_po);
 }
 
 } // namespace
@@ -275,13 +285,25 @@ status_t ref_post_ops_t::execute(float &res, const args_t &args) const {
                 const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, args.dst_md);
                 const auto &src1_desc = e.binary.src1_desc;
 
-                const auto off = get_binary_src1_off(
+                const auto off = get_binary_src_off(
                         src1_desc, args.l_offset, dst_d.dims(), dst_d.ndims());
                 const auto src1_binary_po = CTX_IN_MEM(const void *,
                         (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx) | DNNL_ARG_SRC_1));
                 const float val_po = io::load_float_value(
                         src1_desc.data_type, src1_binary_po, off);
-                res = it_binary_po->compute_scalar(res, val_po);
+                if (e.binary.alg == alg_kind::binary_select) {
+                    const auto &src2_desc = e.binary.src2_desc;
+                    const auto off2 = get_binary_src_off(src2_desc,
+                            args.l_offset, dst_d.dims(), dst_d.ndims());
+                    const auto src2_binary_po = CTX_IN_MEM(const void *,
+                            (DNNL_ARG_ATTR_MULTIPLE_POST_OP(idx)
+                                    | DNNL_ARG_SRC_2));
+                    const float cond_po = io::load_float_value(
+                            src2_desc.data_type, src2_binary_po, off2);
+                    res = it_binary_po->compute_scalar(
+                            res, val_po, cond_po != 0.f);
+                } else
+                    res = it_binary_po->compute_scalar(res, val_po);
                 ++it_binary_po;
             } break;
             case primitive_kind::prelu: {
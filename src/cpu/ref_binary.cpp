@@ -37,6 +37,7 @@ namespace cpu {
 status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto src0 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_0);
     const auto src1 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    const auto src2 = CTX_IN_MEM(const void *, DNNL_ARG_SRC_2);
     auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
 
     const float *scales[2];
@@ -45,11 +46,14 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
 
     const memory_desc_wrapper src0_d(pd()->src_md(0));
     const memory_desc_wrapper src1_d(pd()->src_md(1));
+    const memory_desc_wrapper src2_d(pd()->src_md(2));
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const auto src0_dt = src0_d.data_type();
     const auto src1_dt = src1_d.data_type();
+    const auto src2_dt = src2_d.data_type();
     const auto dst_dt = dst_d.data_type();
+    const bool is_select = pd()->is_select();
 
     const auto alg = pd()->desc()->alg_kind;
 
@@ -106,7 +110,18 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
         x_f *= scales[0][0];
         y_f *= scales[1][0];
 
-        float acc = compute_binary_scalar(alg, x_f, y_f);
+        bool c = false;
+        if (is_select) {
+            dims_t dims_src2;
+            utils::l_dims_by_l_offset(dims_src2, i, dst_d.dims(), ndims);
+            int mask_src2
+                    = utils::get_dims_mask(dst_d.dims(), src2_d.dims(), ndims);
+            utils::apply_mask_on_dims(dims_src2, ndims, mask_src2);
+            const auto off_cond = src2_d.off_v(dims_src2);
+            c = io::load_float_value(src2_dt, src2, off_cond) != 0.f;
+        }
+
+        float acc = compute_binary_scalar(alg, x_f, y_f, c);
 
         if (has_postops) {
             ref_post_ops_t::args_t args;
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_gather.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_gather_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t dst_rows = pd()->dst_rows();
+    const dim_t row_size = pd()->row_size();
+    const bool with_bags = pd()->with_bags();
+    const bool is_mean = pd()->is_mean();
+    const bool with_row_scales = pd()->with_row_scales();
+
+    parallel_nd(dst_rows, row_size, [&](dim_t r, dim_t c) {
+        dim_t beg = r, end = r + 1;
+        if (with_bags) {
+            beg = offsets[r];
+            end = r + 1 < dst_rows ? offsets[r + 1] : n_indices;
+        }
+
+        float acc = 0.f;
+        for (dim_t i = beg; i < end; i++) {
+            const dim_t row = indices[i];
+            const float s = src_scales[with_row_scales ? row : 0];
+            acc += s
+                    * io::load_float_value(
+                            src_d.data_type(), src, src_d.off(row, c));
+        }
+        if (is_mean && end > beg) acc /= static_cast<float>(end - beg);
+
+        io::store_float_value(dst_d.data_type(), acc, dst, dst_d.off(r, c));
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -39,6 +39,8 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     auto scale = CTX_IN_MEM(const float *, DNNL_ARG_SCALE);
     auto shift = CTX_IN_MEM(const float *, DNNL_ARG_SHIFT);
+    auto residual = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto src_sum = CTX_OUT_MEM(void *, DNNL_ARG_DST_1);
     auto mean = pd()->stats_are_src()
             ? const_cast<float *>(CTX_IN_MEM(const float *, DNNL_ARG_MEAN))
             : CTX_OUT_MEM(float *, DNNL_ARG_MEAN);
@@ -56,12 +58,18 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool save_stats = pd()->is_training();
     const bool calculate_stats = !pd()->stats_are_src();
+    const bool skip_mean = pd()->skip_mean();
+    const bool fuse_residual_add = pd()->fuse_residual_add();
+
+    // With the residual fusion the tensor being normalized is the sum, as
+    // stored in the user destination, i.e. rounded to the source data type.
+    const void *norm_src = fuse_residual_add ? src_sum : src;
 
     /* fast return */
     if (this->pd()->has_zero_dim_memory()) {
         if (calculate_stats && save_stats) {
             for (dim_t n = 0; n < N; n++) {
-                mean[n] = 0;
+                if (!skip_mean) mean[n] = 0;
                 variance[n] = 0;
             }
         }
@@ -70,20 +78,35 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
 
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
-        auto v_mean = calculate_stats ? 0 : mean[s_off];
+        auto v_mean = calculate_stats || skip_mean ? 0 : mean[s_off];
         auto v_variance = calculate_stats ? 0 : variance[s_off];
 
-        if (calculate_stats) {
+        if (fuse_residual_add) {
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
-                v_mean += s;
+                const float s
+                        = io::load_float_value(src_d.data_type(), src, s_off)
+                        + io::load_float_value(
+                                src_d.data_type(), residual, s_off);
+                io::store_float_value(src_d.data_type(), s, src_sum, s_off);
+            }
+        }
+
+        if (calculate_stats) {
+            if (!skip_mean) {
+                for (dim_t c = 0; c < C; ++c) {
+                    const auto s_off = src_d.off_l(n * C + c);
+                    float s = io::load_float_value(
+                            src_d.data_type(), norm_src, s_off);
+                    v_mean += s;
+                }
+                v_mean /= C;
             }
-            v_mean /= C;
 
             for (dim_t c = 0; c < C; ++c) {
                 const auto s_off = src_d.off_l(n * C + c);
-                float s = io::load_float_value(src_d.data_type(), src, s_off);
+                float s = io::load_float_value(
+                        src_d.data_type(), norm_src, s_off);
                 float m = s - v_mean;
                 v_variance += m * m;
             }
@@ -96,15 +119,23 @@ status_t ref_layer_normalization_fwd_t::execute_forward(
             const float sv = shift ? shift[sc_d.off(c)] : 0;
             const auto s_off = src_d.off_l(n * C + c);
             const auto d_off = dst_d.off_l(n * C + c);
-            float s = io::load_float_value(src_d.data_type(), src, s_off);
+            float s = io::load_float_value(src_d.data_type(), norm_src, s_off);
             float d = sm * (s - v_mean) + sv;
-            d *= src_scales[0] * dst_scales[0];
+            d *= src_scales[0];
+
+            ref_post_ops_t::args_t args;
+            args.ctx = &ctx;
+            args.l_offset = n * C + c;
+            args.dst_md = pd()->dst_md();
+            ref_post_ops->execute(d, args);
+
+            d *= dst_scales[0];
             io::store_float_value(dst_d.data_type(), d, dst, d_off);
         }
 
         if (calculate_stats) {
             if (save_stats) {
-                mean[s_off] = v_mean;
+                if (!skip_mean) mean[s_off] = v_mean;
                 variance[s_off] = v_variance;
             }
         }
@@ -163,6 +194,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
 
     const float eps = pd()->desc()->layer_norm_epsilon;
     const bool calculate_diff_stats = !pd()->use_global_stats();
+    const bool skip_mean = pd()->skip_mean();
 
     if (diff_scale || diff_shift) {
         parallel_nd(C, [&](dim_t c) {
@@ -174,10 +206,11 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 const auto diff_dst_off = diff_dst_d.off_l(n * C + c);
                 const auto stat_off = stat_d.off_l(n);
                 float inv_sqrt_variance = 1.f / sqrtf(variance[stat_off] + eps);
+                float v_mean = skip_mean ? 0.f : mean[stat_off];
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
-                diff_gamma += (s - mean[stat_off]) * dd * inv_sqrt_variance;
+                diff_gamma += (s - v_mean) * dd * inv_sqrt_variance;
                 diff_beta += dd;
             }
 
@@ -189,6 +222,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
     parallel_nd(N, [&](dim_t n) {
         const size_t s_off = stat_d.off_l(n);
         float inv_sqrt_variance = 1.f / sqrtf(variance[s_off] + eps);
+        float v_mean = skip_mean ? 0.f : mean[s_off];
         float dd_gamma = 0.f;
         float dd_gamma_x = 0.f;
         if (calculate_diff_stats) {
@@ -200,7 +234,7 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
                 float dd = io::load_float_value(
                         diff_dst_d.data_type(), diff_dst, diff_dst_off);
                 dd_gamma += dd * gamma;
-                dd_gamma_x += dd * gamma * (s - mean[s_off]);
+                dd_gamma_x += dd * gamma * (s - v_mean);
             }
             dd_gamma_x *= inv_sqrt_variance;
         }
@@ -215,8 +249,8 @@ status_t ref_layer_normalization_bwd_t::execute_backward(
             float d_src = dd * gamma;
             if (calculate_diff_stats) {
                 float s = io::load_float_value(src_d.data_type(), src, src_off);
-                d_src -= dd_gamma / C;
-                d_src -= (s - mean[s_off]) * dd_gamma_x * inv_sqrt_variance / C;
+                if (!skip_mean) d_src -= dd_gamma / C;
+                d_src -= (s - v_mean) * dd_gamma_x * inv_sqrt_variance / C;
             }
             d_src *= inv_sqrt_variance;
             io::store_float_value(
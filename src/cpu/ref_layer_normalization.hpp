@@ -25,6 +25,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/platform.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/cpu_layer_normalization_pd.hpp"
 
@@ -52,16 +53,33 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
                     && platform::has_data_type_support(dst_md()->data_type)
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values(skip_mask_t::scales_runtime)
-                    && attr_scales_ok() && set_default_formats_common();
+                    && attr()->has_default_values(skip_mask_t::scales_runtime
+                            | skip_mask_t::post_ops)
+                    && attr_scales_ok() && post_ops_ok()
+                    && set_default_formats_common()
+                    && attr_.set_default_formats(dst_md(0))
+                            == status::success;
             if (!ok) return status::unimplemented;
 
             return status::success;
         }
+
+    private:
+        bool post_ops_ok() const {
+            using namespace primitive_kind;
+            return attr()->post_ops_.has_default_values({binary, eltwise});
+        }
     };
 
     ref_layer_normalization_fwd_t(const pd_t *apd) : primitive_t(apd) {}
 
+    status_t init(engine_t *engine) override {
+        ref_post_ops
+                = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
+        if (!ref_post_ops) return status::out_of_memory;
+        return status::success;
+    }
+
     status_t execute(const exec_ctx_t &ctx) const override {
         return execute_forward(ctx);
     }
@@ -69,6 +87,8 @@ struct ref_layer_normalization_fwd_t : public primitive_t {
 private:
     status_t execute_forward(const exec_ctx_t &ctx) const;
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<ref_post_ops_t> ref_post_ops;
 };
 
 struct ref_layer_normalization_bwd_t : public primitive_t {
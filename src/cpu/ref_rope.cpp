@@ -0,0 +1,89 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_rope_t::execute(const exec_ctx_t &ctx) const {
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto cos_sin = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper cs_d(pd()->cos_sin_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto src_dt = src_d.data_type();
+    const auto dst_dt = dst_d.data_type();
+    const int ndims = pd()->ndims();
+    const int axis = pd()->axis();
+    const dim_t D = pd()->row_size();
+    const dim_t half = D / 2;
+    const dim_t nrows = src_d.nelems() / D;
+    const bool is_interleaved = pd()->is_interleaved();
+    const bool with_positions = pd()->with_positions();
+    const float theta = pd()->desc()->theta;
+
+    parallel_nd(nrows, half, [&](dim_t r, dim_t i) {
+        dims_t pos;
+        utils::l_dims_by_l_offset(pos, r * D, src_d.dims(), ndims);
+        const dim_t t = pos[axis];
+
+        float c, s;
+        if (with_positions) {
+            const dim_t p = static_cast<const int32_t *>(cos_sin)[cs_d.off(t)];
+            const float angle = rope_angle(p, i, D, theta);
+            c = std::cos(angle);
+            s = std::sin(angle);
+        } else {
+            c = io::load_float_value(data_type::f32, cos_sin, cs_d.off(t, i));
+            s = io::load_float_value(
+                    data_type::f32, cos_sin, cs_d.off(t, half + i));
+        }
+
+        const dim_t j0 = is_interleaved ? 2 * i : i;
+        const dim_t j1 = is_interleaved ? 2 * i + 1 : half + i;
+        pos[ndims - 1] = j0;
+        const dim_t src_off0 = src_d.off_v(pos);
+        const dim_t dst_off0 = dst_d.off_v(pos);
+        pos[ndims - 1] = j1;
+        const dim_t src_off1 = src_d.off_v(pos);
+        const dim_t dst_off1 = dst_d.off_v(pos);
+
+        const float x0 = io::load_float_value(src_dt, src, src_off0);
+        const float x1 = io::load_float_value(src_dt, src, src_off1);
+        io::store_float_value(dst_dt, x0 * c - x1 * s, dst, dst_off0);
+        io::store_float_value(dst_dt, x0 * s + x1 * c, dst, dst_off1);
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
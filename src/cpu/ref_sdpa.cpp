@@ -0,0 +1,141 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+#include <math.h>
+
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_sdpa.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_sdpa_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const auto qry = CTX_IN_MEM(const void *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const void *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const void *, DNNL_ARG_VALUES);
+    const auto msk = CTX_IN_MEM(const void *, DNNL_ARG_ATTN_MASK);
+    const auto scl = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper qry_d(pd()->qry_md());
+    const memory_desc_wrapper key_d(pd()->key_md());
+    const memory_desc_wrapper val_d(pd()->val_md());
+    const memory_desc_wrapper msk_d(pd()->attn_mask_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto *desc = pd()->desc();
+    const int ndims = dst_d.ndims();
+    const int r = ndims - 2, c = ndims - 1;
+    const dim_t MB = desc->batch_size();
+    const dim_t Sq = desc->queries();
+    const dim_t Sk = desc->keys();
+    const dim_t D = desc->head_size();
+    const dim_t Dv = desc->values();
+
+    const bool with_mask = pd()->with_attn_mask();
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = io::load_float_value(desc->scale_dt, scl, 0);
+        if (desc->invert_scale) scale = 1.f / scale;
+    }
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+
+    const int nthr = pd()->nthr_;
+    parallel_nd_ext(nthr, MB, Sq, [&](int ithr, int, dim_t mb, dim_t q) {
+        float *scores = scores_base + ithr * Sk;
+        float *acc = acc_base + ithr * Dv;
+
+        dims_t pos = {0}, msk_pos = {0};
+        utils::l_dims_by_l_offset(pos, mb, dst_d.dims(), r);
+        pos[r] = q;
+        if (with_mask) {
+            for (int d = 0; d < ndims; d++)
+                msk_pos[d] = msk_d.dims()[d] == 1 ? 0 : pos[d];
+        }
+
+        // scores = scale(Q * K) + mask
+        float max_score = -FLT_MAX;
+        for (dim_t k = 0; k < Sk; k++) {
+            dims_t q_pos, k_pos;
+            utils::array_copy(q_pos, pos, ndims);
+            utils::array_copy(k_pos, pos, ndims);
+            k_pos[c] = k;
+            float s = 0.f;
+            for (dim_t d = 0; d < D; d++) {
+                q_pos[c] = d;
+                k_pos[r] = d;
+                s += io::load_float_value(
+                             qry_d.data_type(), qry, qry_d.off_v(q_pos))
+                        * io::load_float_value(
+                                key_d.data_type(), key, key_d.off_v(k_pos));
+            }
+            s *= scale;
+            if (with_mask) {
+                if (msk_d.dims()[c] != 1) msk_pos[c] = k;
+                s += io::load_float_value(
+                        msk_d.data_type(), msk, msk_d.off_v(msk_pos));
+            }
+            scores[k] = s;
+            max_score = nstl::max(max_score, s);
+        }
+
+        float denom = 0.f;
+        for (dim_t k = 0; k < Sk; k++) {
+            scores[k] = expf(scores[k] - max_score);
+            denom += scores[k];
+        }
+
+        // dst = softmax(scores) * V
+        for (dim_t v = 0; v < Dv; v++)
+            acc[v] = 0.f;
+        for (dim_t k = 0; k < Sk; k++) {
+            dims_t v_pos;
+            utils::array_copy(v_pos, pos, ndims);
+            v_pos[r] = k;
+            for (dim_t v = 0; v < Dv; v++) {
+                v_pos[c] = v;
+                acc[v] += scores[k]
+                        * io::load_float_value(
+                                val_d.data_type(), val, val_d.off_v(v_pos));
+            }
+        }
+
+        const float inv_denom = 1.f / denom;
+        dims_t dst_pos;
+        utils::array_copy(dst_pos, pos, ndims);
+        for (dim_t v = 0; v < Dv; v++) {
+            dst_pos[c] = v;
+            io::store_float_value(dst_d.data_type(), acc[v] * inv_denom, dst,
+                    dst_d.off_v(dst_pos));
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,99 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REF_SDPA_HPP
+#define CPU_REF_SDPA_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+struct ref_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T("ref:any", ref_sdpa_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+
+            const auto dt_ok = [](data_type_t dt) {
+                return utils::one_of(dt, f32, bf16, f16)
+                        && platform::has_data_type_support(dt);
+            };
+
+            VDISPATCH_SDPA(dt_ok(qry_md()->data_type)
+                            && dt_ok(key_md()->data_type)
+                            && dt_ok(val_md()->data_type)
+                            && dt_ok(dst_md()->data_type),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(with_attn_mask(),
+                                   dt_ok(attn_mask_md()->data_type)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(IMPLICATION(with_attn_scale(),
+                                   dt_ok(desc()->scale_dt)),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SDPA(attr()->has_default_values(),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SDPA(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+            VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+
+            return status::success;
+        }
+
+        int nthr_ = 0;
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            // Every thread keeps one row of scores and one row of the output
+            // accumulator, so the memory footprint is linear in sequence
+            // length.
+            scratchpad.template book<float>(
+                    key_sdpa_scores, nthr_ * desc()->keys());
+            scratchpad.template book<float>(
+                    key_sdpa_acc, nthr_ * desc()->values());
+        }
+    };
+
+    ref_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,85 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+#include "cpu/ref_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+status_t ref_topk_t::execute(const exec_ctx_t &ctx) const {
+    using namespace topk_utils;
+
+    if (pd()->has_zero_dim_memory()) return status::success;
+
+    status_t status = status::success;
+    auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
+    CHECK(status);
+    auto indices = CTX_OUT_CLEAN_MEM(int32_t *, DNNL_ARG_DST_1, status);
+    CHECK(status);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper indices_d(pd()->indices_md());
+
+    const dim_t outer_size = pd()->outer_size();
+    const dim_t inner_size = pd()->inner_size();
+    const dim_t axis_size = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const bool is_max = pd()->is_max();
+
+    auto scratch = ctx.get_scratchpad_grantor().template get<entry_t>(
+            memory_tracking::names::key_topk_candidates);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(outer_size * inner_size, nthr, ithr, start, end);
+        entry_t *buf = scratch + ithr * axis_size;
+
+        for (dim_t r = start; r < end; r++) {
+            const dim_t ou = r / inner_size;
+            const dim_t in = r % inner_size;
+            for (dim_t a = 0; a < axis_size; a++) {
+                const dim_t off = src_d.off_l(
+                        (ou * axis_size + a) * inner_size + in);
+                buf[a].val = io::load_float_value(
+                        src_d.data_type(), src, off);
+                buf[a].idx = static_cast<int32_t>(a);
+            }
+
+            select(buf, axis_size, k, is_max, true);
+
+            for (dim_t a = 0; a < k; a++) {
+                const dim_t l_off = (ou * k + a) * inner_size + in;
+                io::store_float_value(dst_d.data_type(), buf[a].val, dst,
+                        dst_d.off_l(l_off));
+                indices[indices_d.off_l(l_off)] = buf[a].idx;
+            }
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -28,6 +28,7 @@
 
 #include "cpu/cpu_engine.hpp"
 #include "cpu/reorder/cpu_reorder_pd.hpp"
+#include "cpu/reorder/simple_sparse_reorder.hpp"
 
 #if DNNL_X64
 #include "cpu/x64/jit_uni_reorder.hpp"
@@ -121,6 +122,14 @@ extern const impl_list_map_t &comp_s8_s8_impl_list_map();
     impl_list_item_t(impl_list_item_t::reorder_type_deduction_helper_t< \
             __VA_ARGS__::pd_t>()),
 
+// Some compilers do not allow guarding implementations with macros
+// in the impl list.
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+#define REG_SPARSE_SR(dt) CPU_REORDER_INSTANCE(simple_sparse_reorder_t<dt>)
+#else
+#define REG_SPARSE_SR(dt)
+#endif
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
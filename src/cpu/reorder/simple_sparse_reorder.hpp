@@ -0,0 +1,318 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_REORDER_SIMPLE_SPARSE_REORDER_HPP
+#define CPU_REORDER_SIMPLE_SPARSE_REORDER_HPP
+
+#include <algorithm>
+#include <assert.h>
+#include <atomic>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/reorder/cpu_reorder_pd.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Reorders into sparse encodings.
+//
+// Dense plain 2D tensor to BSR: blocks with at least one non-zero entry are
+// stored, all other blocks are skipped. The number of non-zero blocks is only
+// known at execution time, so `nnz` of the destination memory descriptor is
+// treated as a capacity: the reorder fails with `invalid_arguments` if the
+// source has more non-zero blocks than the destination can hold. The last
+// block row pointer holds the number of blocks actually stored.
+//
+// COO to CSR: the entries are sorted by their (row, column) coordinates with
+// a parallel LSD radix sort of the entry offsets in the dense tensor. Every
+// pass computes digit histograms of contiguous chunks of entries and then
+// scatters the chunks independently, which keeps the sort stable. Passes
+// where all the entries share the same digit are skipped. Row pointers are
+// found by a binary search over the sorted offsets.
+template <data_type_t type>
+struct simple_sparse_reorder_t : public primitive_t {
+    struct pd_t : public cpu_reorder_pd_t {
+        using cpu_reorder_pd_t::cpu_reorder_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:sparse", simple_sparse_reorder_t);
+
+    private:
+        static status_t create(reorder_pd_t **reorder_pd, engine_t *engine,
+                const primitive_attr_t *attr, engine_t *src_engine,
+                const memory_desc_t *src_md, engine_t *dst_engine,
+                const memory_desc_t *dst_md) {
+            using namespace status;
+
+            const memory_desc_wrapper id(src_md), od(dst_md);
+            bool args_ok = true;
+#define PD_CHECK_ARG(x) args_ok = args_ok && (x)
+            PD_CHECK_ARG(id.data_type() == type);
+            PD_CHECK_ARG(od.data_type() == type);
+            PD_CHECK_ARG(id.ndims() == 2);
+            PD_CHECK_ARG(!id.has_runtime_dims_or_strides());
+            PD_CHECK_ARG(od.is_sparse_desc());
+            PD_CHECK_ARG(attr->has_default_values());
+#undef PD_CHECK_ARG
+            if (!args_ok) return invalid_arguments;
+
+            const bool od_s32 = utils::everyone_is(
+                    data_type::s32, od.metadata_type(0), od.metadata_type(1));
+            const bool dense_to_bsr = id.is_blocking_desc()
+                    && id.blocking_desc().inner_nblks == 0
+                    && od.encoding() == sparse_encoding::bsr && od_s32;
+            const bool coo_to_csr = id.is_sparse_desc()
+                    && id.encoding() == sparse_encoding::coo
+                    && id.metadata_type(0) == data_type::s32
+                    && od.encoding() == sparse_encoding::csr && od_s32
+                    && id.nnz() == od.nnz()
+                    && id.nnz() <= nstl::numeric_limits<int32_t>::max();
+            if (!dense_to_bsr && !coo_to_csr) return unimplemented;
+
+            auto _pd = new pd_t(attr, src_engine->kind(), src_md,
+                    dst_engine->kind(), dst_md);
+            if (_pd == nullptr) return out_of_memory;
+            if (_pd->init(engine, src_engine, dst_engine) != success) {
+                delete _pd;
+                return unimplemented;
+            }
+            _pd->init_scratchpad();
+            CHECK(_pd->init_scratchpad_md());
+            return safe_ptr_assign(*reorder_pd, _pd);
+        }
+
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            const memory_desc_wrapper id(src_md());
+            const memory_desc_wrapper od(dst_md());
+            auto scratchpad = scratchpad_registry().registrar();
+            if (id.is_sparse_desc()) {
+                nchunks_ = dnnl_get_max_threads();
+                // Digit histograms of every chunk, followed by ping-pong
+                // buffers for the sorted entry offsets and permutation.
+                scratchpad.template book<dim_t>(
+                        key_reorder_sparse_sort_hist, nchunks_ * radix);
+                scratchpad.template book<dim_t>(
+                        key_reorder_sparse_sort_keys, 2 * id.nnz());
+                scratchpad.template book<int32_t>(
+                        key_reorder_sparse_sort_perm, 2 * id.nnz());
+            } else {
+                const dim_t nb_rows = od.dims()[0] / od.block_dims()[0];
+                // Number of non-zero blocks in every block row.
+                scratchpad.template book<int32_t>(
+                        key_reorder_sparse_row_counts, nb_rows);
+            }
+        }
+
+        // Number of chunks the entries are split into by the radix sort.
+        int nchunks_ = 1;
+
+        friend dnnl::impl::impl_list_item_t;
+        friend struct simple_sparse_reorder_t;
+    };
+
+    simple_sparse_reorder_t(const pd_t *apd) : primitive_t(apd) {}
+
+private:
+    using data_t = typename prec_traits<type>::type;
+
+    static constexpr int radix_bits = 8;
+    static constexpr dim_t radix = dim_t(1) << radix_bits;
+
+    status_t execute(const exec_ctx_t &ctx) const override {
+        if (memory_desc_wrapper(pd()->src_md()).is_sparse_desc())
+            return execute_coo_to_csr(ctx);
+        return execute_dense_to_bsr(ctx);
+    }
+
+    status_t execute_dense_to_bsr(const exec_ctx_t &ctx) const {
+        using namespace memory_tracking::names;
+
+        const auto *src = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM);
+        auto *values = CTX_OUT_MEM(data_t *, DNNL_ARG_TO, 0);
+        auto *indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 1);
+        auto *pointers = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 2);
+
+        const memory_desc_wrapper id(pd()->src_md());
+        const memory_desc_wrapper od(pd()->dst_md());
+
+        const dim_t rows_blk = od.block_dims()[0];
+        const dim_t cols_blk = od.block_dims()[1];
+        const dim_t nb_rows = od.dims()[0] / rows_blk;
+        const dim_t nb_cols = od.dims()[1] / cols_blk;
+        const dim_t block_size = rows_blk * cols_blk;
+
+        const dim_t row_stride = id.blocking_desc().strides[0];
+        const dim_t col_stride = id.blocking_desc().strides[1];
+        src += id.offset0();
+
+        const auto is_zero_block = [&](dim_t br, dim_t bc) {
+            const data_t *blk = src + br * rows_blk * row_stride
+                    + bc * cols_blk * col_stride;
+            for_(dim_t r = 0; r < rows_blk; r++)
+            for (dim_t c = 0; c < cols_blk; c++)
+                if (blk[r * row_stride + c * col_stride] != data_t(0))
+                    return false;
+            return true;
+        };
+
+        // Pass 1: count non-zero blocks of every block row.
+        auto *row_counts = ctx.get_scratchpad_grantor().template get<int32_t>(
+                key_reorder_sparse_row_counts);
+        parallel_nd(nb_rows, [&](dim_t br) {
+            int32_t count = 0;
+            for (dim_t bc = 0; bc < nb_cols; bc++)
+                count += !is_zero_block(br, bc);
+            row_counts[br] = count;
+        });
+
+        pointers[0] = 0;
+        for (dim_t br = 0; br < nb_rows; br++)
+            pointers[br + 1] = pointers[br] + row_counts[br];
+        if (pointers[nb_rows] > od.nnz_blocks())
+            return status::invalid_arguments;
+
+        // Pass 2: every block row writes its own range of blocks.
+        parallel_nd(nb_rows, [&](dim_t br) {
+            dim_t blk_idx = pointers[br];
+            for (dim_t bc = 0; bc < nb_cols; bc++) {
+                if (is_zero_block(br, bc)) continue;
+                indices[blk_idx] = static_cast<int32_t>(bc);
+                const data_t *s = src + br * rows_blk * row_stride
+                        + bc * cols_blk * col_stride;
+                data_t *v = values + blk_idx * block_size;
+                for_(dim_t r = 0; r < rows_blk; r++)
+                for (dim_t c = 0; c < cols_blk; c++)
+                    v[r * cols_blk + c] = s[r * row_stride + c * col_stride];
+                blk_idx++;
+            }
+        });
+
+        return status::success;
+    }
+
+    status_t execute_coo_to_csr(const exec_ctx_t &ctx) const {
+        using namespace memory_tracking::names;
+
+        const auto *src_values = CTX_IN_MEM(const data_t *, DNNL_ARG_FROM, 0);
+        const auto *src_rows = CTX_IN_MEM(const int32_t *, DNNL_ARG_FROM, 1);
+        const auto *src_cols = CTX_IN_MEM(const int32_t *, DNNL_ARG_FROM, 2);
+        auto *values = CTX_OUT_MEM(data_t *, DNNL_ARG_TO, 0);
+        auto *indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 1);
+        auto *pointers = CTX_OUT_MEM(int32_t *, DNNL_ARG_TO, 2);
+
+        const memory_desc_wrapper id(pd()->src_md());
+        const dim_t nrows = id.dims()[0];
+        const dim_t ncols = id.dims()[1];
+        const dim_t nnz = id.nnz();
+        const dim_t nchunks = pd()->nchunks_;
+
+        const auto &scratchpad = ctx.get_scratchpad_grantor();
+        auto *hist = scratchpad.template get<dim_t>(
+                key_reorder_sparse_sort_hist);
+        auto *keys = scratchpad.template get<dim_t>(
+                key_reorder_sparse_sort_keys);
+        auto *perm = scratchpad.template get<int32_t>(
+                key_reorder_sparse_sort_perm);
+
+        std::atomic<bool> out_of_range(false);
+        parallel_nd(nnz, [&](dim_t i) {
+            const dim_t r = src_rows[i];
+            const dim_t c = src_cols[i];
+            if (r < 0 || r >= nrows || c < 0 || c >= ncols) {
+                out_of_range = true;
+                return;
+            }
+            keys[i] = r * ncols + c;
+            perm[i] = static_cast<int32_t>(i);
+        });
+        if (out_of_range) return status::invalid_arguments;
+
+        dim_t *keys_in = keys, *keys_out = keys + nnz;
+        int32_t *perm_in = perm, *perm_out = perm + nnz;
+        const dim_t max_key = nrows * ncols - 1;
+        for (int shift = 0; (max_key >> shift) > 0; shift += radix_bits) {
+            const auto digit = [&](dim_t key) {
+                return (key >> shift) & (radix - 1);
+            };
+
+            parallel_nd(nchunks, [&](dim_t ic) {
+                dim_t start {0}, end {0};
+                balance211(nnz, nchunks, ic, start, end);
+                dim_t *h = hist + ic * radix;
+                for (dim_t d = 0; d < radix; d++)
+                    h[d] = 0;
+                for (dim_t i = start; i < end; i++)
+                    h[digit(keys_in[i])]++;
+            });
+
+            // Turn the histograms into scatter offsets. Chunks of the same
+            // digit are laid out in the chunks order, so the sort is stable.
+            bool same_digit = false;
+            dim_t offset = 0;
+            for (dim_t d = 0; d < radix; d++) {
+                const dim_t digit_start = offset;
+                for (dim_t ic = 0; ic < nchunks; ic++) {
+                    const dim_t count = hist[ic * radix + d];
+                    hist[ic * radix + d] = offset;
+                    offset += count;
+                }
+                if (offset - digit_start == nnz) same_digit = true;
+            }
+            if (same_digit) continue;
+
+            parallel_nd(nchunks, [&](dim_t ic) {
+                dim_t start {0}, end {0};
+                balance211(nnz, nchunks, ic, start, end);
+                dim_t *h = hist + ic * radix;
+                for (dim_t i = start; i < end; i++) {
+                    const dim_t pos = h[digit(keys_in[i])]++;
+                    keys_out[pos] = keys_in[i];
+                    perm_out[pos] = perm_in[i];
+                }
+            });
+            std::swap(keys_in, keys_out);
+            std::swap(perm_in, perm_out);
+        }
+
+        parallel_nd(nnz, [&](dim_t i) {
+            values[i] = src_values[perm_in[i]];
+            indices[i] = static_cast<int32_t>(keys_in[i] % ncols);
+        });
+        parallel_nd(nrows + 1, [&](dim_t r) {
+            const dim_t *first
+                    = std::lower_bound(keys_in, keys_in + nnz, r * ncols);
+            pointers[r] = static_cast<int32_t>(first - keys_in);
+        });
+
+        return status::success;
+    }
+
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
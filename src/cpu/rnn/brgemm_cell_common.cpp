@@ -130,6 +130,9 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
         };
     }
 
+    assert(IMPLICATION(ithr >= 0,
+            !rnn.is_orig_gru && !rnn.unfused_post_gemm
+                    && !rnn.is_lstm_projection));
     if (rnn.is_orig_gru) {
         using brgemm_gru_t = x64::brgemm_gru_t<src_iter_t, weights_t, scratch_t,
                 gemm_acc_t>;
@@ -206,7 +209,10 @@ rnn_cell_execution_sig((_ref_rnn_common_t<aprop, src_type, weights_type,
         const brgemm_dst_layer_iter_t dst_calc(rnn_brgemm_, rnn, cell_position,
                 src_iter_, src_layer_, w_iter_[0], w_layer_[0], scratch_gates_,
                 amx_scratchpad, addr_batch_global, fused_postgemm);
-        dst_calc.execute();
+        if (ithr >= 0)
+            dst_calc.execute(ithr, nthr);
+        else
+            dst_calc.execute();
     }
 
     if (rnn.unfused_post_gemm) {
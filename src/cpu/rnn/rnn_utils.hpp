@@ -21,6 +21,7 @@
 #include <type_traits>
 
 #include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
 #include "common/memory_desc_wrapper.hpp"
 #include "common/primitive.hpp"
 #include "common/utils.hpp"
@@ -56,6 +57,9 @@
             gemm_acc_t *amx_scratchpad, \
             x64::brgemm_batch_element_t *addr_batch_global) const
 
+// When a cell is executed from within a persistent parallel region (see
+// rnn_conf_t::brgemm_fwd_persistent), ithr and nthr identify the calling
+// thread. Otherwise ithr is -1 and the cell spawns its own parallel region.
 #define rnn_cell_execution_sig(f) \
     dnnl_status_t f(const exec_ctx_t &ctx, const rnn_utils::rnn_conf_t &rnn, \
             rnn_utils::cell_position_t cell_position, dst_layer_t *dst_layer_, \
@@ -75,7 +79,8 @@
             scratch_t *scratch_cell_, scratch_t *scratch_gates_blocked_, \
             scratch_t *scratch_src_layer_, scratch_t *scratch_src_iter_, \
             dst_iter_t *dst_iter_, gemm_acc_t *amx_scratchpad, \
-            x64::brgemm_batch_element_t *addr_batch_global) const
+            x64::brgemm_batch_element_t *addr_batch_global, int ithr, \
+            int nthr) const
 
 #define rnn_grid_execution_sig(f) \
     dnnl_status_t f(const exec_ctx_t &ctx, const rnn_utils::rnn_conf_t &rnn, \
@@ -377,6 +382,8 @@ struct rnn_conf_t {
     bool merge_gemm_iter = false, merge_gemm_layer = false,
          force_nocopy = false, use_layer_packed_gemm = false,
          use_iter_packed_gemm = false, use_projection_packed_gemm = false;
+    // Run the cells of each layer-iteration diagonal concurrently.
+    bool wavefront_exec = false;
     int n_iter_scratch_gates = 0;
 
     bool diff_weights_overwrite = false;
@@ -608,6 +615,10 @@ struct rnn_conf_t {
     bool unfused_post_gemm;
     brgemm_rnn_execute_loop_order_t loop_order
             = brgemm_rnn_execute_loop_order_t::undefined;
+    // Persistent forward execution: each thread computes the same slice of
+    // the gates at every iteration of a layer, so its slice of the weights
+    // stays in cache, and the threads sync with a barrier after each cell.
+    bool brgemm_fwd_persistent = false;
 
     // for merged layer computation in brgemm
     dim_t Mlayermerged;
@@ -890,6 +901,35 @@ bool init_conf(rnn_conf_t &rnn, const rnn_desc_t &rd,
     rnn.use_projection_packed_gemm = false;
 #endif
 
+    /* Decide to run the grid in wavefront order: cell (l, t) depends only on
+     * cells (l - 1, t) and (l, t - 1), so all cells with the same l + t can run
+     * concurrently, one cell per thread. This pays off for small batches,
+     * where a single cell GEMM is too small to occupy all the threads. Each
+     * cell of a diagonal needs its own gates scratchpad, so cells with other
+     * shared scratchpads (GRU, LSTMP) are not supported. Packed GEMMs are
+     * excluded as their layout depends on the number of threads.
+     *
+     * A diagonal keeps at most min(n_layer, n_iter) threads busy, while a
+     * threaded cell GEMM keeps about one thread busy per
+     * `wavefront_min_thr_flops` of work. The wavefront is only used when it
+     * exposes more parallelism than the cell GEMM does. */
+    const int nthr = dnnl_get_max_threads();
+    const dim_t wavefront_min_thr_flops = 1 << 18;
+    const dim_t cell_flops = 2 * rnn.mb * rnn.n_gates * rnn.dhc
+            * (rnn.slc + rnn.sic);
+    const dim_t gemm_par = nstl::min<dim_t>(
+            nthr, nstl::max<dim_t>(1, cell_flops / wavefront_min_thr_flops));
+    const dim_t wavefront_par = nstl::min(rnn.n_layer, rnn.n_iter);
+    rnn.wavefront_exec = !rnn.is_brgemm && is_inference && is_f32
+            && utils::one_of(
+                    rd.cell_kind, alg_kind::vanilla_rnn, alg_kind::vanilla_lstm)
+            && !rnn.is_lstm_projection && !rnn.use_layer_packed_gemm
+            && !rnn.use_iter_packed_gemm && rnn.n_layer > 1 && rnn.n_iter > 1
+            && rnn.mb <= 16 && nthr > 1 && wavefront_par > gemm_par;
+    // The layer GEMM can't be merged across iterations as the iterations of
+    // one layer are spread across diagonals.
+    if (rnn.wavefront_exec) rnn.merge_gemm_layer = false;
+
     /* Set packed gemm sizes */
     /* TODO: investigate the benefit of mixing packed and non-packed weights parts */
     const auto set_pack_sizes
@@ -1084,9 +1124,11 @@ void set_workspace_sizes(rnn_conf_t &rnn, const rnn_desc_t &rd) {
             : (size_t)0;
     rnn.n_iter_scratch_gates
             = (rnn.merge_gemm_layer || rnn.merge_gemm_iter) ? rnn.n_iter : 1;
-    rnn.scratch_gates_size = sizeof(typename T::scratch_t)
-            * rnn.n_iter_scratch_gates * rnn.scratch_gates_nld
-            * rnn.scratch_gates_ld;
+    // With wavefront execution each layer has its own gates scratchpad.
+    const int n_scratch_gates
+            = rnn.wavefront_exec ? rnn.n_layer : rnn.n_iter_scratch_gates;
+    rnn.scratch_gates_size = sizeof(typename T::scratch_t) * n_scratch_gates
+            * rnn.scratch_gates_nld * rnn.scratch_gates_ld;
     rnn.scratch_ht_size
             = sizeof(typename T::ht_t) * rnn.scratch_ht_nld * rnn.scratch_ht_ld;
     rnn.scratch_diff_ht_size = rnn.is_training ? sizeof(typename T::gemm_acc_t)
@@ -40,6 +40,7 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
     auto o_base_ptr = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     if (o_base_ptr == nullptr) return status::success;
 
+    int num_arrs_to_copy = 0;
     for (int a = 0; a < num_arrs; ++a) {
         const memory_desc_wrapper i_d(pd()->src_md(a));
         const memory_desc_wrapper o_d(pd()->src_image_md(a));
@@ -51,6 +52,16 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
         }
         iptrs[a] = iptr + i_d.blk_off(0);
         optrs[a] = o_base_ptr + o_d.blk_off(0);
+        // The source is a view of its image in the dst, which happens when
+        // its producer wrote the result directly into the dst. Nothing to
+        // copy then.
+        if (iptrs[a] == optrs[a]
+                && utils::array_cmp(i_d.blocking_desc().strides,
+                        o_d.blocking_desc().strides, i_d.ndims())) {
+            iptrs[a] = nullptr;
+            nelems_to_copy[a] = 0;
+            continue;
+        }
         nelems_to_copy[a] = pd()->nelems_to_concat(i_d);
         for (int i = 0; i < DNNL_MAX_NDIMS; i++) {
             if (i < perm[concat_dim])
@@ -58,7 +69,9 @@ status_t simple_concat_t<data_type>::execute(const exec_ctx_t &ctx) const {
             else
                 is[a][i] = 0;
         }
+        num_arrs_to_copy++;
     }
+    if (num_arrs_to_copy == 0) return status::success;
 
     const memory_desc_wrapper o_d(pd()->dst_md(0));
 
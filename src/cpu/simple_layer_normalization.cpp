@@ -45,6 +45,7 @@ status_t simple_layer_normalization_fwd_t::pd_t::init(engine_t *engine) {
             && platform::has_data_type_support(src_md()->data_type)
             && platform::has_data_type_support(dst_md()->data_type)
             && stat_md()->data_type == f32 && check_scale_shift_data_type()
+            && !fuse_residual_add()
             && attr()->has_default_values(skip_mask_t::scales_runtime)
             && attr_scales_ok() && set_default_formats_common()
             && src_d.is_blocking_desc()
@@ -106,6 +107,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
     const auto dst_dt = pd()->dst_md()->data_type;
     const auto eps = pd()->desc()->layer_norm_epsilon;
     const auto save_stats = pd()->is_training();
+    const auto skip_mean = pd()->skip_mean();
 
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -115,7 +117,8 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 + N_start * C_padded * src_d.data_type_size();
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
-        float *const __restrict mean_ptr = &mean[N_start];
+        float *const __restrict mean_ptr
+                = skip_mean ? nullptr : &mean[N_start];
         float *const __restrict var_ptr = &variance[N_start];
         const size_t block_size = N_end - N_start;
         // Note: manual unrolling for scale and shift due to clang issue.
@@ -123,13 +126,15 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
         for (size_t offset = 0; offset < block_size; offset++) {
             float v_mean = 0, v_variance = 0;
             if (calculate_stats) {
-                PRAGMA_OMP_SIMD(reduction(+ : v_mean))
-                for (dim_t c = 0; c < C; ++c) {
-                    float s = io::load_float_value(
-                            src_dt, src_ptr, c + C * offset);
-                    v_mean += s;
+                if (!skip_mean) {
+                    PRAGMA_OMP_SIMD(reduction(+ : v_mean))
+                    for (dim_t c = 0; c < C; ++c) {
+                        float s = io::load_float_value(
+                                src_dt, src_ptr, c + C * offset);
+                        v_mean += s;
+                    }
+                    v_mean /= C_f;
                 }
-                v_mean /= C_f;
 
                 PRAGMA_OMP_SIMD(reduction(+ : v_variance))
                 for (dim_t c = 0; c < C; ++c) {
@@ -140,7 +145,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
                 v_variance /= C_f;
             } else {
-                v_mean = mean_ptr[offset];
+                if (!skip_mean) v_mean = mean_ptr[offset];
                 v_variance = var_ptr[offset];
             }
 
@@ -189,7 +194,7 @@ status_t simple_layer_normalization_fwd_t::execute_forward(
                 }
             }
             if (calculate_stats && save_stats) {
-                mean_ptr[offset] = v_mean;
+                if (!skip_mean) mean_ptr[offset] = v_mean;
                 var_ptr[offset] = v_variance;
             }
         }
@@ -279,6 +284,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
     const auto diff_src_dt = pd()->diff_src_md()->data_type;
     const auto eps = pd()->desc()->layer_norm_epsilon;
     const auto calculate_diff_stats = !pd()->stats_are_src();
+    const auto skip_mean = pd()->skip_mean();
 
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -290,7 +296,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
         const char *const __restrict diff_dst_ptr
                 = reinterpret_cast<const char *>(diff_dst)
                 + N_start * C_padded * diff_dst_d.data_type_size();
-        const float *mean_ptr = &mean[N_start];
+        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
         const float *var_ptr = &variance[N_start];
         float *const inv_sqrtvar_ptr = &inv_sqrtvar[N_start];
 
@@ -305,14 +311,15 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
 
         for (size_t offset = 0; offset < block_size; offset++) {
             inv_sqrtvar_ptr[offset] = 1.f / sqrtf(var_ptr[offset] + eps);
+            const float v_mean = skip_mean ? 0.f : mean_ptr[offset];
 
             PRAGMA_OMP_SIMD()
             for (dim_t c = 0; c < C; c++) {
                 const size_t off = c + C * offset;
                 float s = io::load_float_value(src_dt, src_ptr, off);
                 float dd = io::load_float_value(diff_dst_dt, diff_dst_ptr, off);
-                my_diff_gamma[c] += (s - mean_ptr[offset]) * dd
-                        * inv_sqrtvar_ptr[offset];
+                my_diff_gamma[c]
+                        += (s - v_mean) * dd * inv_sqrtvar_ptr[offset];
                 my_diff_beta[c] += dd;
             }
         }
@@ -340,13 +347,14 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                 + N_start * C_padded * diff_dst_d.data_type_size();
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
-        const float *mean_ptr = &mean[N_start];
+        const float *mean_ptr = skip_mean ? nullptr : &mean[N_start];
         float *const inv_sqrtvar_ptr = &inv_sqrtvar[N_start];
 
         // Note: manual unrolling for scale and shift due to clang issue.
         //       see: CLANG_WA_01_SAFE_TO_USE_OMP_SIMD
         float dd_gamma, dd_gamma_x;
         for (size_t offset = 0; offset < block_size; offset++) {
+            const float v_mean = skip_mean ? 0.f : mean_ptr[offset];
             // reduce gamma
             dd_gamma = dd_gamma_x = 0;
             if (calculate_diff_stats) {
@@ -358,7 +366,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                         float dd = io::load_float_value(
                                 diff_dst_dt, diff_dst_ptr, off);
                         dd_gamma += dd * scale[c];
-                        dd_gamma_x += dd * scale[c] * (s - mean_ptr[offset]);
+                        dd_gamma_x += dd * scale[c] * (s - v_mean);
                     }
                 } else {
                     PRAGMA_OMP_SIMD(reduction(+ : dd_gamma, dd_gamma_x))
@@ -368,10 +376,13 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                         float dd = io::load_float_value(
                                 diff_dst_dt, diff_dst_ptr, off);
                         dd_gamma += dd;
-                        dd_gamma_x += dd * (s - mean_ptr[offset]);
+                        dd_gamma_x += dd * (s - v_mean);
                     }
                 }
                 dd_gamma_x *= inv_sqrtvar_ptr[offset];
+                // The mean is not a statistic of RMS normalization, so there
+                // is no gradient flowing through it.
+                if (skip_mean) dd_gamma = 0;
             }
 
             // calculate diff_dst
@@ -385,7 +396,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                     if (calculate_diff_stats) {
                         float s = io::load_float_value(src_dt, src_ptr, off);
                         ds -= dd_gamma / C_f;
-                        ds -= (s - mean_ptr[offset]) * dd_gamma_x
+                        ds -= (s - v_mean) * dd_gamma_x
                                 * inv_sqrtvar_ptr[offset] / C_f;
                     }
                     ds *= inv_sqrtvar_ptr[offset];
@@ -401,7 +412,7 @@ status_t simple_layer_normalization_bwd_t::execute_backward(
                     if (calculate_diff_stats) {
                         float s = io::load_float_value(src_dt, src_ptr, off);
                         ds -= dd_gamma / C_f;
-                        ds -= (s - mean_ptr[offset]) * dd_gamma_x
+                        ds -= (s - v_mean) * dd_gamma_x
                                 * inv_sqrtvar_ptr[offset] / C_f;
                     }
                     ds *= inv_sqrtvar_ptr[offset];
@@ -0,0 +1,101 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_TOPK_UTILS_HPP
+#define CPU_TOPK_UTILS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "common/c_types_map.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace topk_utils {
+
+// A selection candidate: a value converted to f32 and its position along the
+// axis.
+struct entry_t {
+    float val;
+    int32_t idx;
+};
+
+// NaN compares greater than any other value, so that it is selected first by
+// topk_max and last by topk_min. Equal values are ordered by their positions.
+inline bool greater(float a, float b) {
+    if (std::isnan(a)) return !std::isnan(b);
+    if (std::isnan(b)) return false;
+    return a > b;
+}
+
+struct precedes_t {
+    precedes_t(bool is_max) : is_max_(is_max) {}
+    bool operator()(const entry_t &a, const entry_t &b) const {
+        const bool a_gt_b = greater(a.val, b.val);
+        const bool b_gt_a = greater(b.val, a.val);
+        if (a_gt_b || b_gt_a) return is_max_ ? a_gt_b : b_gt_a;
+        return a.idx < b.idx;
+    }
+
+private:
+    bool is_max_;
+};
+
+// A threshold that lets every value through the filter below.
+inline float open_threshold() {
+    return std::numeric_limits<float>::quiet_NaN();
+}
+
+// Returns true if a value found after the entries of a full selection with the
+// worst value `thr` may replace one of them. NaNs always pass, so the check is
+// conservative for topk_min; the exact order is restored by `select()`.
+inline bool passes(float val, float thr, bool is_max) {
+    return is_max ? !(val <= thr) : !(val >= thr);
+}
+
+// Moves the best `k` of `n` entries to the head of `buf` and returns their
+// number. If `sorted` is set, the head is also put in the selection order.
+// `thr` is set to the value of the worst selected entry once `k` entries are
+// selected.
+inline dim_t select(entry_t *buf, dim_t n, dim_t k, bool is_max, bool sorted,
+        float *thr = nullptr) {
+    const precedes_t cmp(is_max);
+    // After nth_element() the worst selected entry is the last one.
+    bool worst_is_last = sorted;
+    if (n > k) {
+        std::nth_element(buf, buf + k - 1, buf + n, cmp);
+        n = k;
+        worst_is_last = true;
+    }
+    if (sorted) std::sort(buf, buf + n, cmp);
+    if (thr) {
+        if (n < k)
+            *thr = open_threshold();
+        else
+            *thr = worst_is_last ? buf[n - 1].val
+                                 : std::max_element(buf, buf + n, cmp)->val;
+    }
+    return n;
+}
+
+} // namespace topk_utils
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
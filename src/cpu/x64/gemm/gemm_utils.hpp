@@ -21,6 +21,7 @@
 
 #include "common/dnnl_thread.hpp"
 #include "common/dnnl_traits.hpp"
+#include "common/nstl.hpp"
 #include "common/utils.hpp"
 
 #include "cpu/x64/gemm/gemm_pack_storage.hpp"
@@ -139,6 +140,37 @@ static inline std::tuple<int, int> calc_nthr_2d(int nthrs, dim_t m, dim_t n,
     return std::make_tuple(nthr_m, nthr_n);
 }
 
+// Partitions a gemv with m outputs and a reduction dimension of size n
+// between at most nthrs threads, so that every thread gets at least
+// min_work matrix elements. The reduction dimension is split as well when
+// the outputs alone cannot keep all the threads busy, at the cost of a final
+// reduction of the partial results, hence the element sizes.
+static inline void calc_nthr_gemv(int nthrs, dim_t m, dim_t n,
+        dim_t unroll_m, dim_t unroll_n, dim_t min_work, size_t a_size,
+        size_t c_size, dim_t &nthr_m, dim_t &nthr_n) {
+    const dim_t nthr_max = nstl::min(
+            dim_t(nthrs), nstl::max(m * n / min_work, dim_t(1)));
+    const dim_t nthr_m_max
+            = nstl::min(nthr_max, utils::div_up(m, unroll_m));
+    const dim_t nthr_n_max = utils::div_up(n, unroll_n);
+
+    nthr_m = 1;
+    nthr_n = 1;
+    dim_t best_cost = -1;
+    for (dim_t nm = 1; nm <= nthr_m_max; nm++) {
+        const dim_t nn = nstl::min(nthr_max / nm, nthr_n_max);
+        const dim_t blk_m = utils::rnd_up(utils::div_up(m, nm), unroll_m);
+        const dim_t blk_n = utils::rnd_up(utils::div_up(n, nn), unroll_n);
+        const dim_t cost = blk_m * blk_n * (dim_t)a_size
+                + (nn - 1) * blk_m * (dim_t)c_size;
+        if (best_cost < 0 || cost < best_cost) {
+            best_cost = cost;
+            nthr_m = nm;
+            nthr_n = nn;
+        }
+    }
+}
+
 template <typename T>
 static inline dim_t get_ld_padd(const dim_t x) {
     return x != 1 ? utils::rnd_up(x, 2048 / sizeof(T)) + (64 / sizeof(T)) : 1;
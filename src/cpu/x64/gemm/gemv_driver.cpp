@@ -391,6 +391,82 @@ void sum_ybufs(
                 y[i * incy] += ybuf[i + buf_id * m];
 }
 
+// Threading driver that splits both the output and the reduction dimensions,
+// so that all the threads take part even when there are few outputs. Partial
+// results of the reduction chunks are summed up at the end.
+template <typename a_t, typename b_t, typename c_t>
+static inline void gemv_2d_threading_driver(const int trans, const dim_t m,
+        const dim_t n, const float alpha, const a_t *a, const dim_t lda,
+        const b_t *x, const dim_t incx, const float beta, c_t *y,
+        const dim_t incy, const gemm_info_t<a_t, b_t, c_t> *arg) {
+    assert(incx > 0 && incy > 0);
+
+    enum { UNROLL_Y = 16, UNROLL_X = 64, MIN_WORK = 1 << 15 };
+
+    const dim_t y_dim = trans == no_trans ? m : n;
+    const dim_t x_dim = trans == no_trans ? n : m;
+
+    dim_t nthr_y = 1, nthr_x = 1;
+    gemm_utils::calc_nthr_gemv(dnnl_get_current_num_threads(), y_dim, x_dim,
+            UNROLL_Y, UNROLL_X, MIN_WORK, sizeof(a_t), sizeof(c_t), nthr_y,
+            nthr_x);
+
+    c_t *ybuf = nullptr;
+    if (nthr_x > 1) {
+        ybuf = (c_t *)malloc(sizeof(*ybuf) * y_dim * (nthr_x - 1), PAGE_4K);
+        // Split the outputs only if there is no memory for partial results.
+        if (ybuf == nullptr) nthr_x = 1;
+    }
+
+    const dim_t blk_y = utils::rnd_up(utils::div_up(y_dim, nthr_y), UNROLL_Y);
+    const dim_t blk_x = utils::rnd_up(utils::div_up(x_dim, nthr_x), UNROLL_X);
+    nthr_y = utils::div_up(y_dim, blk_y);
+    nthr_x = utils::div_up(x_dim, blk_x);
+
+    if (nthr_y * nthr_x == 1) {
+        gemv_kernel_driver(
+                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, arg);
+        free(ybuf);
+        return;
+    }
+
+    parallel_nd(nthr_y * nthr_x, [&](dim_t ithr) {
+        const dim_t ithr_y = ithr / nthr_x;
+        const dim_t ithr_x = ithr % nthr_x;
+        const dim_t off_y = ithr_y * blk_y;
+        const dim_t off_x = ithr_x * blk_x;
+        const dim_t size_y = nstl::min(blk_y, y_dim - off_y);
+        const dim_t size_x = nstl::min(blk_x, x_dim - off_x);
+
+        // The first reduction chunk updates y, the others are written to
+        // their own partial buffers.
+        c_t *y_eff = ithr_x == 0 ? y + off_y * incy
+                                 : ybuf + (ithr_x - 1) * y_dim + off_y;
+        const dim_t incy_eff = ithr_x == 0 ? incy : 1;
+        const float beta_eff = ithr_x == 0 ? beta : 0.0f;
+
+        if (trans == no_trans)
+            gemv_kernel_driver(trans, size_y, size_x, alpha,
+                    a + off_y + off_x * lda, lda, x + off_x * incx, incx,
+                    beta_eff, y_eff, incy_eff, arg);
+        else
+            gemv_kernel_driver(trans, size_x, size_y, alpha,
+                    a + off_x + off_y * lda, lda, x + off_x * incx, incx,
+                    beta_eff, y_eff, incy_eff, arg);
+    });
+
+    if (ybuf) {
+        parallel_nd(utils::div_up(y_dim, (dim_t)UNROLL_Y), [&](dim_t iblk) {
+            const dim_t start = iblk * UNROLL_Y;
+            const dim_t end = nstl::min(start + UNROLL_Y, y_dim);
+            for (dim_t ix = 0; ix < nthr_x - 1; ix++)
+                for (dim_t i = start; i < end; i++)
+                    y[i * incy] += ybuf[ix * y_dim + i];
+        });
+        free(ybuf);
+    }
+}
+
 template <typename a_t, typename b_t, typename c_t>
 static inline void gemv_threading_driver(const int trans, const dim_t m,
         const dim_t n, const float alpha, const a_t *a, const dim_t lda,
@@ -404,6 +480,12 @@ static inline void gemv_threading_driver(const int trans, const dim_t m,
     // Quick return if possible.
     if (m <= 0 || n <= 0) return;
 
+    if (is_bf16 && incx > 0 && incy > 0) {
+        gemv_2d_threading_driver(
+                trans, m, n, alpha, a, lda, x, incx, beta, y, incy, arg);
+        return;
+    }
+
     auto nthr_max = dnnl_get_current_num_threads();
     auto nthr_goal = thread_checker<a_t>(nthr_max, m, n, trans);
 
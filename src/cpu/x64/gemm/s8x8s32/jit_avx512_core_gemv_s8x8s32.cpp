@@ -58,9 +58,10 @@ void gemv_kernel_driver(gemm_info_t<int8_t, b_type, int32_t> *arg) {
 
 template <typename b_type>
 int gemv_threading_driver(gemm_info_t<int8_t, b_type, int32_t> *arg) {
-    dim_t nthr_m, nthr_n = 1;
+    dim_t nthr_m, nthr_n;
     dim_t MB, NB, UM = 16, UN = 64;
-    dim_t BLOCKM = 192, BLOCKN = 3072;
+    // Minimal number of matrix elements per thread.
+    dim_t MIN_WORK = 1 << 16;
     dim_t i;
 
     dim_t nthr = dnnl_get_current_num_threads();
@@ -73,20 +74,15 @@ int gemv_threading_driver(gemm_info_t<int8_t, b_type, int32_t> *arg) {
     gemm_info_t<int8_t, b_type, int32_t> arg_seq = *arg;
     float zero = 0.0f;
 
-    nthr_m = nstl::min(nstl::max(m / BLOCKM, (dim_t)1), nthr);
-    MB = m / nthr_m;
-    MB = (((MB / UM) * UM) == MB) ? MB : (MB / UM) * UM + UM;
-    nthr_m = (((m / MB) * MB) == m) ? m / MB : m / MB + 1;
-    nthr_m = nstl::min(nstl::max(nthr_m, (dim_t)1), nthr);
+    // Split m and, when m is too small to keep all the threads busy, n as
+    // well. Partial results along n are reduced at the end.
+    gemm_utils::calc_nthr_gemv((int)nthr, m, n, UM, UN, MIN_WORK,
+            sizeof(int8_t), sizeof(int32_t), nthr_m, nthr_n);
 
-    while ((nthr_m * (nthr_n + 1) <= nthr) && ((n / (nthr_n + 1)) >= BLOCKN)) {
-        nthr_n++;
-    }
-
-    NB = n / nthr_n;
-    NB = (((NB / UN) * UN) == NB) ? NB : (NB / UN) * UN + UN;
-    nthr_n = (((n / NB) * NB) == n) ? n / NB : n / NB + 1;
-    nthr_n = nstl::min(nstl::max(nthr_n, (dim_t)1), nthr / nthr_m);
+    MB = utils::rnd_up(utils::div_up(m, nthr_m), UM);
+    nthr_m = utils::div_up(m, MB);
+    NB = utils::rnd_up(utils::div_up(n, nthr_n), UN);
+    nthr_n = utils::div_up(n, NB);
 
     nthr = nthr_m * nthr_n;
 
@@ -207,13 +203,14 @@ int gemv_threading_driver(gemm_info_t<int8_t, b_type, int32_t> *arg) {
     });
 
     if (nthr_n > 1) {
-        parallel_nd((int)nthr_m, [&](const dim_t ithr) {
+        // Reduce by blocks of UM elements, so that all the threads take part
+        // even if m is split between a few threads only.
+        parallel_nd(utils::div_up(m, UM), [&](const dim_t jb) {
             dim_t j, j_from, j_to, ii;
             int32_t acc;
 
-            j_from = MB * ithr;
-            j_to = MB * (ithr + 1);
-            if ((j_to > m) || (ithr == nthr - 1)) j_to = m;
+            j_from = UM * jb;
+            j_to = nstl::min(UM * (jb + 1), m);
 
             for (j = j_from; j < j_to; j++) {
                 acc = 0;
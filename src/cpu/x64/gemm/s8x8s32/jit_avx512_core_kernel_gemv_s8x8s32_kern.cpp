@@ -72,8 +72,12 @@ void jit_avx512_core_gemv_s8x8s32_kern::n_loop_body(int nreg_acc, Reg64 A,
     for (int i = 0; i < nreg_A; i++) {
         if (use_mask)
             vmovdqu8(zmm_a(i) | mask_n | T_z, ptr[A + r14]);
-        else
+        else {
             vmovdqu8(zmm_a(i), ptr[A + r14]);
+            // Every row of A is a separate stream, too many for the
+            // hardware prefetcher to follow.
+            prefetcht0(ptr[A + r14 + prefetch_dist_a_]);
+        }
         add(r14, lda);
     }
 
@@ -87,8 +91,10 @@ void jit_avx512_core_gemv_s8x8s32_kern::n_loop_body(int nreg_acc, Reg64 A,
     for (int i = 0; i < nreg_A - (nreg_acc % 2); i++) {
         if (use_mask)
             vmovdqu8(zmm_a(i) | mask_n | T_z, ptr[A + r14]);
-        else
+        else {
             vmovdqu8(zmm_a(i), ptr[A + r14]);
+            prefetcht0(ptr[A + r14 + prefetch_dist_a_]);
+        }
         add(r14, lda);
     }
 
@@ -52,6 +52,8 @@ class jit_avx512_core_gemv_s8x8s32_kern : public jit_generator {
     // Assumes unroll_{m,n} are a power of 2.
     static constexpr unsigned int unroll_m_ = 4; // Unrolling is 2^unroll_m_.
     static constexpr unsigned int unroll_n_ = 6; // Unrolling is 2^unroll_n_.
+    // Distance in bytes at which the rows of A are prefetched.
+    static constexpr int prefetch_dist_a_ = 4 * 64;
 
     enum {
         zmm_a_idx_start = 5,
@@ -97,6 +97,17 @@ bool is_supported(cpu_isa_t isa, const dnnl::impl::memory_desc_t &src1_desc,
             && is_bcast_supported(src1_desc, dst_d, supported_strategy_set);
 }
 
+bool is_select_supported(cpu_isa_t isa, const post_ops_t::entry_t &entry) {
+    if (!entry.is_binary() || entry.binary.alg != alg_kind::binary_select)
+        return true;
+
+    const memory_desc_wrapper src1_d(entry.binary.src1_desc);
+    const memory_desc_wrapper src2_d(entry.binary.src2_desc);
+    return is_superset(isa, avx2) && src2_d.data_type() == data_type::s8
+            && src1_d.similar_to(src2_d, true, false)
+            && src1_d.offset0() == src2_d.offset0();
+}
+
 bool binary_args_broadcast_supported(const post_ops_t &post_ops,
         const memory_desc_wrapper &dst_d,
         const bcast_set_t &supported_strategy_set) {
@@ -379,6 +390,9 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
     const auto rhs_broadcasting_strategy = get_rhs_arg_broadcasting_strategy(
             src1_desc, rhs_arg_static_params_.dst_d, supported_strategy_set_);
     const auto rhs_arg_data_type = src1_desc.data_type;
+    const bool is_select = post_op.is_binary()
+            && post_op.binary.alg == alg_kind::binary_select;
+    assert(IMPLICATION(is_select, is_select_supported(isa, post_op)));
     const auto &vmm_tail_idx = rhs_arg_params.vmm_tail_idx_;
     const bool tail_exists_in_range = !vmm_tail_idx.empty();
     const bool bcast_f32_non_avx512 = !is_avx512_
@@ -395,7 +409,7 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
     const bool dt_helper_vmm_needed
             = !binary_op_with_unaligned_mem_operand_allowed_
             || rhs_arg_data_type != data_type::f32 || bcast_f32_non_avx512
-            || should_preserve_vmm_tail || post_op.is_prelu();
+            || should_preserve_vmm_tail || post_op.is_prelu() || is_select;
     const auto tail_load_mode = rhs_arg_params.tail_load_mode;
     const int simd_w = cpu_isa_traits<isa>::vlen
             / types::data_type_size(dst_d.data_type());
@@ -469,16 +483,19 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
 
     bool vmm0_was_preserved = false;
     static const Vmm zero_vmm(0);
-    if (post_op.is_prelu() && is_avx512_) push_opmask(host_, get_aux_kmask());
+    const bool with_aux_kmask = (post_op.is_prelu() || is_select) && is_avx512_;
+    if (with_aux_kmask) push_opmask(host_, get_aux_kmask());
 
     Xbyak::Address rhs_arg_addr(0);
 
     // Phase 3 Apply binary post-op over all vmms.
     for (const auto vmm_idx : vmm_idxs) {
         const bool is_start_idx = vmm_idx == start_idx;
-        if (is_start_idx
-                || rhs_arg_params_differ(vmm_idx, vmm_idx - 1, rhs_arg_params,
-                        rhs_broadcasting_strategy)) {
+        // Select computes both its addresses by itself.
+        if (!is_select
+                && (is_start_idx
+                        || rhs_arg_params_differ(vmm_idx, vmm_idx - 1,
+                                rhs_arg_params, rhs_broadcasting_strategy))) {
             rhs_arg_addr = prepare_rhs_arg_addr(vmm_idx, rhs_arg_idx, post_op,
                     rhs_arg_params, rhs_broadcasting_strategy, is_start_idx);
         }
@@ -493,11 +510,20 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
                                 == broadcasting_strategy_t::scalar,
                         rhs_arg_static_params_.use_exact_tail_scalar_bcast);
 
+        const auto inject = [&]() {
+            if (is_select)
+                inject_select(post_op, dst_vmm, vmm_idx, rhs_arg_idx,
+                        rhs_arg_params, rhs_broadcasting_strategy, with_tail,
+                        tail_load_mode);
+            else
+                inject_binary(post_op, dst_vmm, rhs_arg_addr, with_tail,
+                        tail_load_mode);
+        };
+
         if (vmm_preservation_needed) {
             const Vmm vmm_to_preserve(local_vmm_preservation.second);
             push_vmm(host_, vmm_to_preserve);
-            inject_binary(
-                    post_op, dst_vmm, rhs_arg_addr, with_tail, tail_load_mode);
+            inject();
             pop_vmm(host_, vmm_to_preserve);
             // in case all Vmm are occupied, Vmm(0) is chosen for tmp by default,
             // so it's content needs to be preserved...
@@ -505,12 +531,11 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
             push_vmm(host_, zero_vmm);
             vmm0_was_preserved = true;
         } else
-            inject_binary(
-                    post_op, dst_vmm, rhs_arg_addr, with_tail, tail_load_mode);
+            inject();
     }
     // ...and restored afterwards
     if (vmm0_was_preserved) pop_vmm(host_, zero_vmm);
-    if (post_op.is_prelu() && is_avx512_) pop_opmask(host_, get_aux_kmask());
+    if (with_aux_kmask) pop_opmask(host_, get_aux_kmask());
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -518,15 +543,17 @@ Xbyak::Address jit_uni_binary_injector_t<isa, Vmm>::prepare_rhs_arg_addr(
         std::size_t vmm_idx, std::size_t rhs_arg_idx,
         const dnnl_post_ops::entry_t &post_op,
         const rhs_arg_dynamic_params_t &rhs_arg_params,
-        const broadcasting_strategy_t rhs_broadcasting_strategy,
-        bool is_first) const {
+        const broadcasting_strategy_t rhs_broadcasting_strategy, bool is_first,
+        bool is_src2) const {
 
     static constexpr auto rhs_arg_ptr_size = sizeof(const void *);
     const auto &rhs_addr_reg = rhs_arg_static_params_.rhs_addr_reg;
     const auto &abi_param_offset = rhs_arg_static_params_.abi_param_offset;
     const auto &rhs_helper_reg = rhs_arg_static_params_.rhs_helper_reg;
-    const auto rhs_arg_elem_size = types::data_type_size(
-            get_src1_desc(post_op, rhs_arg_static_params_.dst_d).data_type);
+    const auto rhs_arg_elem_size = types::data_type_size(is_src2
+                    ? post_op.binary.src2_desc.data_type
+                    : get_src1_desc(post_op, rhs_arg_static_params_.dst_d)
+                              .data_type);
 
     if (is_first) {
         host_->mov(rhs_addr_reg, host_->ptr[param1_ + abi_param_offset]);
@@ -1731,6 +1758,54 @@ void jit_uni_binary_injector_t<isa, Vmm>::inject_binary(
     }
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::inject_select(
+        const dnnl_post_ops::entry_t &post_op, const Vmm &dst,
+        std::size_t vmm_idx, std::size_t rhs_arg_idx,
+        const rhs_arg_dynamic_params_t &rhs_arg_params,
+        const broadcasting_strategy_t rhs_broadcasting_strategy,
+        bool with_tail, const tail_lode_mode_t tail_load_mode) const {
+    const Vmm tmp_vmm = Vmm(rhs_arg_static_params_.rhs_dt_helper_vmm_idx);
+    const auto load = [&](data_type_t data_type, bool is_src2) {
+        // The condition pointer follows the src1 one in the rhs args vector.
+        // Both addresses share the address register, so each is prepared
+        // right before its load.
+        const auto addr = prepare_rhs_arg_addr(vmm_idx,
+                rhs_arg_idx + is_src2, post_op, rhs_arg_params,
+                rhs_broadcasting_strategy, true /*is_first*/, is_src2);
+        if (addr.isBroadcast())
+            execute_broadcast(data_type, tmp_vmm, remove_bcast_bit(addr),
+                    tail_load_mode, with_tail);
+        else
+            load_rhs(data_type, tmp_vmm, addr, tail_load_mode, with_tail);
+    };
+    const auto src1_dt = post_op.binary.src1_desc.data_type;
+    const auto src2_dt = post_op.binary.src2_desc.data_type;
+
+    if (is_avx512_) {
+        const Xbyak::Opmask aux_kmask = get_aux_kmask();
+        load(src2_dt, true);
+        host_->vptestnmd(aux_kmask, tmp_vmm, tmp_vmm);
+        load(src1_dt, false);
+        if (types::is_integral_dt(src1_dt)) cvt_to_f32(tmp_vmm);
+        host_->vmovups(dst | aux_kmask, tmp_vmm);
+    } else {
+        // No opmasks: the blend mask needs one more vector register.
+        int aux_idx = 0;
+        while (utils::one_of(aux_idx, dst.getIdx(), tmp_vmm.getIdx()))
+            aux_idx++;
+        const Vmm aux_vmm = Vmm(aux_idx);
+        push_vmm(host_, aux_vmm);
+        load(src2_dt, true);
+        host_->uni_vpxor(aux_vmm, aux_vmm, aux_vmm);
+        host_->uni_vpcmpeqd(aux_vmm, aux_vmm, tmp_vmm);
+        load(src1_dt, false);
+        if (types::is_integral_dt(src1_dt)) cvt_to_f32(tmp_vmm);
+        host_->uni_vblendvps(dst, dst, tmp_vmm, aux_vmm);
+        pop_vmm(host_, aux_vmm);
+    }
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_injector_t<isa, Vmm>::execute_broadcast(
         const data_type_t &data_type, const Vmm &tmp_reg,
@@ -238,6 +238,12 @@ bool is_supported(cpu_isa_t isa, const dnnl::impl::memory_desc_t &src1_desc,
         const memory_desc_wrapper &dst_d,
         const bcast_set_t &supported_strategy_set);
 
+/*
+ * Checks if binary select post-op is supported. The condition is addressed
+ * with the offsets of src1, hence it has to share src1 dims and strides.
+ */
+bool is_select_supported(cpu_isa_t isa, const post_ops_t::entry_t &entry);
+
 /*
  * Main mechanism responsible for injecting binary postops supporting various
  * isa: sse41, avx, avx2, avx512 with core, bf16 extensions as well as data
@@ -299,13 +305,22 @@ private:
             std::size_t rhs_arg_idx, const dnnl_post_ops::entry_t &post_op,
             const rhs_arg_dynamic_params_t &rhs_arg_params,
             const broadcasting_strategy_t rhs_broadcasting_strategy,
-            bool is_first) const;
+            bool is_first, bool is_src2 = false) const;
     /*
      * Loads data and applies particular binary operation.
      */
     void inject_binary(const dnnl_post_ops::entry_t &post_op, Vmm dst,
             const Xbyak::Address &rhs_addr, bool with_tail,
             const tail_lode_mode_t tail_load_mode) const;
+    /*
+     * Loads the condition and src1 of binary select and blends src1 into
+     * dst where the condition is zero.
+     */
+    void inject_select(const dnnl_post_ops::entry_t &post_op, const Vmm &dst,
+            std::size_t vmm_idx, std::size_t rhs_arg_idx,
+            const rhs_arg_dynamic_params_t &rhs_arg_params,
+            const broadcasting_strategy_t rhs_broadcasting_strategy,
+            bool with_tail, const tail_lode_mode_t tail_load_mode) const;
 
     /*
      * Helper functions responsible for preparing rhs tensor slice address.
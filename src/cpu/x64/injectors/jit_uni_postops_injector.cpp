@@ -119,7 +119,10 @@ void jit_uni_postops_injector_t<isa, Vmm>::compute_vector_range(
         } else if (post_op.is_like_binary()) {
             binary_injector_->compute_vector_range(
                     vmm_idxs, rhs_arg_idx, post_op, rhs_arg_params);
-            ++rhs_arg_idx;
+            // Binary select takes the condition as an extra rhs arg.
+            const bool is_select = post_op.is_binary()
+                    && post_op.binary.alg == alg_kind::binary_select;
+            rhs_arg_idx += is_select ? 2 : 1;
         } else {
             const auto lam = lambda_jit_injectors_.find(post_op.kind);
             if (lam != lambda_jit_injectors_.end()) lam->second();
@@ -225,8 +228,11 @@ bool post_ops_ok(const post_ops_ok_args_t &post_ops_ok_args) {
                     if (entry.is_like_binary()) {
                         assert(dst_d != nullptr && "dst_d is null");
                         return binary_injector::is_supported(isa,
-                                binary_injector::get_src1_desc(entry, *dst_d),
-                                *dst_d, enabled_bcast_strategy);
+                                       binary_injector::get_src1_desc(
+                                               entry, *dst_d),
+                                       *dst_d, enabled_bcast_strategy)
+                                && binary_injector::is_select_supported(
+                                        isa, entry);
                     }
                     break;
                 default: assert(false && "Unhandled post_op type");
@@ -444,6 +444,14 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::pd_t::init(
             && !has_zero_dim_memory() && zero_points_ok() && arg_scales_ok();
     if (!ok) return status::unimplemented;
 
+    // The descriptor allows only the minibatch to be a runtime value. Binary
+    // and prelu post-ops compute their argument offsets from the full dst
+    // dimensions, so they are not supported with it.
+    if (has_runtime_dims_or_strides()
+            && (attr()->post_ops_.find(primitive_kind::binary) != -1
+                    || attr()->post_ops_.find(primitive_kind::prelu) != -1))
+        return status::unimplemented;
+
     CHECK(brgemm_convolution_utils::init_conf(jcp_, use_inversion, isa, *desc(),
             src_md_, weights_md_, dst_md_, bias_md_, attr_,
             dnnl_get_max_threads()));
@@ -1348,8 +1356,15 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
 
     maybe_conv_weights(ctx, wei, wei);
 
+    // The minibatch may be defined only at execution time. The kernels and
+    // the blocking do not depend on it, so it only sets the amount of work.
+    const int MB = static_cast<int>(
+            ctx.memory_mdw(DNNL_ARG_SRC, _pd->src_md()).dims()[0]);
+    if (MB != ctx.memory_mdw(DNNL_ARG_DST, _pd->dst_md()).dims()[0])
+        return status::invalid_arguments;
+
     // --------------- Parallel section ------------------------------
-    const dim_t work_amount = static_cast<dim_t>(jcp.mb) * jcp.ngroups
+    const dim_t work_amount = static_cast<dim_t>(MB) * jcp.ngroups
             * jcp.nb_oc * jcp.nb_od * jcp.nb_oh * jcp.nb_ow;
     // TODO: consider loop by icc be innermost because for current
     // implementation if we use buffer then we accumulate in it only on row
@@ -1394,10 +1409,10 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
         balance211(work_amount, nthr, ithr, start, end);
         int n {0}, g {0}, ocb {0}, odb {0}, ohb {0}, owb {0};
         if (jcp.loop_order == loop_ndhwgc)
-            nd_iterator_init(start, n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh,
+            nd_iterator_init(start, n, MB, odb, jcp.nb_od, ohb, jcp.nb_oh,
                     owb, jcp.nb_ow, g, jcp.ngroups, ocb, jcp.nb_oc);
         else if (jcp.loop_order == loop_ngcdhw)
-            nd_iterator_init(start, n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc,
+            nd_iterator_init(start, n, MB, g, jcp.ngroups, ocb, jcp.nb_oc,
                     odb, jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow);
         else
             assert(!"Unknown loop order");
@@ -1456,10 +1471,10 @@ status_t brgemm_convolution_fwd_t<isa, use_inversion>::execute(
                 last_btc.owb = owb;
             }
             if (jcp.loop_order == loop_ndhwgc)
-                nd_iterator_step(n, jcp.mb, odb, jcp.nb_od, ohb, jcp.nb_oh, owb,
+                nd_iterator_step(n, MB, odb, jcp.nb_od, ohb, jcp.nb_oh, owb,
                         jcp.nb_ow, g, jcp.ngroups, ocb, jcp.nb_oc);
             else if (jcp.loop_order == loop_ngcdhw)
-                nd_iterator_step(n, jcp.mb, g, jcp.ngroups, ocb, jcp.nb_oc, odb,
+                nd_iterator_step(n, MB, g, jcp.ngroups, ocb, jcp.nb_oc, odb,
                         jcp.nb_od, ohb, jcp.nb_oh, owb, jcp.nb_ow);
             else
                 assert(!"Unknown loop order");
@@ -53,6 +53,8 @@ bool allow_perf_heuristics(const jit_brgemm_conv_conf_t &jcp) {
     // Disable performance heuristics for f16 as there are no other
     // optimized implementations.
     if (jcp.wei_dt == f16) return false;
+    // Other implementations do not support a runtime minibatch.
+    if (jcp.is_runtime_mb) return false;
     return true;
 }
 } // namespace
@@ -1572,7 +1574,10 @@ status_t init_jcp(jit_brgemm_conv_conf_t &jcp, cpu_isa_t isa,
     jcp.ndims = ndims;
     jcp.prop_kind = cd.prop_kind;
     jcp.ngroups = with_groups ? weights_d.dims()[0] : 1;
-    jcp.mb = src_d.dims()[0];
+    // A runtime minibatch is known only at execution time, so the blocking is
+    // chosen as for a single image.
+    jcp.is_runtime_mb = is_runtime_value(src_d.dims()[0]);
+    jcp.mb = jcp.is_runtime_mb ? 1 : src_d.dims()[0];
     jcp.oc_without_padding = dst_d.dims()[1];
     jcp.oc = jcp.oc_without_padding / jcp.ngroups;
     jcp.ic_without_padding = src_d.dims()[1] / jcp.ngroups;
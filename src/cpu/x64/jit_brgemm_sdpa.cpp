@@ -0,0 +1,711 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <float.h>
+
+#include "common/bfloat16.hpp"
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/injectors/jit_uni_eltwise_injector.hpp"
+#include "cpu/x64/jit_brgemm_sdpa.hpp"
+#include "cpu/x64/jit_generator.hpp"
+#include "cpu/x64/utils/jit_io_helper.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+namespace sdpa_impl {
+using namespace Xbyak;
+
+template <cpu_isa_t isa>
+struct jit_sdpa_softmax_kernel_t : public jit_sdpa_softmax_kernel_base_t,
+                                   public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_sdpa_softmax_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    const AddressFrame &vmmword
+            = is_superset(isa, avx512_core) ? zword : yword;
+    static constexpr dim_t simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    jit_sdpa_softmax_kernel_t(const jit_sdpa_conf_t &jsp, dim_t n)
+        : jit_sdpa_softmax_kernel_base_t(jsp, n)
+        , jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+        , n_simd_(div_up(n, simd_w_))
+        , tail_(n % simd_w_)
+        , with_mask_(jsp.mask_dt != data_type::undef) {
+        typename io::jit_io_multi_dt_helper_t<Vmm>::data_types_t dts {
+                f32, jsp.qkv_dt};
+        if (with_mask_) dts.insert(jsp.mask_dt);
+
+        io::io_conf_t io_conf;
+        io::io_tail_conf_t io_tail_conf(simd_w_, tail_, tail_opmask_idx_,
+                tail_vmask.getIdx(), reg_tmp);
+        io_ = io::jit_io_multi_dt_helper_t<Vmm>(
+                this, isa, dts, io_conf, io_tail_conf);
+    }
+
+    void operator()(const call_params_t *p) const override {
+        return jit_generator::operator()(p);
+    }
+
+    status_t create_kernel() override { return jit_generator::create_kernel(); }
+
+private:
+    const dim_t n_simd_;
+    const dim_t tail_;
+    const bool with_mask_;
+
+    io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector_;
+
+    Reg64 reg_param = abi_param1;
+    Reg64 reg_exp_injector_table = rax;
+    Reg64 reg_scores = r8;
+    Reg64 reg_probs = r9;
+    Reg64 reg_mask = r10;
+    Reg64 reg_tmp = r11;
+    Reg64 reg_max = r12;
+    Reg64 reg_sum = r13;
+    Reg64 reg_alpha = r14;
+
+    Opmask injector_mask = Opmask(1);
+    const int tail_opmask_idx_ = 2;
+    Opmask tail_opmask = Opmask(tail_opmask_idx_);
+
+    Vmm tail_vmask = Vmm(0);
+    Vmm vscore = Vmm(1);
+    Vmm vtmp = Vmm(2);
+    Vmm vmax = Vmm(3);
+    Vmm vsum = Vmm(4);
+    Vmm vscale = Vmm(5);
+    Vmm vmax_new = Vmm(6);
+    Vmm vneg_flt_max = Vmm(7);
+    Vmm valpha = Vmm(8);
+
+    Address scores_ptr(dim_t i) {
+        return vmmword[reg_scores + i * simd_w_ * sizeof(float)];
+    }
+    Address probs_ptr(dim_t i) {
+        return vmmword[reg_probs
+                + i * simd_w_ * types::data_type_size(jsp_.qkv_dt)];
+    }
+    Address mask_ptr(dim_t i) {
+        return vmmword[reg_mask
+                + i * simd_w_ * types::data_type_size(jsp_.mask_dt)];
+    }
+
+    enum class op_t : unsigned { max, sum };
+
+    void perform_op(Vmm v, Vmm vtmp, op_t op) {
+        if (op == op_t::max)
+            uni_vmaxps(v, v, vtmp);
+        else if (op == op_t::sum)
+            uni_vaddps(v, v, vtmp);
+    }
+
+    void get_horizontal_op(const Vmm &vsrc, const Vmm &vtmp, op_t op) {
+        const Zmm &zsrc = Zmm(vsrc.getIdx());
+        const Zmm &ztmp = Zmm(vtmp.getIdx());
+        const Ymm &ysrc = Ymm(vsrc.getIdx());
+        const Ymm &ytmp = Ymm(vtmp.getIdx());
+
+        if (is_superset(isa, avx512_core)) {
+            vshuff32x4(ztmp, zsrc, zsrc, 0x4E); // 256-bit shuffle
+            perform_op(vsrc, vtmp, op);
+            vshuff32x4(ztmp, zsrc, zsrc, 0xB1); // 128/256-bit shuffle
+            perform_op(vsrc, vtmp, op);
+        } else {
+            vperm2f128(ytmp, ysrc, ysrc, 0x1); // 128/256-bit shuffle
+            perform_op(vsrc, vtmp, op);
+        }
+        uni_vshufps(vtmp, vsrc, vsrc, 0x4E); // 64/128-bit shuffle
+        perform_op(vsrc, vtmp, op);
+        uni_vshufps(vtmp, vsrc, vsrc, 0xB1); // 32/64-bit shuffle
+        perform_op(vsrc, vtmp, op);
+    }
+
+    void uni_vmaxps_maybe_tail(const Vmm &v1, const Vmm &v2, bool tail) {
+        if (!tail) {
+            uni_vmaxps(v1, v1, v2);
+        } else if (is_superset(isa, avx512_core)) {
+            uni_vmaxps(v1 | tail_opmask, v1, v2);
+        } else {
+            uni_vblendvps(v2, vneg_flt_max, v2, tail_vmask);
+            uni_vmaxps(v1, v1, v2);
+        }
+    }
+
+    void uni_vaddps_maybe_tail(const Vmm &v1, const Vmm &v2, bool tail) {
+        if (!tail) {
+            uni_vaddps(v1, v1, v2);
+        } else if (is_superset(isa, avx512_core)) {
+            uni_vaddps(v1 | tail_opmask, v1, v2);
+        } else {
+            uni_vpxor(vtmp, vtmp, vtmp);
+            uni_vblendvps(vtmp, vtmp, v2, tail_vmask);
+            uni_vaddps(v1, v1, vtmp);
+        }
+    }
+
+    void load_params() {
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+        mov(reg_scores, ptr[reg_param + PARAM_OFF(scores)]);
+        mov(reg_probs, ptr[reg_param + PARAM_OFF(probs)]);
+        if (with_mask_) mov(reg_mask, ptr[reg_param + PARAM_OFF(mask)]);
+        mov(reg_max, ptr[reg_param + PARAM_OFF(max)]);
+        mov(reg_sum, ptr[reg_param + PARAM_OFF(sum)]);
+        mov(reg_alpha, ptr[reg_param + PARAM_OFF(alpha)]);
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(scale)]);
+        uni_vbroadcastss(vscale, ptr[reg_tmp]);
+#undef PARAM_OFF
+
+        mov(reg_tmp, float2int(-FLT_MAX));
+        uni_vmovq(Xmm(vneg_flt_max.getIdx()), reg_tmp);
+        uni_vbroadcastss(vneg_flt_max, Xmm(vneg_flt_max.getIdx()));
+    }
+
+    // Scales and masks the scores in place and finds their maximum.
+    void compute_max() {
+        uni_vmovups(vmax, vneg_flt_max);
+        for (dim_t i = 0; i < n_simd_; i++) {
+            const bool tail = tail_ && i == n_simd_ - 1;
+            io_[f32]->load(scores_ptr(i), vscore, tail);
+            uni_vmulps(vscore, vscore, vscale);
+            if (with_mask_) {
+                io_[jsp_.mask_dt]->load(mask_ptr(i), vtmp, tail);
+                uni_vaddps(vscore, vscore, vtmp);
+            }
+            io_[f32]->store(vscore, scores_ptr(i), tail);
+            uni_vmaxps_maybe_tail(vmax, vscore, tail);
+        }
+        get_horizontal_op(vmax, vtmp, op_t::max);
+    }
+
+    // Updates the running maximum and computes the correction factor for the
+    // values accumulated so far.
+    void update_max() {
+        uni_vbroadcastss(valpha, ptr[reg_max]);
+        uni_vmaxps(vmax_new, valpha, vmax);
+        uni_vsubps(valpha, valpha, vmax_new);
+        exp_injector_->compute_vector(valpha.getIdx());
+        uni_vmovss(ptr[reg_max], Xmm(vmax_new.getIdx()));
+        uni_vmovss(ptr[reg_alpha], Xmm(valpha.getIdx()));
+    }
+
+    void compute_probs() {
+        uni_vpxor(vsum, vsum, vsum);
+        for (dim_t i = 0; i < n_simd_; i++) {
+            const bool tail = tail_ && i == n_simd_ - 1;
+            io_[f32]->load(scores_ptr(i), vscore, tail);
+            uni_vsubps(vscore, vscore, vmax_new);
+            exp_injector_->compute_vector(vscore.getIdx());
+            uni_vaddps_maybe_tail(vsum, vscore, tail);
+            io_[jsp_.qkv_dt]->store(vscore, probs_ptr(i), tail);
+        }
+        get_horizontal_op(vsum, vtmp, op_t::sum);
+
+        // l = l * alpha + sum(p)
+        uni_vbroadcastss(vtmp, ptr[reg_sum]);
+        uni_vfmadd213ps(vtmp, valpha, vsum);
+        uni_vmovss(ptr[reg_sum], Xmm(vtmp.getIdx()));
+    }
+
+    void generate() override {
+        exp_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
+                alg_kind::eltwise_exp, 0.0f, 0.0f, 1.0f, true,
+                reg_exp_injector_table, injector_mask));
+
+        preamble();
+        io_.init_bf16();
+        exp_injector_->load_table_addr();
+        if (tail_) io_.prepare_tail_mask();
+        load_params();
+        compute_max();
+        update_max();
+        compute_probs();
+        postamble();
+        exp_injector_->prepare_table();
+    }
+};
+
+jit_sdpa_softmax_kernel_base_t *jit_sdpa_softmax_kernel_base_t::create(
+        const jit_sdpa_conf_t &jsp, dim_t n, const cpu_isa_t isa) {
+#define HANDLE_ISA(isa_) \
+    if ((isa_) == isa) return new jit_sdpa_softmax_kernel_t<isa_>(jsp, n)
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
+    REG_AVX512_ISA(HANDLE_ISA(avx512_core));
+    REG_AVX2_ISA(HANDLE_ISA(avx2));
+#undef HANDLE_ISA
+    assert(!"kernel is empty.");
+    return nullptr;
+}
+
+} // namespace sdpa_impl
+
+namespace {
+
+// Returns the offset of the first element of the matrix that corresponds to
+// the `mb`-th batch. Dimensions of size one are broadcast.
+dim_t batch_offset(const memory_desc_wrapper &mdw, dim_t mb,
+        const dims_t batch_dims, int batch_ndims) {
+    dims_t pos = {0};
+    utils::l_dims_by_l_offset(pos, mb, batch_dims, batch_ndims);
+    for (int d = 0; d < batch_ndims; d++)
+        if (mdw.dims()[d] == 1) pos[d] = 0;
+    return mdw.off_v(pos);
+}
+
+// Copies a `rows` x `cols` matrix with arbitrary strides into a row-major
+// buffer. With `vnni` set, pairs of consecutive rows are interleaved and the
+// odd row count is padded with zeros.
+template <typename data_t>
+void pack_matrix(data_t *dst, const data_t *src, dim_t rows, dim_t cols,
+        dim_t ld_dst, dim_t row_stride, dim_t col_stride, bool vnni,
+        dim_t r) {
+    if (!vnni) {
+        for (dim_t c = 0; c < cols; c++)
+            dst[r * ld_dst + c] = src[r * row_stride + c * col_stride];
+        return;
+    }
+    // Processes the pair of rows {2 * r, 2 * r + 1}.
+    data_t *d = dst + r * ld_dst * 2;
+    const dim_t r0 = 2 * r, r1 = 2 * r + 1;
+    for (dim_t c = 0; c < cols; c++) {
+        d[2 * c] = src[r0 * row_stride + c * col_stride];
+        d[2 * c + 1] = r1 < rows ? src[r1 * row_stride + c * col_stride]
+                                 : data_t(0);
+    }
+    for (dim_t c = cols; c < ld_dst; c++)
+        d[2 * c] = d[2 * c + 1] = data_t(0);
+}
+
+} // namespace
+
+template <cpu_isa_t isa>
+status_t jit_brgemm_sdpa_t<isa>::pd_t::init(engine_t *engine) {
+    const data_type_t qkv_dt = isa == avx512_core_bf16 ? bf16 : f32;
+
+    VDISPATCH_SDPA(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_SDPA(everyone_is(qkv_dt, qry_md()->data_type,
+                           key_md()->data_type, val_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(one_of(dst_md()->data_type, qkv_dt, f32),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_mask(),
+                           one_of(attn_mask_md()->data_type, qkv_dt, f32)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(IMPLICATION(with_attn_scale(),
+                           one_of(desc()->scale_dt, f32, bf16, f16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_SDPA(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_SDPA(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_SDPA(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+
+    const memory_desc_wrapper q_d(qry_md()), k_d(key_md()), v_d(val_md()),
+            dst_d(dst_md()), mask_d(attn_mask_md());
+    const int c = dst_d.ndims() - 1;
+    for (const auto *mdw : {&q_d, &k_d, &v_d, &dst_d}) {
+        VDISPATCH_SDPA(!mdw->has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VDISPATCH_SDPA(mdw->is_plain(), VERBOSE_UNSUPPORTED_TAG);
+    }
+    // Rows of queries, values and destination are consumed by brgemm as is.
+    VDISPATCH_SDPA(everyone_is(1, q_d.blocking_desc().strides[c],
+                           v_d.blocking_desc().strides[c],
+                           dst_d.blocking_desc().strides[c]),
+            VERBOSE_NONTRIVIAL_STRIDE);
+    if (with_attn_mask()) {
+        VDISPATCH_SDPA(!mask_d.has_runtime_dims_or_strides(),
+                VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+        VDISPATCH_SDPA(mask_d.is_plain(), VERBOSE_UNSUPPORTED_TAG);
+        VDISPATCH_SDPA(mask_d.dims()[c] == 1
+                        || mask_d.blocking_desc().strides[c] == 1,
+                VERBOSE_NONTRIVIAL_STRIDE);
+    }
+    VDISPATCH_SDPA(IMPLICATION(qkv_dt == bf16, desc()->head_size() % 2 == 0),
+            VERBOSE_BAD_DIM, "head_size", c);
+
+    CHECK(init_conf());
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_brgemm_sdpa_t<isa>::pd_t::init_conf() {
+    auto &jsp = jsp_;
+
+    const memory_desc_wrapper q_d(qry_md()), k_d(key_md()), v_d(val_md()),
+            mask_d(attn_mask_md());
+    const int ndims = q_d.ndims();
+    const int r = ndims - 2, c = ndims - 1;
+
+    jsp.MB = desc()->batch_size();
+    jsp.Sq = desc()->queries();
+    jsp.Sk = desc()->keys();
+    jsp.D = desc()->head_size();
+    jsp.Dv = desc()->values();
+    jsp.nthr = dnnl_get_max_threads();
+
+    jsp.qkv_dt = qry_md()->data_type;
+    jsp.dst_dt = dst_md()->data_type;
+    // A mask that is broadcast over keys adds the same value to a whole row of
+    // scores and does not change the softmax output.
+    const bool with_mask = with_attn_mask() && mask_d.dims()[c] != 1;
+    jsp.mask_dt = with_mask ? mask_d.data_type() : data_type::undef;
+    jsp.mask_ld = with_mask && mask_d.dims()[r] != 1
+            ? mask_d.blocking_desc().strides[r]
+            : 0;
+
+    const bool is_bf16 = jsp.qkv_dt == bf16;
+    const dim_t vnni_granularity = is_bf16 ? 2 : 1;
+
+    // Keep at least a few query blocks per thread when possible.
+    const dim_t q_blk_max = 32;
+    jsp.q_blk = nstl::min(jsp.Sq, q_blk_max);
+    if (jsp.MB * div_up(jsp.Sq, jsp.q_blk) < 2 * jsp.nthr)
+        jsp.q_blk = nstl::min(jsp.q_blk, q_blk_max / 2);
+    jsp.nb_q = div_up(jsp.Sq, jsp.q_blk);
+    jsp.q_tail = jsp.Sq % jsp.q_blk;
+
+    const dim_t k_blk_max = 128;
+    jsp.k_blk = nstl::min(jsp.Sk, k_blk_max);
+    jsp.k_blk_pad = rnd_up(jsp.k_blk, vnni_granularity);
+    jsp.nb_k = div_up(jsp.Sk, jsp.k_blk);
+    jsp.k_tail = jsp.Sk % jsp.k_blk;
+    jsp.Sk_pad = rnd_up(jsp.Sk, vnni_granularity);
+
+    jsp.pack_keys = is_bf16 || k_d.blocking_desc().strides[c] != 1;
+    jsp.pack_values = is_bf16;
+
+    jsp.lda_q = q_d.blocking_desc().strides[r];
+    jsp.ldb_k = jsp.pack_keys ? jsp.Sk_pad : k_d.blocking_desc().strides[r];
+    jsp.ldb_v = jsp.pack_values ? jsp.Dv : v_d.blocking_desc().strides[r];
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_brgemm_sdpa_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &jsp = jsp_;
+    const dim_t vnni_granularity = jsp.qkv_dt == bf16 ? 2 : 1;
+
+    for_(bool m_tail : {false, true})
+    for (bool nk_tail : {false, true}) {
+        const dim_t M = m_tail ? jsp.q_tail : jsp.q_blk;
+        const dim_t N = nk_tail ? jsp.k_tail : jsp.k_blk;
+        if (M == 0 || N == 0) continue;
+
+        const int idx = get_brg_idx(m_tail, nk_tail);
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+
+        // scores = Q * K
+        brgemm_t &brg_qk = brg_qk_descs_[idx];
+        CHECK(brgemm_desc_init(&brg_qk, isa, brgemm_addr, jsp.qkv_dt,
+                jsp.qkv_dt, false, false, brgemm_row_major, 1.0f, 0.0f,
+                jsp.lda_q, jsp.ldb_k, jsp.k_blk, M, N, jsp.D));
+        CHECK(brgemm_desc_set_attr(&brg_qk, brgattr));
+
+        // acc += P * V
+        brgemm_t &brg_pv = brg_pv_descs_[idx];
+        CHECK(brgemm_desc_init(&brg_pv, isa, brgemm_addr, jsp.qkv_dt,
+                jsp.qkv_dt, false, false, brgemm_row_major, 1.0f, 1.0f,
+                jsp.k_blk_pad, jsp.ldb_v, jsp.Dv, M, jsp.Dv,
+                rnd_up(N, vnni_granularity)));
+        CHECK(brgemm_desc_set_attr(&brg_pv, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_t<isa>::pd_t::init_scratchpad() {
+    const auto &jsp = jsp_;
+    const size_t qkv_dt_size = types::data_type_size(jsp.qkv_dt);
+    auto scratchpad = scratchpad_registry().registrar();
+
+    if (jsp.pack_keys)
+        scratchpad.book(key_sdpa_keys_packed,
+                jsp.MB * rnd_up(jsp.D, 2) * jsp.Sk_pad, qkv_dt_size);
+    if (jsp.pack_values)
+        scratchpad.book(key_sdpa_values_packed, jsp.MB * jsp.Sk_pad * jsp.Dv,
+                qkv_dt_size);
+
+    scratchpad.template book<float>(
+            key_sdpa_scores, jsp.nthr * jsp.q_blk * jsp.k_blk);
+    scratchpad.book(key_sdpa_probs, jsp.nthr * jsp.q_blk * jsp.k_blk_pad,
+            qkv_dt_size);
+    scratchpad.template book<float>(
+            key_sdpa_acc, jsp.nthr * jsp.q_blk * jsp.Dv);
+    // Running maximum, running sum and correction factor for every row.
+    scratchpad.template book<float>(key_sdpa_stats, jsp.nthr * 3 * jsp.q_blk);
+}
+
+template <cpu_isa_t isa>
+status_t jit_brgemm_sdpa_t<isa>::init(engine_t *engine) {
+    const auto &jsp = pd()->jsp_;
+
+    for (int idx = 0; idx < 4; idx++) {
+        const bool m_tail = idx / 2, nk_tail = idx % 2;
+        const dim_t M = m_tail ? jsp.q_tail : jsp.q_blk;
+        const dim_t N = nk_tail ? jsp.k_tail : jsp.k_blk;
+        if (M == 0 || N == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_qk_descs_[idx]));
+        CHECK(safe_ptr_assign(brg_qk_kernels_[idx], ker));
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_pv_descs_[idx]));
+        CHECK(safe_ptr_assign(brg_pv_kernels_[idx], ker));
+    }
+
+    for (bool nk_tail : {false, true}) {
+        const dim_t N = nk_tail ? jsp.k_tail : jsp.k_blk;
+        if (N == 0) continue;
+        CHECK(safe_ptr_assign(softmax_kernels_[nk_tail],
+                sdpa_impl::jit_sdpa_softmax_kernel_base_t::create(
+                        jsp, N, isa)));
+        CHECK(softmax_kernels_[nk_tail]->create_kernel());
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_t<isa>::pack_keys(
+        const char *key, char *key_packed) const {
+    const auto &jsp = pd()->jsp_;
+    const memory_desc_wrapper k_d(pd()->key_md());
+    const int ndims = k_d.ndims();
+    const dim_t ks_r = k_d.blocking_desc().strides[ndims - 2];
+    const dim_t ks_c = k_d.blocking_desc().strides[ndims - 1];
+    const size_t dt_size = k_d.data_type_size();
+    const bool vnni = jsp.qkv_dt == bf16;
+    const dim_t nrows = vnni ? div_up(jsp.D, 2) : jsp.D;
+    const dim_t batch_size = rnd_up(jsp.D, 2) * jsp.Sk_pad;
+
+    parallel_nd(jsp.MB, nrows, [&](dim_t mb, dim_t row) {
+        const char *src = key
+                + batch_offset(k_d, mb, pd()->dst_md()->dims, ndims - 2)
+                        * dt_size;
+        char *dst = key_packed + mb * batch_size * dt_size;
+        if (vnni)
+            pack_matrix((uint16_t *)dst, (const uint16_t *)src, jsp.D, jsp.Sk,
+                    jsp.Sk_pad, ks_r, ks_c, true, row);
+        else
+            pack_matrix((float *)dst, (const float *)src, jsp.D, jsp.Sk,
+                    jsp.Sk_pad, ks_r, ks_c, false, row);
+    });
+}
+
+template <cpu_isa_t isa>
+void jit_brgemm_sdpa_t<isa>::pack_values(
+        const char *val, char *val_packed) const {
+    const auto &jsp = pd()->jsp_;
+    const memory_desc_wrapper v_d(pd()->val_md());
+    const int ndims = v_d.ndims();
+    const dim_t vs_r = v_d.blocking_desc().strides[ndims - 2];
+    const size_t dt_size = v_d.data_type_size();
+    const dim_t batch_size = jsp.Sk_pad * jsp.Dv;
+
+    parallel_nd(jsp.MB, jsp.Sk_pad / 2, [&](dim_t mb, dim_t row) {
+        const char *src = val
+                + batch_offset(v_d, mb, pd()->dst_md()->dims, ndims - 2)
+                        * dt_size;
+        char *dst = val_packed + mb * batch_size * dt_size;
+        pack_matrix((uint16_t *)dst, (const uint16_t *)src, jsp.Sk, jsp.Dv,
+                jsp.Dv, vs_r, 1, true, row);
+    });
+}
+
+template <cpu_isa_t isa>
+status_t jit_brgemm_sdpa_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto qry = CTX_IN_MEM(const char *, DNNL_ARG_QUERIES);
+    const auto key = CTX_IN_MEM(const char *, DNNL_ARG_KEYS);
+    const auto val = CTX_IN_MEM(const char *, DNNL_ARG_VALUES);
+    const auto msk = CTX_IN_MEM(const char *, DNNL_ARG_ATTN_MASK);
+    const auto scl = CTX_IN_MEM(const void *, DNNL_ARG_SCALE);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const auto &jsp = pd()->jsp_;
+    const auto *desc = pd()->desc();
+    const memory_desc_wrapper q_d(pd()->qry_md()), k_d(pd()->key_md()),
+            v_d(pd()->val_md()), dst_d(pd()->dst_md()),
+            mask_d(pd()->attn_mask_md());
+    const int ndims = dst_d.ndims();
+    const int batch_ndims = ndims - 2;
+    const dims_t &batch_dims = dst_d.dims();
+    const dim_t dst_ld = dst_d.blocking_desc().strides[ndims - 2];
+
+    const size_t qkv_dt_size = types::data_type_size(jsp.qkv_dt);
+    const size_t dst_dt_size = types::data_type_size(jsp.dst_dt);
+    const size_t mask_dt_size = jsp.mask_dt != data_type::undef
+            ? types::data_type_size(jsp.mask_dt)
+            : 0;
+    const bool is_bf16 = jsp.qkv_dt == bf16;
+
+    float scale = 1.f;
+    if (pd()->with_attn_scale()) {
+        scale = cpu::io::load_float_value(desc->scale_dt, scl, 0);
+        if (desc->invert_scale) scale = 1.f / scale;
+    }
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    char *key_packed = scratchpad.template get<char>(key_sdpa_keys_packed);
+    char *val_packed = scratchpad.template get<char>(key_sdpa_values_packed);
+    float *scores_base = scratchpad.template get<float>(key_sdpa_scores);
+    char *probs_base = scratchpad.template get<char>(key_sdpa_probs);
+    float *acc_base = scratchpad.template get<float>(key_sdpa_acc);
+    float *stats_base = scratchpad.template get<float>(key_sdpa_stats);
+
+    // Keys and values are shared by all the query blocks of a batch, so they
+    // are packed once upfront.
+    if (jsp.pack_keys) pack_keys(key, key_packed);
+    if (jsp.pack_values) pack_values(val, val_packed);
+    const dim_t keys_batch_size = rnd_up(jsp.D, 2) * jsp.Sk_pad;
+    const dim_t vals_batch_size = jsp.Sk_pad * jsp.Dv;
+
+    parallel_nd_ext(jsp.nthr, jsp.MB, jsp.nb_q,
+            [&](int ithr, int, dim_t mb, dim_t qb) {
+                float *scores = scores_base + ithr * jsp.q_blk * jsp.k_blk;
+                char *probs = probs_base
+                        + ithr * jsp.q_blk * jsp.k_blk_pad * qkv_dt_size;
+                float *acc = acc_base + ithr * jsp.q_blk * jsp.Dv;
+                float *max = stats_base + ithr * 3 * jsp.q_blk;
+                float *sum = max + jsp.q_blk;
+                float *alpha = sum + jsp.q_blk;
+
+                const dim_t q0 = qb * jsp.q_blk;
+                const bool m_tail = q0 + jsp.q_blk > jsp.Sq;
+                const dim_t M = m_tail ? jsp.q_tail : jsp.q_blk;
+
+                const char *q_ptr = qry
+                        + (batch_offset(q_d, mb, batch_dims, batch_ndims)
+                                  + q0 * jsp.lda_q)
+                                * qkv_dt_size;
+                const char *k_ptr = jsp.pack_keys
+                        ? key_packed + mb * keys_batch_size * qkv_dt_size
+                        : key
+                                + batch_offset(
+                                          k_d, mb, batch_dims, batch_ndims)
+                                        * qkv_dt_size;
+                const char *v_ptr = jsp.pack_values
+                        ? val_packed + mb * vals_batch_size * qkv_dt_size
+                        : val
+                                + batch_offset(
+                                          v_d, mb, batch_dims, batch_ndims)
+                                        * qkv_dt_size;
+                const char *mask_ptr = mask_dt_size
+                        ? msk
+                                + (batch_offset(mask_d, mb, batch_dims,
+                                           batch_ndims)
+                                          + q0 * jsp.mask_ld)
+                                        * mask_dt_size
+                        : nullptr;
+
+                for (dim_t i = 0; i < M; i++) {
+                    max[i] = -FLT_MAX;
+                    sum[i] = 0.f;
+                }
+                for (dim_t i = 0; i < M * jsp.Dv; i++)
+                    acc[i] = 0.f;
+
+                brgemm_batch_element_t batch;
+                for (dim_t kb = 0; kb < jsp.nb_k; kb++) {
+                    const dim_t k0 = kb * jsp.k_blk;
+                    const bool nk_tail = k0 + jsp.k_blk > jsp.Sk;
+                    const dim_t N = nk_tail ? jsp.k_tail : jsp.k_blk;
+                    const int brg_idx = pd_t::get_brg_idx(m_tail, nk_tail);
+
+                    // scores = Q * K
+                    batch.ptr.A = q_ptr;
+                    batch.ptr.B = k_ptr + k0 * (is_bf16 ? 2 : 1) * qkv_dt_size;
+                    brgemm_kernel_execute(
+                            brg_qk_kernels_[brg_idx].get(), 1, &batch, scores);
+
+                    // probs = exp(scale * scores + mask - max)
+                    sdpa_impl::jit_sdpa_softmax_kernel_base_t::call_params_t
+                            p;
+                    p.scale = &scale;
+                    for (dim_t i = 0; i < M; i++) {
+                        p.scores = scores + i * jsp.k_blk;
+                        p.probs = probs + i * jsp.k_blk_pad * qkv_dt_size;
+                        p.mask = mask_ptr
+                                ? mask_ptr
+                                        + (i * jsp.mask_ld + k0) * mask_dt_size
+                                : nullptr;
+                        p.max = max + i;
+                        p.sum = sum + i;
+                        p.alpha = alpha + i;
+                        (*softmax_kernels_[nk_tail])(&p);
+                        // Keys are padded to the VNNI granularity.
+                        if (is_bf16 && N % 2)
+                            ((bfloat16_t *)p.probs)[N] = 0.f;
+                    }
+
+                    // acc = acc * alpha + P * V
+                    for_(dim_t i = 0; i < M; i++)
+                    for (dim_t v = 0; v < jsp.Dv; v++)
+                        acc[i * jsp.Dv + v] *= alpha[i];
+                    batch.ptr.A = probs;
+                    batch.ptr.B = v_ptr + k0 * jsp.ldb_v * qkv_dt_size;
+                    brgemm_kernel_execute(
+                            brg_pv_kernels_[brg_idx].get(), 1, &batch, acc);
+                }
+
+                for (dim_t i = 0; i < M; i++) {
+                    const float inv_sum = 1.f / sum[i];
+                    float *acc_row = acc + i * jsp.Dv;
+                    for (dim_t v = 0; v < jsp.Dv; v++)
+                        acc_row[v] *= inv_sum;
+
+                    char *dst_row = dst
+                            + (batch_offset(dst_d, mb, batch_dims, batch_ndims)
+                                      + (q0 + i) * dst_ld)
+                                    * dst_dt_size;
+                    if (jsp.dst_dt == bf16)
+                        cvt_float_to_bfloat16(
+                                (bfloat16_t *)dst_row, acc_row, jsp.Dv);
+                    else
+                        utils::array_copy((float *)dst_row, acc_row, jsp.Dv);
+                }
+            });
+
+    return status::success;
+}
+
+template struct jit_brgemm_sdpa_t<avx512_core_bf16>;
+template struct jit_brgemm_sdpa_t<avx512_core>;
+template struct jit_brgemm_sdpa_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,156 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_BRGEMM_SDPA_HPP
+#define CPU_X64_JIT_BRGEMM_SDPA_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_sdpa_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+namespace sdpa_impl {
+
+struct jit_sdpa_conf_t {
+    dim_t MB; // total batch size
+    dim_t Sq, Sk; // number of queries and keys
+    dim_t D, Dv; // head size of queries/keys and values
+
+    // Queries are processed in blocks of q_blk rows, keys in blocks of k_blk
+    // columns. Probabilities are stored with a row stride of k_blk_pad, which
+    // is k_blk rounded up to the VNNI granularity.
+    dim_t q_blk, k_blk, k_blk_pad;
+    dim_t nb_q, nb_k;
+    dim_t q_tail, k_tail;
+
+    data_type_t qkv_dt, dst_dt, mask_dt;
+
+    // Keys are packed into a [D][Sk] (f32) or [D / 2][Sk_pad][2] (bf16)
+    // layout when they cannot be consumed directly. Values are always packed
+    // into a [Sk_pad / 2][Dv][2] layout for bf16.
+    bool pack_keys, pack_values;
+    dim_t Sk_pad;
+
+    // Leading dimensions in elements.
+    dim_t lda_q, ldb_k, ldb_v;
+    dim_t mask_ld; // 0 if the mask is broadcast over queries
+
+    int nthr;
+};
+
+// Computes one row of the attention probabilities for a block of keys and
+// updates the running row statistics of the online softmax:
+//     s = s * scale + mask
+//     m_new = max(m, max(s)), alpha = exp(m - m_new)
+//     p = exp(s - m_new), l = l * alpha + sum(p)
+struct jit_sdpa_softmax_kernel_base_t {
+    static jit_sdpa_softmax_kernel_base_t *create(
+            const jit_sdpa_conf_t &jsp, dim_t n, const cpu_isa_t isa);
+
+    virtual ~jit_sdpa_softmax_kernel_base_t() = default;
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const float *scores;
+        void *probs;
+        const void *mask;
+        const float *scale;
+        float *max;
+        float *sum;
+        float *alpha;
+    };
+
+    virtual void operator()(const call_params_t *p) const = 0;
+    virtual status_t create_kernel() = 0;
+
+protected:
+    jit_sdpa_softmax_kernel_base_t(const jit_sdpa_conf_t &jsp, dim_t n)
+        : jsp_(jsp), n_(n) {}
+
+    const jit_sdpa_conf_t jsp_;
+    const dim_t n_; // number of keys processed per call
+};
+
+} // namespace sdpa_impl
+
+// Fused scaled dot-product attention. The attention matrix is never
+// materialized: queries are split into blocks and every block walks over all
+// the keys in blocks, computing scores with brgemm, then probabilities and
+// running statistics with an online softmax, and finally accumulating
+// probabilities times values with brgemm. Scratchpad memory is linear in the
+// sequence length.
+template <cpu_isa_t isa>
+struct jit_brgemm_sdpa_t : public primitive_t {
+    struct pd_t : public cpu_sdpa_pd_t {
+        using cpu_sdpa_pd_t::cpu_sdpa_pd_t;
+
+        DECLARE_COMMON_PD_T(
+                JIT_IMPL_NAME_HELPER("brg:", isa, ""), jit_brgemm_sdpa_t);
+
+        status_t init(engine_t *engine);
+
+        // Kernels are indexed by [with M tail][with N or K tail].
+        static int get_brg_idx(bool m_tail, bool nk_tail) {
+            return 2 * (int)m_tail + (int)nk_tail;
+        }
+
+        sdpa_impl::jit_sdpa_conf_t jsp_ = utils::zero<decltype(jsp_)>();
+        brgemm_t brg_qk_descs_[4];
+        brgemm_t brg_pv_descs_[4];
+
+    private:
+        status_t init_conf();
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+    };
+
+    jit_brgemm_sdpa_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    void pack_keys(const char *key, char *key_packed) const;
+    void pack_values(const char *val, char *val_packed) const;
+
+    std::unique_ptr<brgemm_kernel_t> brg_qk_kernels_[4];
+    std::unique_ptr<brgemm_kernel_t> brg_pv_kernels_[4];
+    std::unique_ptr<sdpa_impl::jit_sdpa_softmax_kernel_base_t>
+            softmax_kernels_[2];
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
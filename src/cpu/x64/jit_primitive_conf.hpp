@@ -682,6 +682,7 @@ struct jit_brgemm_conv_conf_t {
     int simd_w, acc_simd_w, amx_w, amx_h;
     int ndims;
     int mb;
+    bool is_runtime_mb;
     int ngroups, ic, oc, oc_without_padding, ic_without_padding;
 
     int od_block, oh_block, nb_od,
@@ -863,6 +864,8 @@ struct jit_binary_conf_t {
     bool is_bf16 = false;
     bool is_f16 = false;
     bool is_src_different_layouts = false;
+    bool is_select = false;
+    bool use_nt_stores = false;
     dim_t outer_dims = 1;
     int src1_stride = 1;
     int not_bcasted_sp_dims = 0;
@@ -870,12 +873,13 @@ struct jit_binary_conf_t {
 
     data_type_t src0_type = data_type::undef;
     data_type_t src1_type = data_type::undef;
+    data_type_t src2_type = data_type::undef;
     data_type_t dst_type = data_type::undef;
 };
 
 struct jit_binary_call_s {
     // keep all sizes at 8 bytes -- jit code expects this
-    const void *src0, *src1, *dst, *indices;
+    const void *src0, *src1, *src2, *dst, *indices;
     const float *scales_src0, *scales_src1;
     size_t spat_offt_count;
     const void *post_ops_binary_rhs_arg_vec;
@@ -897,6 +901,27 @@ struct jit_reduction_conf_t {
 
     dim_t idle_size = 0;
     dim_t reduce_size = 0;
+    // The reduced dimensions are followed by inner_size idle elements, i.e.
+    // src is [idle_size / inner_size][reduce_size][inner_size]. Strided
+    // kernels process inner_size > 1 with vectors along the inner elements.
+    dim_t inner_size = 1;
+    // Maximum number of inner elements processed by a single kernel call,
+    // a multiple of all vector lengths.
+    dim_t inner_blk = 1;
+    // Number of values averaged by reduction_mean, it differs from
+    // reduce_size when the reduced range is split between threads.
+    dim_t mean_size = 0;
+    // The reduced range is split into reduce_nchunks chunks of reduce_chunk
+    // elements, which are reduced into f32 partial results first.
+    dim_t reduce_nchunks = 1;
+    dim_t reduce_chunk = 0;
+
+    // lp-norm parameters
+    float p = 0.f;
+    float eps = 0.f;
+    // The source holds partial sums of |src|^p, which are accumulated as
+    // is before the lp-norm finalization.
+    bool src_is_power_p = false;
 
     bool is_saturation_needed = false;
 
@@ -913,6 +938,10 @@ struct jit_reduction_call_s {
     void *dst = nullptr;
     const void *post_ops_binary_rhs_arg_vec = nullptr;
     const void *dst_orig = nullptr;
+    // strided kernels only: the number of full vectors of inner elements
+    // and whether the inner tail is processed after them
+    size_t inner_work = 0;
+    size_t inner_tail = 0;
 };
 
 } // namespace x64
@@ -136,6 +136,18 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
 
     // All operations over blocking descriptors should have md initialized.
     conf_.is_src_different_layouts = !compare_layouts(src0_md_, src1_md_);
+
+    conf_.is_select = is_select();
+    if (conf_.is_select) {
+        // The condition is addressed with src0 offsets, so it has to share
+        // the src0 layout. Blending needs at least avx2.
+        const memory_desc_wrapper src2_md_(src_md(2));
+        conf_.src2_type = src2_md_.data_type();
+        ok = is_superset(conf_.isa, avx2) && !conf_.is_src_different_layouts
+                && src2_md_.similar_to(src0_md_, true, false)
+                && src2_md_.offset0() == src0_md_.offset0();
+        if (!ok) return status::unimplemented;
+    }
     ok = post_ops_ok(attr(), src_md(0), dst_md(),
                  conf_.is_src_different_layouts, conf_.isa)
             && (conf_.is_i8 || elt_idx == -1
@@ -201,6 +213,17 @@ status_t jit_uni_binary_t::pd_t::init(engine_t *engine) {
             conf_.not_bcasted_sp_dims += !bcast_dims[d];
     }
 
+    // Non-temporal stores are used only by the strategy processing the
+    // tensors as flat arrays of vectors, see execute_no_bcast_strategy().
+    size_t data_size = src0_md_.size() + src1_md_.size() + dst_md_.size();
+    if (conf_.is_select) data_size += memory_desc_wrapper(src_md(2)).size();
+    conf_.use_nt_stores = conf_.bcast_type == bcast_t::none
+            && !conf_.is_src_different_layouts
+            && !conf_.postops_per_oc_broadcast_exists
+            && IMPLICATION(conf_.op_type == op_t::c_blocked,
+                    src0_md_.padded_dims()[1] == src0_md_.dims()[1])
+            && io::nt_stores_beneficial(data_size);
+
     return status::success;
 }
 
@@ -276,7 +299,7 @@ bool jit_uni_binary_t::pd_t::alg_preserves_zero() const {
     using namespace alg_kind;
     return utils::one_of(desc()->alg_kind, binary_add, binary_max, binary_min,
             binary_mul, binary_sub, binary_ge, binary_gt, binary_le, binary_lt,
-            binary_eq, binary_ne);
+            binary_eq, binary_ne, binary_select);
 }
 
 bool jit_uni_binary_t::pd_t::check_scales_mask() const {
@@ -536,9 +559,10 @@ bool jit_uni_binary_t::post_ops_ok(const primitive_attr_t *attr,
                             }));
 }
 
-binary_kernel_t *create_binary_kernel(
-        const jit_uni_binary_t::pd_t *pd, bool tail_kernel) {
-    const auto &conf = pd->get_conf();
+binary_kernel_t *create_binary_kernel(const jit_uni_binary_t::pd_t *pd,
+        bool tail_kernel, bool use_nt_stores = false) {
+    auto conf = pd->get_conf();
+    conf.use_nt_stores = use_nt_stores;
     const memory_desc_wrapper src0_d(pd->src_md(0));
     // No support for different blocked memory layouts
     const auto blk_size = src0_d.blocking_desc().inner_blks[0];
@@ -681,12 +705,19 @@ status_t jit_uni_binary_t::init(engine_t *engine) {
         }
     }
 
+    if (pd()->get_conf().use_nt_stores) {
+        CHECK(safe_ptr_assign(kernel_nt_,
+                create_binary_kernel(pd(), false /*tail_kernel*/,
+                        true /*use_nt_stores*/)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+
     return kernel_->create_kernel();
 }
 
 void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
-        const data_t *src1, data_t *dst, const float *scale0,
-        const float *scale1,
+        const data_t *src1, const data_t *src2, data_t *dst,
+        const float *scale0, const float *scale1,
         const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
         const bcast_t bcast_type) const {
     const auto kernel = kernel_.get();
@@ -773,6 +804,12 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
         const bool has_tail = nelems0_tail > 0;
 
         const bool point_broadcast = bcast_type == bcast_t::scalar;
+        // Non-temporal stores require aligned vectors. Threads start at
+        // vector boundaries, so all of them store aligned vectors if dst is
+        // aligned.
+        const bool dst_aligned = reinterpret_cast<uintptr_t>(dst) % 64 == 0;
+        const auto kernel_to_use
+                = kernel_nt_ && dst_aligned ? kernel_nt_.get() : kernel;
 
         // Compute strategy:
         // Compute number of vectors, divide it equally between all threads.
@@ -790,6 +827,7 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
             jit_binary_call_s p;
             p.spat_offt_count = (n_simd_to_do + tail_to_do) * dst_type_size;
             p.src0 = src0 + start * simd_w * src0_type_size;
+            if (src2) p.src2 = src2 + start * simd_w;
             p.src1 = src1
                     + (point_broadcast ? 0 : (start * simd_w * src1_type_size));
             p.dst = dst + start * simd_w * dst_type_size;
@@ -797,14 +835,14 @@ void jit_uni_binary_t::execute_no_bcast_strategy(const data_t *src0,
             p.scales_src1 = scale1;
             p.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
             p.dst_orig = dst;
-            (*kernel)(&p);
+            (*kernel_to_use)(&p);
         });
     }
 }
 
 void jit_uni_binary_t::execute_bcast_per_batch_strategy(const data_t *src0,
-        const data_t *src1, data_t *dst, const float *scale0,
-        const float *scale1,
+        const data_t *src1, const data_t *src2, data_t *dst,
+        const float *scale0, const float *scale1,
         const std::vector<const void *> &post_ops_binary_rhs_arg_vec) const {
 
     const auto kernel = kernel_.get();
@@ -841,6 +879,7 @@ void jit_uni_binary_t::execute_bcast_per_batch_strategy(const data_t *src0,
         p.spat_offt_count = (n_simd_to_do + tail_to_do) * dst_type_size;
         const dim_t off = start * simd_w;
         p.src0 = src0 + (off + b * nelems0_per_b) * src0_type_size;
+        if (src2) p.src2 = src2 + off + b * nelems0_per_b;
         p.src1 = src1 + off * src1_type_size;
         p.dst = dst + (off + b * nelems0_per_b) * dst_type_size;
         p.scales_src0 = scale0;
@@ -852,8 +891,8 @@ void jit_uni_binary_t::execute_bcast_per_batch_strategy(const data_t *src0,
 }
 
 void jit_uni_binary_t::execute_bcast_per_c_strategy(const data_t *src0,
-        const data_t *src1, data_t *dst, const float *scale0,
-        const float *scale1,
+        const data_t *src1, const data_t *src2, data_t *dst,
+        const float *scale0, const float *scale1,
         const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
         const op_t op_type, const bcast_t bcast_type,
         const bool blocked_oc_tail) const {
@@ -916,6 +955,7 @@ void jit_uni_binary_t::execute_bcast_per_c_strategy(const data_t *src0,
             const dim_t off = mb * nelems_slice_src0 + C_blk * SP * simd_w;
             p.dst = dst + off * dst_type_size;
             p.src0 = src0 + off * src0_type_size;
+            if (src2) p.src2 = src2 + off;
             p.src1 = src1 + src1_off(mb, C_blk, off) * src1_type_size;
             p.scales_src0 = scale0;
             p.scales_src1 = scale1;
@@ -940,6 +980,7 @@ void jit_uni_binary_t::execute_bcast_per_c_strategy(const data_t *src0,
             const auto off = mb * nelems_slice_src0 + sp * C;
             p.dst = dst + off * dst_type_size;
             p.src0 = src0 + off * src0_type_size;
+            if (src2) p.src2 = src2 + off;
             p.src1 = src1 + src1_off(mb, sp, off) * src1_type_size;
             p.scales_src0 = scale0;
             p.scales_src1 = scale1;
@@ -965,6 +1006,7 @@ void jit_uni_binary_t::execute_bcast_per_c_strategy(const data_t *src0,
             const auto off = mb * nelems_slice_src0 + c * SP;
             p.dst = dst + off * dst_type_size;
             p.src0 = src0 + off * src0_type_size;
+            if (src2) p.src2 = src2 + off;
             p.src1 = src1 + src1_off(mb, c, off) * src1_type_size;
             p.scales_src0 = scale0;
             p.scales_src1 = scale1;
@@ -976,8 +1018,8 @@ void jit_uni_binary_t::execute_bcast_per_c_strategy(const data_t *src0,
 }
 
 void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
-        const data_t *src1, data_t *dst, const float *scale0,
-        const float *scale1,
+        const data_t *src1, const data_t *src2, data_t *dst,
+        const float *scale0, const float *scale1,
         const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
         const op_t op_type, const bool blocked_oc_tail) const {
     const auto kernel = kernel_.get();
@@ -1038,6 +1080,7 @@ void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
                             + simd_w * (C_blk * SP + n * SP_no_bcast + sp);
                     p.dst = dst + off * dst_type_size;
                     p.src0 = src0 + off * src0_type_size;
+                    if (src2) p.src2 = src2 + off;
                     // check if mb is broadcast
                     const dim_t src1_off = bcast_dims[0] == 1
                             ? sp * simd_w
@@ -1062,6 +1105,7 @@ void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
                     = mb * nelems_slice_src0 + n * SP_no_bcast * C + sp * C;
             p.dst = dst + off * dst_type_size;
             p.src0 = src0 + off * src0_type_size;
+            if (src2) p.src2 = src2 + off;
             const dim_t src1_off
                     = bcast_dims[0] == 1 ? sp : mb * SP_no_bcast + sp;
             p.src1 = src1 + src1_off * src1_type_size;
@@ -1084,6 +1128,7 @@ void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
                     + n * SP_no_bcast;
             p.dst = dst + off * dst_type_size;
             p.src0 = src0 + off * src0_type_size;
+            if (src2) p.src2 = src2 + off;
             const dim_t src1_off = bcast_dims[0] == 1 ? 0 : mb * SP_no_bcast;
             p.src1 = src1 + src1_off * src1_type_size;
             p.scales_src0 = scale0;
@@ -1098,6 +1143,9 @@ void jit_uni_binary_t::execute_bcast_per_w_strategy(const data_t *src0,
 status_t jit_uni_binary_t::execute(const exec_ctx_t &ctx) const {
     const auto src0 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_0);
     const auto src1 = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_1);
+    const auto src2 = pd()->is_select()
+            ? CTX_IN_MEM(const data_t *, DNNL_ARG_SRC_2)
+            : nullptr;
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
     const auto &post_ops = pd()->attr()->post_ops_;
     const auto &post_ops_binary_rhs_arg_vec
@@ -1134,18 +1182,19 @@ status_t jit_uni_binary_t::execute(const exec_ctx_t &ctx) const {
 
     if ((bcast_type == bcast_t::none || point_broadcast_no_oc_tail)
             && !postops_per_oc_broadcast_exists && !blocked_oc_tail)
-        execute_no_bcast_strategy(src0, src1, dst, scales[0], scales[1],
-                post_ops_binary_rhs_arg_vec, bcast_type);
+        execute_no_bcast_strategy(src0, src1, src2, dst, scales[0],
+                scales[1], post_ops_binary_rhs_arg_vec, bcast_type);
     else if (bcast_type == bcast_t::per_batch
             && !postops_per_oc_broadcast_exists && !blocked_oc_tail)
-        execute_bcast_per_batch_strategy(src0, src1, dst, scales[0], scales[1],
-                post_ops_binary_rhs_arg_vec);
+        execute_bcast_per_batch_strategy(src0, src1, src2, dst, scales[0],
+                scales[1], post_ops_binary_rhs_arg_vec);
     else if (bcast_type == bcast_t::per_w)
-        execute_bcast_per_w_strategy(src0, src1, dst, scales[0], scales[1],
-                post_ops_binary_rhs_arg_vec, op_type, blocked_oc_tail);
+        execute_bcast_per_w_strategy(src0, src1, src2, dst, scales[0],
+                scales[1], post_ops_binary_rhs_arg_vec, op_type,
+                blocked_oc_tail);
     else
-        execute_bcast_per_c_strategy(src0, src1, dst, scales[0], scales[1],
-                post_ops_binary_rhs_arg_vec, op_type, bcast_type,
+        execute_bcast_per_c_strategy(src0, src1, src2, dst, scales[0],
+                scales[1], post_ops_binary_rhs_arg_vec, op_type, bcast_type,
                 blocked_oc_tail);
 
     return status::success;
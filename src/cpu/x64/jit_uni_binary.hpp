@@ -74,20 +74,23 @@ struct jit_uni_binary_t : public primitive_t {
     using data_t = int8_t;
 
     void execute_no_bcast_strategy(const data_t *src0, const data_t *src1,
-            data_t *dst, const float *scale0, const float *scale1,
+            const data_t *src2, data_t *dst, const float *scale0,
+            const float *scale1,
             const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
             const bcast_t bcast_type) const;
     void execute_bcast_per_batch_strategy(const data_t *src0,
-            const data_t *src1, data_t *dst, const float *scale0,
-            const float *scale1,
+            const data_t *src1, const data_t *src2, data_t *dst,
+            const float *scale0, const float *scale1,
             const std::vector<const void *> &post_ops_binary_rhs_arg_vec) const;
     void execute_bcast_per_c_strategy(const data_t *src0, const data_t *src1,
-            data_t *dst, const float *scale0, const float *scale1,
+            const data_t *src2, data_t *dst, const float *scale0,
+            const float *scale1,
             const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
             const op_t op_type, const bcast_t bcast_type,
             const bool blocked_oc_tail) const;
     void execute_bcast_per_w_strategy(const data_t *src0, const data_t *src1,
-            data_t *dst, const float *scale0, const float *scale1,
+            const data_t *src2, data_t *dst, const float *scale0,
+            const float *scale1,
             const std::vector<const void *> &post_ops_binary_rhs_arg_vec,
             const op_t op_type, const bool blocked_oc_tail) const;
 
@@ -102,6 +105,8 @@ private:
     std::unique_ptr<binary_kernel_t> kernel_;
     // used only in bcast_c_blocked strategy if tail exists
     std::unique_ptr<binary_kernel_t> kernel_tail_;
+    // used only in no_bcast strategy if non-temporal stores pay off
+    std::unique_ptr<binary_kernel_t> kernel_nt_;
 };
 
 } // namespace x64
@@ -93,8 +93,11 @@ jit_uni_binary_kernel_t<isa, Vmm>::jit_uni_binary_kernel_t(
     : binary_kernel_t(vreg_traits<Vmm>::vlen, pd, conf, jit_name(), tail_kernel)
     , offt_src0_(vlen_ / ((conf_.is_bf16 || conf_.is_f16) ? 2 : 1))
     , offt_src1_(conf_.use_stride_src1 ? offt_src0_ : 0)
-    , io_(this, isa, {conf_.src0_type, conf_.src1_type, conf_.dst_type},
-              {false},
+    // data types are deduplicated, the last one is only needed for select
+    , io_(this, isa,
+              {conf_.src0_type, conf_.src1_type, conf_.dst_type,
+                      conf_.is_select ? conf_.src2_type : conf_.dst_type},
+              {conf_.use_nt_stores},
               io::io_tail_conf_t {simd_w_, tail_size_, tail_opmask_,
                       vmm_tail_vmask_.getIdx(), reg_tmp_},
               io::io_emu_bf16_conf_t {vreg_bf16_emu_1_, vreg_bf16_emu_2_,
@@ -242,6 +245,7 @@ void jit_uni_binary_kernel_t<isa, Vmm>::load_kernel_params() {
                 ptr[reg_param_ + PARAM_OFF(spat_offt_count)]);
     mov(reg_src0_, ptr[reg_param_ + PARAM_OFF(src0)]);
     mov(reg_src1_, ptr[reg_param_ + PARAM_OFF(src1)]);
+    if (conf_.is_select) mov(reg_src2_, ptr[reg_param_ + PARAM_OFF(src2)]);
     mov(reg_dst_, ptr[reg_param_ + PARAM_OFF(dst)]);
     if (conf_.is_src_different_layouts) {
         mov(reg_tmp_, ptr[reg_param_ + PARAM_OFF(indices)]);
@@ -267,6 +271,11 @@ Address jit_uni_binary_kernel_t<isa, Vmm>::src1_ptr(size_t offt) {
     return vmmword[reg_src1_ + reg_offt_src1_ + offt];
 }
 
+template <cpu_isa_t isa, typename Vmm>
+Address jit_uni_binary_kernel_t<isa, Vmm>::src2_ptr(size_t offt) {
+    return vmmword[reg_src2_ + reg_offt_src2_ + offt];
+}
+
 template <cpu_isa_t isa, typename Vmm>
 Address jit_uni_binary_kernel_t<isa, Vmm>::dst_ptr(size_t offt) {
     const Reg64 &reg_offt_dst = conf_.is_i8 ? reg_offt_dst_ : reg_offt_src0_;
@@ -320,6 +329,15 @@ void jit_uni_binary_kernel_t<isa, Vmm>::perform_op(
             uni_vcmpps(v0, v0, v1, predicate);
             uni_vminps(v0, v0, vreg_one_);
         }
+    } else if (alg == binary_select) {
+        // Take src1 where the condition loaded by load_src2() is zero.
+        if (is_avx512) {
+            vptestnmd(cmp_mask, vmm_src2_, vmm_src2_);
+            vmovups(v0 | cmp_mask, v1);
+        } else {
+            uni_vpcmpeqd(vmm_src2_, vmm_src2_, vmm_src2_zero_);
+            uni_vblendvps(v0, v0, v1, vmm_src2_);
+        }
     } else
         assert(!"not supported operation!");
 }
@@ -381,6 +399,14 @@ void jit_uni_binary_kernel_t<isa, Vmm>::load_src1(
                         vreg_src1, tail);
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_kernel_t<isa, Vmm>::load_src2(const int offt, bool tail) {
+    if (!conf_.is_select) return;
+    io_.at(conf_.src2_type)
+            ->load(src2_ptr(offt * types::data_type_size(conf_.src2_type)),
+                    vmm_src2_, tail);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::store(int unroll, bool tail) {
     for (int i = 0; i < unroll; i++) {
@@ -494,6 +520,7 @@ void jit_uni_binary_kernel_t<isa, Vmm>::compute_ne_xf16_dst_body(
             // not needed for different layouts
             if (!conf_.is_src_different_layouts)
                 uni_vmovups(vreg_tmp, vreg_tmp_src1);
+            load_src2(offt, tail);
             perform_op(vreg_tmp_src0, vreg_tmp, vreg_scales_src0_,
                     vreg_scales_src1_);
         }
@@ -519,6 +546,7 @@ void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst_body(
         // not needed for different layouts
         if (!conf_.is_src_different_layouts)
             uni_vmovups(vreg_tmp, vreg_tmp_src1);
+        load_src2(offt, tail);
         perform_op(
                 vreg_tmp_src0, vreg_tmp, vreg_scales_src0_, vreg_scales_src1_);
     }
@@ -526,6 +554,15 @@ void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst_body(
 
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_kernel_t<isa, Vmm>::compute_dst(int unroll, bool tail) {
+    if (conf_.is_select) {
+        // The condition shares the layout of src0, only its element size
+        // differs.
+        mov(reg_offt_src2_, reg_offt_src0_);
+        const auto shift = math::ilog2q(types::data_type_size(conf_.src0_type)
+                / types::data_type_size(conf_.src2_type));
+        if (shift) shr(reg_offt_src2_, shift);
+    }
+
     // When src1 supports but src0 does not support ne convert instructions
     // we only call compute_ne_xf16_dst_body() when loading src1 is needed
     if (!tail
@@ -578,6 +615,8 @@ void jit_uni_binary_kernel_t<isa, Vmm>::forward() {
         uni_vmovq(xreg_one, reg_tmp_);
         uni_vbroadcastss(vreg_one_, xreg_one);
     }
+    if (conf_.is_select && !is_avx512)
+        uni_vpxor(vmm_src2_zero_, vmm_src2_zero_, vmm_src2_zero_);
 
     compute_bcast(false); // bcast/load vreg just one time per a kernel call
 
@@ -696,6 +735,8 @@ void jit_uni_binary_kernel_t<isa, Vmm>::generate() {
         forward_over_outer_dims();
     else
         forward();
+    // Make the non-temporal stores visible to the other threads.
+    if (conf_.use_nt_stores) sfence();
     postamble();
 
     if ((conf_.with_eltwise || conf_.is_i8) && postops_injector_)
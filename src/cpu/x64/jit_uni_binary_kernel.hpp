@@ -93,6 +93,10 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     const Reg64 reg_scales_src0_ = rbx;
     const Reg64 reg_scales_src1_ = rbp;
     const Reg64 reg_offt_dst_ = rdx;
+    // Select is not supported for different layouts, so the registers of
+    // outer dims range and gather are free for the condition.
+    const Reg64 reg_src2_ = r12;
+    const Reg64 reg_offt_src2_ = abi_not_param1;
     const Opmask tail_opmask_ = k2;
     const Opmask cmp_mask = k3;
     const Opmask full_mask_ = k4;
@@ -116,8 +120,11 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     const Vmm vmm_tmp_gather_ = Vmm(is_avx512 ? 25 : 6);
     const Vmm vmm_indices_ = Vmm(is_avx512 ? 30 : 7);
     const Vmm vmm_gathered_src_ = Vmm(is_avx512 ? 31 : 8);
+    const Vmm vmm_src2_ = Vmm(is_avx512 ? 31 : 8);
+    const Vmm vmm_src2_zero_ = Vmm(7);
 
-    const size_t unroll_regs_ = is_avx512 ? 8 : 4;
+    // avx2 select keeps the condition and zero in Vmm(7) and Vmm(8).
+    const size_t unroll_regs_ = is_avx512 ? 8 : conf_.is_select ? 3 : 4;
     const size_t offt_src0_;
     const size_t offt_src1_;
 
@@ -134,6 +141,7 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     void load_kernel_params();
     Address src0_ptr(size_t offt = 0);
     Address src1_ptr(size_t offt = 0);
+    Address src2_ptr(size_t offt = 0);
     Address dst_ptr(size_t offt = 0);
     unsigned int cmp_predicate(alg_kind_t alg);
     void perform_op(
@@ -141,6 +149,7 @@ struct jit_uni_binary_kernel_t : public binary_kernel_t {
     void prepare_isa_kernel();
     void compute_bcast(bool tail);
     void load_src1(const Vmm &vreg_src1, const int offt, bool tail);
+    void load_src2(const int offt, bool tail);
     void store(int unroll, bool tail);
     void compute_ne_xf16_dst_body(int unroll, bool tail);
     void compute_dst_body(int unroll, bool tail);
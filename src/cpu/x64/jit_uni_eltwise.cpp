@@ -74,12 +74,13 @@ template <cpu_isa_t isa>
 struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_kernel)
 
-    jit_uni_kernel_t(const eltwise_pd_t *pd)
+    jit_uni_kernel_t(const eltwise_pd_t *pd, bool use_nt_stores = false)
         : jit_uni_eltwise_kernel(pd, jit_name())
         , vlen_(is_bf16() || is_f16() ? cpu_isa_traits<isa>::vlen / 2
                                       : cpu_isa_traits<isa>::vlen)
         , simd_w_(vlen_ / dtype_size())
-        , is_fwd_(pd_->is_fwd()) {
+        , is_fwd_(pd_->is_fwd())
+        , use_nt_stores_(use_nt_stores) {
 
         const auto &desc = *pd_->desc();
         // we can consider that there's no auxiliary vregs on fwd path
@@ -89,7 +90,7 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         eltwise_injector_.reset(new jit_uni_eltwise_injector_f32<isa>(this,
                 desc.alg_kind, desc.alpha, desc.beta, 1.f, save_state,
                 reg_injector_table, injector_mask, is_fwd_, pd_->use_dst()));
-        io::io_conf_t io_conf;
+        io::io_conf_t io_conf(use_nt_stores_);
         io::io_tail_conf_t io_tail_conf(simd_w_, tail_size_, tail_opmask_idx_,
                 vmm_tail_mask.getIdx(), reg_tmp);
         io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
@@ -213,6 +214,8 @@ struct jit_uni_kernel_t : public jit_uni_eltwise_kernel {
         // can be relevantly easy controlled, this will cost much from code
         // perspective and will complicate the compute logic significantly.
         compute();
+        // Make the non-temporal stores visible to the other threads.
+        if (use_nt_stores_) sfence();
 
         postamble();
 
@@ -225,6 +228,7 @@ private:
     const int vlen_;
     const int simd_w_;
     const bool is_fwd_;
+    const bool use_nt_stores_;
     const int tail_size_ = 1;
 
     Reg64 reg_src = rax;
@@ -293,7 +297,15 @@ jit_uni_eltwise_fwd_t<isa, d_type>::~jit_uni_eltwise_fwd_t() = default;
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_fwd_t<isa, d_type>::init(engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_, new jit_uni_kernel_t<isa>(pd())));
-    return kernel_->create_kernel();
+    CHECK(kernel_->create_kernel());
+
+    const memory_desc_wrapper data_d(pd()->src_md());
+    if (io::nt_stores_beneficial(2 * data_d.size())) {
+        CHECK(safe_ptr_assign(
+                kernel_nt_, new jit_uni_kernel_t<isa>(pd(), true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+    return status::success;
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -309,6 +321,11 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
+    // Non-temporal stores require aligned vectors. Threads start at 64 byte
+    // boundaries, so all of them store aligned vectors if dst is aligned.
+    const bool dst_aligned = reinterpret_cast<uintptr_t>(dst) % 64 == 0;
+    auto *kernel = kernel_nt_ && dst_aligned ? kernel_nt_.get() : kernel_.get();
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -322,7 +339,7 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
         args.dst = dst + start;
         args.diff_dst = nullptr;
         args.work_amount = end - start;
-        (*kernel_)(&args);
+        (*kernel)(&args);
     });
 
     return status::success;
@@ -363,7 +380,15 @@ jit_uni_eltwise_bwd_t<isa, d_type>::~jit_uni_eltwise_bwd_t() = default;
 template <cpu_isa_t isa, data_type_t d_type>
 status_t jit_uni_eltwise_bwd_t<isa, d_type>::init(engine_t *engine) {
     CHECK(safe_ptr_assign(kernel_, new jit_uni_kernel_t<isa>(pd())));
-    return kernel_->create_kernel();
+    CHECK(kernel_->create_kernel());
+
+    const memory_desc_wrapper data_d(pd()->data_md());
+    if (io::nt_stores_beneficial(3 * data_d.size())) {
+        CHECK(safe_ptr_assign(
+                kernel_nt_, new jit_uni_kernel_t<isa>(pd(), true)));
+        CHECK(kernel_nt_->create_kernel());
+    }
+    return status::success;
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -383,6 +408,11 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
     diff_dst += diff_data_d.offset0();
     diff_src += diff_data_d.offset0();
 
+    const bool diff_src_aligned
+            = reinterpret_cast<uintptr_t>(diff_src) % 64 == 0;
+    auto *kernel = kernel_nt_ && diff_src_aligned ? kernel_nt_.get()
+                                                  : kernel_.get();
+
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t start {0}, end {0};
 
@@ -396,7 +426,7 @@ status_t jit_uni_eltwise_bwd_t<isa, d_type>::execute(
         args.dst = diff_src + start;
         args.diff_dst = diff_dst + start;
         args.work_amount = end - start;
-        (*kernel_)(&args);
+        (*kernel)(&args);
     });
 
     return status::success;
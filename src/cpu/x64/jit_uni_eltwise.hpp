@@ -63,6 +63,9 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<jit_uni_eltwise_kernel> kernel_;
+    // Uses non-temporal stores, created only for data that does not fit in
+    // the last level cache.
+    std::unique_ptr<jit_uni_eltwise_kernel> kernel_nt_;
 };
 
 template <cpu_isa_t isa, impl::data_type_t d_type>
@@ -93,6 +96,9 @@ struct jit_uni_eltwise_bwd_t : public primitive_t {
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     std::unique_ptr<jit_uni_eltwise_kernel> kernel_;
+    // Uses non-temporal stores, created only for data that does not fit in
+    // the last level cache.
+    std::unique_ptr<jit_uni_eltwise_kernel> kernel_nt_;
 };
 
 } // namespace x64
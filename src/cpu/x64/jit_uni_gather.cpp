@@ -0,0 +1,345 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+
+#include "cpu/x64/jit_uni_gather.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+jit_uni_gather_kernel_t<isa>::jit_uni_gather_kernel_t(
+        const jit_gather_conf_t &jgp)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+    , jgp_(jgp)
+    , dt_size_(types::data_type_size(jgp.src_dt))
+    , nvec_(static_cast<int>(utils::div_up(jgp.row_size, simd_w)))
+    , tail_(static_cast<int>(jgp.row_size % simd_w)) {}
+
+template <cpu_isa_t isa>
+void jit_uni_gather_kernel_t<isa>::load(
+        const Vmm &vmm, const Address &addr, bool tail) {
+    using namespace data_type;
+    // Only avx512 handles partial vectors, the tail is masked with zeroing.
+    const Vmm dst = tail ? vmm | k_tail | T_z : vmm;
+    switch (jgp_.src_dt) {
+        case f32: vmovups(dst, addr); break;
+        case bf16:
+            vpmovzxwd(dst, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        case f16: vcvtph2ps(dst, addr); break;
+        case s8:
+            vpmovsxbd(dst, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        case u8:
+            vpmovzxbd(dst, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// The common scale is passed as the output scale. A mean also divides it by
+// the number of rows in the bag, which keeps an empty bag at zero.
+template <cpu_isa_t isa>
+void jit_uni_gather_kernel_t<isa>::compute_out_scale() {
+    uni_vbroadcastss(vmm_out, ptr[reg_param + PARAM_OFF(out_scale)]);
+    if (!jgp_.is_mean) return;
+
+    Label l_empty;
+    const Xmm xmm_tmp = Xmm(vmm_tmp.getIdx());
+    mov(reg_tmp, reg_end);
+    sub(reg_tmp, reg_beg);
+    jz(l_empty, T_NEAR);
+    uni_vxorps(xmm_tmp, xmm_tmp, xmm_tmp);
+    vcvtsi2ss(xmm_tmp, xmm_tmp, reg_tmp);
+    uni_vbroadcastss(vmm_tmp, xmm_tmp);
+    vdivps(vmm_out, vmm_out, vmm_tmp);
+    L(l_empty);
+}
+
+// Accumulates nvec vectors of the rows of the current bag starting at the
+// current table and destination columns, and stores the result.
+template <cpu_isa_t isa>
+void jit_uni_gather_kernel_t<isa>::reduce_block(int nvec, bool tail) {
+    const int vec_src = static_cast<int>(simd_w * dt_size_);
+    const int vec_dst = simd_w * sizeof(float);
+    const int cache_line = 64;
+    const int n_lines = utils::div_up(nvec * vec_src, cache_line);
+
+    for (int v = 0; v < nvec; v++)
+        uni_vxorps(vmm_acc(v), vmm_acc(v), vmm_acc(v));
+
+    Label l_loop, l_no_pf, l_store;
+    mov(reg_i, reg_beg);
+    L(l_loop);
+    {
+        cmp(reg_i, reg_end);
+        jae(l_store, T_NEAR);
+
+        lea(reg_pf, ptr[reg_i + prefetch_distance]);
+        cmp(reg_pf, ptr[reg_param + PARAM_OFF(pf_end)]);
+        jae(l_no_pf, T_NEAR);
+        movsxd(reg_pf, dword[reg_ind + reg_pf * sizeof(int32_t)]);
+        imul(reg_pf, reg_pf, static_cast<int>(jgp_.src_row_stride));
+        add(reg_pf, reg_table);
+        for (int l = 0; l < n_lines; l++)
+            prefetcht0(ptr[reg_pf + l * cache_line]);
+        L(l_no_pf);
+
+        movsxd(reg_row, dword[reg_ind + reg_i * sizeof(int32_t)]);
+        if (jgp_.with_row_scales)
+            uni_vbroadcastss(
+                    vmm_scale, ptr[reg_scales + reg_row * sizeof(float)]);
+        imul(reg_row, reg_row, static_cast<int>(jgp_.src_row_stride));
+        add(reg_row, reg_table);
+
+        for (int v = 0; v < nvec; v++) {
+            load(vmm_tmp, ptr[reg_row + v * vec_src], tail && v == nvec - 1);
+            if (jgp_.with_row_scales)
+                vfmadd231ps(vmm_acc(v), vmm_tmp, vmm_scale);
+            else
+                vaddps(vmm_acc(v), vmm_acc(v), vmm_tmp);
+        }
+
+        inc(reg_i);
+        jmp(l_loop, T_NEAR);
+    }
+    L(l_store);
+
+    for (int v = 0; v < nvec; v++) {
+        vmulps(vmm_acc(v), vmm_acc(v), vmm_out);
+        const Address addr = ptr[reg_dst + v * vec_dst];
+        if (tail && v == nvec - 1)
+            vmovups(addr | k_tail, vmm_acc(v));
+        else
+            vmovups(addr, vmm_acc(v));
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_gather_kernel_t<isa>::generate() {
+    const bool has_tail = tail_ > 0;
+    // The block with the partial vector is the last one.
+    const int nfull = has_tail ? (nvec_ - 1) / n_acc : nvec_ / n_acc;
+    const int nvec_last = nvec_ - nfull * n_acc;
+    const int blk_src = static_cast<int>(n_acc * simd_w * dt_size_);
+    const int blk_dst = static_cast<int>(n_acc * simd_w * sizeof(float));
+
+    preamble();
+    sub(rsp, 8);
+
+    if (has_tail) {
+        mov(reg_tmp.cvt32(), (1 << tail_) - 1);
+        kmovw(k_tail, reg_tmp.cvt32());
+    }
+
+    mov(reg_table, ptr[reg_param + PARAM_OFF(table)]);
+    mov(reg_ind, ptr[reg_param + PARAM_OFF(indices)]);
+    mov(reg_off, ptr[reg_param + PARAM_OFF(offsets)]);
+    mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+    mov(reg_scales, ptr[reg_param + PARAM_OFF(scales)]);
+    mov(reg_nbags, ptr[reg_param + PARAM_OFF(nbags)]);
+    xor_(reg_bag, reg_bag);
+
+    Label l_bag, l_end;
+    L(l_bag);
+    {
+        cmp(reg_bag, reg_nbags);
+        jae(l_end, T_NEAR);
+
+        if (jgp_.with_bags) {
+            Label l_last, l_bounds;
+            movsxd(reg_beg, dword[reg_off + reg_bag * sizeof(int32_t)]);
+            lea(reg_tmp, ptr[reg_bag + 1]);
+            cmp(reg_tmp, reg_nbags);
+            jae(l_last, T_NEAR);
+            movsxd(reg_end,
+                    dword[reg_off + reg_bag * sizeof(int32_t)
+                            + sizeof(int32_t)]);
+            jmp(l_bounds, T_NEAR);
+            L(l_last);
+            mov(reg_end, ptr[reg_param + PARAM_OFF(last_end)]);
+            L(l_bounds);
+        } else {
+            mov(reg_beg, reg_bag);
+            lea(reg_end, ptr[reg_bag + 1]);
+        }
+
+        compute_out_scale();
+
+        if (nfull > 0) {
+            Label l_blk;
+            mov(qword[rsp], nfull);
+            L(l_blk);
+            {
+                reduce_block(n_acc, false);
+                add(reg_table, blk_src);
+                add(reg_dst, blk_dst);
+                dec(qword[rsp]);
+                jnz(l_blk, T_NEAR);
+            }
+        }
+        if (nvec_last > 0) reduce_block(nvec_last, has_tail);
+
+        sub(reg_table, nfull * blk_src);
+        add(reg_dst, static_cast<int>(jgp_.dst_row_stride) - nfull * blk_dst);
+        inc(reg_bag);
+        jmp(l_bag, T_NEAR);
+    }
+    L(l_end);
+
+    add(rsp, 8);
+    postamble();
+}
+
+#undef PARAM_OFF
+
+template <cpu_isa_t isa>
+bool jit_uni_gather_t<isa>::pd_t::rows_are_dense(
+        const memory_desc_t *md) const {
+    const memory_desc_wrapper mdw(md);
+    const dim_t row_bytes
+            = mdw.blocking_desc().strides[0] * mdw.data_type_size();
+    return mdw.is_plain() && mdw.blocking_desc().strides[1] == 1
+            && row_bytes <= INT32_MAX;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gather_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    constexpr int simd_w = jit_uni_gather_kernel_t<isa>::simd_w;
+
+    VDISPATCH_GATHER(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+
+    const auto src_dt = src_md()->data_type;
+    VDISPATCH_GATHER(utils::one_of(src_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GATHER(
+            platform::has_data_type_support(src_dt), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GATHER(dst_md()->data_type == f32, VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_GATHER(attr()->has_default_values(
+                             primitive_attr_t::skip_mask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_GATHER(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_GATHER(index_mds_ok(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GATHER(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_GATHER(rows_are_dense(src_md()) && rows_are_dense(dst_md()),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Partial vectors are loaded with masks which avx2 lacks.
+    VDISPATCH_GATHER(IMPLICATION(isa == avx2, row_size() % simd_w == 0),
+            VERBOSE_BAD_DIM, "src", 1);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    jgp_.src_dt = src_dt;
+    jgp_.with_bags = with_bags();
+    jgp_.is_mean = is_mean();
+    jgp_.with_row_scales = with_row_scales();
+    jgp_.row_size = row_size();
+    jgp_.src_row_stride
+            = src_d.blocking_desc().strides[0] * src_d.data_type_size();
+    jgp_.dst_row_stride
+            = dst_d.blocking_desc().strides[0] * dst_d.data_type_size();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gather_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_gather_kernel_t<isa>(pd()->jgp_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_gather_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using call_params_t = typename jit_uni_gather_kernel_t<isa>::call_params_t;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_1);
+    auto offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC_2);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const dim_t n_indices = pd()->n_indices();
+    const dim_t dst_rows = pd()->dst_rows();
+    const bool with_bags = pd()->with_bags();
+    const bool with_row_scales = pd()->with_row_scales();
+
+    const char *table = src + src_d.offset0() * src_d.data_type_size();
+    dst += dst_d.offset0() * dst_d.data_type_size();
+    const dim_t dst_row_stride = pd()->jgp_.dst_row_stride;
+
+    // Bags are split evenly between threads. A thread prefetches rows of
+    // the following bags as well, so short bags do not stall on every row.
+    parallel(0, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(dst_rows, nthr, ithr, start, end);
+        if (start >= end) return;
+
+        call_params_t p;
+        p.table = table;
+        p.dst = dst + start * dst_row_stride;
+        p.scales = with_row_scales ? src_scales : nullptr;
+        p.nbags = end - start;
+        p.out_scale = with_row_scales ? 1.f : src_scales[0];
+        if (with_bags) {
+            p.indices = indices;
+            p.offsets = offsets + start;
+            p.last_end = end < dst_rows ? offsets[end] : n_indices;
+            p.pf_end = n_indices;
+        } else {
+            p.indices = indices + start;
+            p.offsets = nullptr;
+            p.last_end = 0;
+            p.pf_end = end - start;
+        }
+        (*kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_gather_kernel_t<avx512_core>;
+template struct jit_uni_gather_kernel_t<avx2>;
+template struct jit_uni_gather_t<avx512_core>;
+template struct jit_uni_gather_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,148 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_GATHER_HPP
+#define CPU_X64_JIT_UNI_GATHER_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_gather_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_gather_conf_t {
+    data_type_t src_dt;
+    bool with_bags;
+    bool is_mean;
+    bool with_row_scales;
+    dim_t row_size;
+    // Distances between table and destination rows in bytes.
+    dim_t src_row_stride;
+    dim_t dst_row_stride;
+};
+
+// Reduces a range of bags of table rows to destination rows. The row of
+// the index that is a prefetch distance ahead is prefetched while the
+// current one is accumulated, which hides the latency of random row reads.
+// Without bags every index makes its own bag of a single row.
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_t)
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *table;
+        const int32_t *indices;
+        const int32_t *offsets; // the offset of the first bag
+        void *dst; // the destination row of the first bag
+        const float *scales; // per table row scales
+        size_t nbags;
+        size_t last_end; // the end of the last bag in indices
+        size_t pf_end; // the number of indices available for prefetching
+        float out_scale;
+    };
+
+    jit_uni_gather_kernel_t(const jit_gather_conf_t &jgp);
+
+    void operator()(const call_params_t *p) const {
+        jit_generator::operator()(p);
+    }
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int n_acc = isa == avx2 ? 12 : 24;
+    static constexpr int prefetch_distance = 8;
+
+    void generate() override;
+    void load(const Vmm &vmm, const Xbyak::Address &addr, bool tail);
+    void compute_out_scale();
+    void reduce_block(int nvec, bool tail);
+
+    const jit_gather_conf_t jgp_;
+    const size_t dt_size_;
+    const int nvec_;
+    const int tail_;
+
+    Vmm vmm_acc(int i) const { return Vmm(i); }
+    const Vmm vmm_tmp = Vmm(n_acc);
+    const Vmm vmm_scale = Vmm(n_acc + 1);
+    const Vmm vmm_out = Vmm(n_acc + 2);
+    const Xbyak::Opmask k_tail = Xbyak::Opmask(1);
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_tmp = rax;
+    const Xbyak::Reg64 reg_table = rbx;
+    const Xbyak::Reg64 reg_ind = rdx;
+    const Xbyak::Reg64 reg_off = rsi;
+    const Xbyak::Reg64 reg_scales = r8;
+    const Xbyak::Reg64 reg_dst = r9;
+    const Xbyak::Reg64 reg_nbags = r10;
+    const Xbyak::Reg64 reg_bag = r11;
+    const Xbyak::Reg64 reg_beg = r12;
+    const Xbyak::Reg64 reg_end = r13;
+    const Xbyak::Reg64 reg_i = r14;
+    const Xbyak::Reg64 reg_row = r15;
+    const Xbyak::Reg64 reg_pf = rbp;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_gather_t : public primitive_t {
+    struct pd_t : public cpu_gather_pd_t {
+        using cpu_gather_pd_t::cpu_gather_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_gather_t);
+
+        status_t init(engine_t *engine);
+
+        jit_gather_conf_t jgp_;
+
+    private:
+        bool rows_are_dense(const memory_desc_t *md) const;
+    };
+
+    jit_uni_gather_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_gather_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
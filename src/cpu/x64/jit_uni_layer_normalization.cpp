@@ -38,6 +38,13 @@ using namespace memory_tracking::names;
 using namespace data_type;
 using namespace Xbyak;
 
+namespace lnorm_impl {
+bcast_set_t get_supported_bcast_strategies() {
+    return {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+            broadcasting_strategy_t::no_broadcast};
+}
+} // namespace lnorm_impl
+
 cpu_isa_t get_io_isa(cpu_isa_t isa, bool has_f16, bool has_bf16) {
     // re-using avx512_core instantiation for xf16
     // re-using avx2 instantiation for xf16
@@ -58,6 +65,8 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
     void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
+            const void *residual, void *src_sum,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
             const size_t block_size) const override {
         ker_args_t args;
         args.src = src;
@@ -68,6 +77,10 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         args.var = var;
         args.src_scales = src_scales;
         args.dst_scales = dst_scales;
+        args.residual = residual;
+        args.src_sum = src_sum;
+        args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec;
+        args.dst_orig = dst_orig;
         args.block_size
                 = block_size * C_ * types::data_type_size(src_d_.data_type());
         args.eps = eps_;
@@ -89,6 +102,13 @@ struct jit_stat_and_data_base_kernel_t : stat_and_data_kernel_t,
         , use_shift_(pd_->use_shift())
         , save_stats_(pd_->is_training())
         , calculate_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean())
+        , fuse_residual_add_(pd_->fuse_residual_add())
+        , with_postops_(pd_->attr()->post_ops_.len() != 0)
+        , with_binary_(pd_->attr()->post_ops_.find(primitive_kind::binary)
+                  != -1)
+        , with_eltwise_(pd_->attr()->post_ops_.find(primitive_kind::eltwise)
+                  != -1)
         , eps_(pd_->desc()->layer_norm_epsilon)
         , has_ne_convert_src_xf16_(isa == avx2 && mayiuse(avx2_vnni_2)
                   && utils::one_of(src_d_.data_type(), data_type::f16,
@@ -128,11 +148,17 @@ protected:
         const float *var;
         const float *src_scales;
         const float *dst_scales;
+        const void *residual;
+        void *src_sum;
+        const void *post_ops_binary_rhs_arg_vec;
+        const void *dst_orig;
         size_t block_size;
         float eps;
     };
 
     io::jit_io_multi_dt_helper_t<Vmm> io_;
+    std::unique_ptr<injector::jit_uni_postops_injector_t<isa>>
+            postops_injector_;
     const memory_desc_wrapper src_d_, dst_d_;
     const size_t simd_w_;
     const dim_t C_;
@@ -142,6 +168,11 @@ protected:
     const bool use_shift_;
     const bool save_stats_;
     const bool calculate_stats_;
+    const bool skip_mean_;
+    const bool fuse_residual_add_;
+    const bool with_postops_;
+    const bool with_binary_;
+    const bool with_eltwise_;
     const float eps_;
     const bool has_ne_convert_src_xf16_;
 
@@ -157,6 +188,8 @@ protected:
     const Reg64 reg_var = r13;
     const Reg64 reg_src_scales = r14;
     const Reg64 reg_dst_scales = r15;
+    const Reg64 reg_residual = rsi;
+    const Reg64 reg_src_sum = rbp;
 
     const Vmm vmm_tail_mask = Vmm(0);
     const Vmm vmm_zero = Vmm(4); // In unroll range, safe for dst compute.
@@ -182,9 +215,13 @@ protected:
     const int bf16_emu_zmm_3_idx = 30;
     const int bf16_emu_zmm_4_idx = 31;
     const int tail_opmask_idx = 1;
+    const int injector_opmask_idx = 2;
 
+    // With the residual fusion statistics and destination are computed from
+    // the summed tensor.
     Address src_ptr(size_t offt = 0) {
-        return vmmword[reg_src + offt * src_d_.data_type_size()];
+        const Reg64 reg_norm_src = fuse_residual_add_ ? reg_src_sum : reg_src;
+        return vmmword[reg_norm_src + offt * src_d_.data_type_size()];
     }
 
     Address dst_ptr(size_t offt = 0) {
@@ -363,19 +400,63 @@ protected:
         if (has_ne_convert_src_xf16_)
             compute_ne_convert_xf16(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(
+                                    vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         else
             compute(vmm_inv_sqrtvar,
                     [&](Vmm vmm_dst, Vmm vmm_src, bool need_tail) {
-                        uni_vsubps_maybe_tail(vmm_src, vmm_mean, need_tail);
+                        if (!skip_mean_)
+                            uni_vsubps_maybe_tail(
+                                    vmm_src, vmm_mean, need_tail);
                         uni_vfmadd231ps(vmm_dst, vmm_src, vmm_src);
                     });
         if (save_stats_)
             uni_vmovss(ptr[reg_var], Xmm(vmm_inv_sqrtvar.getIdx()));
     }
 
+    // Without post-ops `vmm_combined_scales` holds the product of source and
+    // destination scales, otherwise the source scale only and post-ops are
+    // applied between the two.
+    void apply_scales_and_postops(
+            const Vmm &vmm_dst, size_t offt_elems, bool tail) {
+        uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+        if (!with_postops_) return;
+
+        binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
+        if (with_binary_) {
+            rhs_arg_params.vmm_idx_to_out_addr.emplace(
+                    vmm_dst.getIdx(), dst_ptr());
+            rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(
+                    vmm_dst.getIdx(), offt_elems);
+            if (tail) rhs_arg_params.vmm_tail_idx_.emplace(vmm_dst.getIdx());
+        }
+        postops_injector_->compute_vector(vmm_dst.getIdx(), rhs_arg_params);
+
+        uni_vbroadcastss(vmm_tmp, dword[reg_dst_scales]);
+        uni_vmulps(vmm_dst, vmm_dst, vmm_tmp);
+    }
+
+    // Stores `src + residual` to the summed tensor, which is then normalized.
+    void add_residual() {
+        const auto dt = src_d_.data_type();
+        const size_t dt_size = src_d_.data_type_size();
+        const auto add_residual_body = [&](size_t offt_elems, bool tail) {
+            const size_t offt = offt_elems * dt_size;
+            io_[dt]->load(vmmword[reg_src + offt], vmm_dst, tail);
+            io_[dt]->load(vmmword[reg_residual + offt], vmm_tmp, tail);
+            uni_vaddps(vmm_dst, vmm_dst, vmm_tmp);
+            io_[dt]->store(vmm_dst, vmmword[reg_src_sum + offt], tail);
+        };
+
+        for (int i = 0; i < axis_simd_full_; i++)
+            add_residual_body(i * simd_w_, false);
+        if (axis_simd_tail_)
+            add_residual_body(axis_simd_full_ * simd_w_, true);
+    }
+
     void calculate_ne_convert_xf16_dst_body(
             size_t offt_elems, bool tail = false) {
         io_[src_d_.data_type()]->load_two_simdw_xf16(
@@ -390,7 +471,7 @@ protected:
             if (use_shift_)
                 io_[f32]->load(
                         shift_ptr(offt_elems + j * simd_w_), vmm_shift, tail);
-            uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+            if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
             uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
             if (use_scale_ && use_shift_)
                 uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -398,7 +479,7 @@ protected:
                 if (use_scale_) uni_vmulps(vmm_dst, vmm_dst, vmm_scale);
                 if (use_shift_) uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
             }
-            uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+            apply_scales_and_postops(vmm_dst, offt_elems + j * simd_w_, tail);
             io_[dst_d_.data_type()]->store(
                     vmm_dst, dst_ptr(offt_elems + j * simd_w_), tail);
         }
@@ -412,7 +493,7 @@ protected:
             io_[f32]->load(shift_ptr(offt_elems), vmm_shift, tail);
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_dst, tail);
-        uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_dst, vmm_dst, vmm_mean);
         uni_vmulps(vmm_dst, vmm_dst, vmm_inv_sqrtvar);
         if (use_scale_ && use_shift_)
             uni_vfmadd213ps(vmm_dst, vmm_scale, vmm_shift);
@@ -420,7 +501,7 @@ protected:
             if (use_scale_) uni_vmulps(vmm_dst, vmm_dst, vmm_scale);
             if (use_shift_) uni_vaddps(vmm_dst, vmm_dst, vmm_shift);
         }
-        uni_vmulps(vmm_dst, vmm_dst, vmm_combined_scales);
+        apply_scales_and_postops(vmm_dst, offt_elems, tail);
         io_[dst_d_.data_type()]->store(vmm_dst, dst_ptr(offt_elems), tail);
     }
 
@@ -448,12 +529,35 @@ protected:
                 = C_ * types::data_type_size(dst_d_.data_type());
         static const size_t float_size = types::data_type_size(f32);
 
+#define PARAM_OFF(x) offsetof(ker_args_t, x)
+        if (with_postops_) {
+            static constexpr bool preserve_gpr = true;
+            static constexpr bool preserve_vmm = true;
+            static constexpr bool use_exact_tail_scalar_bcast = true;
+            static constexpr std::size_t tmp_vmm_injector = 0u;
+
+            const binary_injector::rhs_arg_static_params_t rhs_sp {
+                    tmp_vmm_injector, reg_src_scales, reg_dst_scales,
+                    reg_var, preserve_gpr, preserve_vmm,
+                    PARAM_OFF(post_ops_binary_rhs_arg_vec), PARAM_OFF(dst_orig),
+                    dst_d_, static_cast<std::size_t>(axis_simd_tail_),
+                    Opmask(tail_opmask_idx), use_exact_tail_scalar_bcast};
+            const binary_injector::static_params_t bsp {reg_param,
+                    lnorm_impl::get_supported_bcast_strategies(), rhs_sp};
+            // The default opmask of the eltwise injector holds the tail mask.
+            const eltwise_injector::static_params_t esp {true,
+                    Xbyak::util::rax, Opmask(injector_opmask_idx)};
+
+            postops_injector_ = utils::make_unique<
+                    injector::jit_uni_postops_injector_t<isa>>(
+                    this, pd_->attr()->post_ops_, bsp, esp);
+        }
+
         preamble();
 
         io_.init_bf16();
         if (axis_simd_tail_) io_.prepare_tail_mask();
 
-#define PARAM_OFF(x) offsetof(ker_args_t, x)
         mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
         mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(scale)]);
@@ -464,6 +568,10 @@ protected:
         mov(reg_dst_scales, ptr[reg_param + PARAM_OFF(dst_scales)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
         mov(reg_eps, ptr[reg_param + PARAM_OFF(eps)]);
+        if (fuse_residual_add_) {
+            mov(reg_residual, ptr[reg_param + PARAM_OFF(residual)]);
+            mov(reg_src_sum, ptr[reg_param + PARAM_OFF(src_sum)]);
+        }
 #undef PARAM_OFF
 
         uni_vmovq(xmm_tmp, reg_eps);
@@ -484,14 +592,18 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
+            if (fuse_residual_add_) add_residual();
+
             if (calculate_stats_) {
                 // compute stats
-                compute_mean();
+                if (!skip_mean_) compute_mean();
                 compute_var();
             } else {
                 // read mean and var from input
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
                 uni_vmovss(xmm_tmp, dword[reg_var]);
                 uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
             }
@@ -504,9 +616,11 @@ protected:
             // precompute and broadcast scales (in case of runtime)
             uni_vmovss(xmm_tmp, dword[reg_src_scales]);
             uni_vbroadcastss(vmm_combined_scales, xmm_tmp);
-            uni_vmovss(xmm_tmp, dword[reg_dst_scales]);
-            uni_vbroadcastss(vmm_tmp, xmm_tmp);
-            uni_vmulps(vmm_combined_scales, vmm_combined_scales, vmm_tmp);
+            if (!with_postops_) {
+                uni_vmovss(xmm_tmp, dword[reg_dst_scales]);
+                uni_vbroadcastss(vmm_tmp, xmm_tmp);
+                uni_vmulps(vmm_combined_scales, vmm_combined_scales, vmm_tmp);
+            }
             io_.init_saturate_f32({dst_d_.data_type()});
 
             // calculate dst
@@ -516,11 +630,18 @@ protected:
             add(reg_dst, c_dst_size);
             add(reg_mean, float_size);
             add(reg_var, float_size);
+            if (fuse_residual_add_) {
+                add(reg_residual, c_src_size);
+                add(reg_src_sum, c_src_size);
+            }
             jmp(unroll_loop);
         }
         L(end);
 
         postamble();
+
+        if (with_eltwise_ && postops_injector_)
+            postops_injector_->prepare_table();
     }
 };
 
@@ -631,6 +752,7 @@ struct jit_diff_ss_kernel_t : diff_ss_kernel_t, public jit_generator {
         , C_(pd_->norm_axis())
         , axis_simd_full_(C_ / simd_w_)
         , axis_simd_tail_(C_ % simd_w_)
+        , skip_mean_(pd_->skip_mean())
         , eps_(pd_->desc()->layer_norm_epsilon) {
 
         io::io_conf_t io_conf;
@@ -670,6 +792,7 @@ protected:
     const dim_t C_;
     const dim_t axis_simd_full_;
     const dim_t axis_simd_tail_;
+    const bool skip_mean_;
     const float eps_;
 
     const Reg64 reg_param = abi_param1;
@@ -720,7 +843,7 @@ protected:
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
         uni_vaddps(vmm_dshift, vmm_dshift, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
         uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
         uni_vfmadd231ps(vmm_dscale, vmm_src, vmm_ddst);
 
@@ -759,8 +882,10 @@ protected:
             cmp(reg_block_end, reg_src);
             jle(end, T_NEAR);
 
-            uni_vmovss(xmm_tmp, dword[reg_mean]);
-            uni_vbroadcastss(vmm_mean, xmm_tmp);
+            if (!skip_mean_) {
+                uni_vmovss(xmm_tmp, dword[reg_mean]);
+                uni_vbroadcastss(vmm_mean, xmm_tmp);
+            }
             uni_vmovss(xmm_tmp, dword[reg_inv_sqrtvar]);
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
@@ -825,7 +950,8 @@ struct jit_diff_data_base_kernel_t : diff_data_kernel_t, public jit_generator {
         , axis_simd_tail_(C_ % simd_w_)
         , use_scale_(pd_->use_scale())
         , use_shift_(pd_->use_shift())
-        , calculate_diff_stats_(!pd_->stats_are_src()) {
+        , calculate_diff_stats_(!pd_->stats_are_src())
+        , skip_mean_(pd_->skip_mean()) {
 
         io::io_conf_t io_conf;
         io::io_tail_conf_t io_tail_conf(simd_w_, axis_simd_tail_,
@@ -871,6 +997,7 @@ protected:
     const bool use_scale_;
     const bool use_shift_;
     const bool calculate_diff_stats_;
+    const bool skip_mean_;
 
     const Reg64 reg_param = abi_param1;
     const Reg64 reg_src = rdx;
@@ -929,8 +1056,10 @@ protected:
         }
         io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
 
-        uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
-        uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        if (!skip_mean_) {
+            uni_vaddps(vmm_dd_scale, vmm_dd_scale, vmm_ddst);
+            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+        }
         uni_vfmadd231ps(vmm_dd_scale_x, vmm_ddst, vmm_src);
     };
 
@@ -943,9 +1072,13 @@ protected:
         }
         if (calculate_diff_stats_) {
             io_[src_d_.data_type()]->load(src_ptr(offt_elems), vmm_src, tail);
-            uni_vsubps(vmm_src, vmm_src, vmm_mean);
+            // RMS normalization has no mean, hence no gradient through it.
+            if (!skip_mean_) uni_vsubps(vmm_src, vmm_src, vmm_mean);
             uni_vmulps(vmm_src, vmm_src, vmm_inv_sqrtvar);
-            uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
+            if (skip_mean_)
+                uni_vmulps(vmm_src, vmm_src, vmm_dd_scale_x);
+            else
+                uni_vfmadd213ps(vmm_src, vmm_dd_scale_x, vmm_dd_scale);
             uni_vdivps(vmm_src, vmm_src, vmm_C);
             uni_vsubps(vmm_dsrc, vmm_dsrc, vmm_src);
         }
@@ -973,7 +1106,7 @@ protected:
         mov(reg_diff_src, ptr[reg_param + PARAM_OFF(diff_src)]);
         mov(reg_scale, ptr[reg_param + PARAM_OFF(ss)]);
 
-        if (calculate_diff_stats_)
+        if (calculate_diff_stats_ && !skip_mean_)
             mov(reg_mean, ptr[reg_param + PARAM_OFF(mean)]);
         mov(reg_inv_sqrtvar, ptr[reg_param + PARAM_OFF(inv_sqrtvar)]);
         mov(reg_block_end, ptr[reg_param + PARAM_OFF(block_size)]);
@@ -996,8 +1129,10 @@ protected:
             uni_vbroadcastss(vmm_inv_sqrtvar, xmm_tmp);
 
             if (calculate_diff_stats_) {
-                uni_vmovss(xmm_tmp, dword[reg_mean]);
-                uni_vbroadcastss(vmm_mean, xmm_tmp);
+                if (!skip_mean_) {
+                    uni_vmovss(xmm_tmp, dword[reg_mean]);
+                    uni_vbroadcastss(vmm_mean, xmm_tmp);
+                }
 
                 uni_vpxor(vmm_dd_scale, vmm_dd_scale, vmm_dd_scale);
                 uni_vpxor(vmm_dd_scale_x, vmm_dd_scale_x, vmm_dd_scale_x);
@@ -1007,7 +1142,7 @@ protected:
                 if (axis_simd_tail_)
                     compute_dd_scales(axis_simd_full_ * simd_w_, true);
 
-                reduce(vmm_dd_scale, vmm_tmp);
+                if (!skip_mean_) reduce(vmm_dd_scale, vmm_tmp);
                 reduce(vmm_dd_scale_x, vmm_tmp);
                 uni_vmulps(vmm_dd_scale_x, vmm_dd_scale_x, vmm_inv_sqrtvar);
             }
@@ -1020,7 +1155,8 @@ protected:
             add(reg_src, c_src_size);
             add(reg_diff_dst, c_ddst_size);
             add(reg_diff_src, c_dsrc_size);
-            if (calculate_diff_stats_) add(reg_mean, float_size);
+            if (calculate_diff_stats_ && !skip_mean_)
+                add(reg_mean, float_size);
             add(reg_inv_sqrtvar, float_size);
             jmp(unroll_loop);
         }
@@ -1104,11 +1240,19 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
 
+    const auto residual = CTX_IN_MEM(const char *, DNNL_ARG_SRC_1);
+    auto src_sum = CTX_OUT_MEM(char *, DNNL_ARG_DST_1);
+    const auto post_ops_binary_rhs_arg_vec
+            = binary_injector::prepare_binary_args(
+                    pd()->attr()->post_ops_, ctx);
+
     const memory_desc_wrapper src_d(pd()->src_md());
     const memory_desc_wrapper dst_d(pd()->dst_md());
 
     const dim_t N = pd()->across_axis();
     const dim_t C_padded = src_d.padded_dims()[pd()->ndims() - 1];
+    const bool skip_mean = pd()->skip_mean();
+    const bool fuse_residual_add = pd()->fuse_residual_add();
 
     parallel(0, [&](const int ithr, const int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -1119,8 +1263,17 @@ status_t jit_uni_layer_normalization_fwd_t::execute_forward(
         char *const __restrict dst_ptr = reinterpret_cast<char *>(dst)
                 + N_start * C_padded * dst_d.data_type_size();
         const int block_size = N_end - N_start;
-        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, &mean[N_start],
-                &variance[N_start], src_scales, dst_scales, block_size);
+        float *const mean_ptr = skip_mean ? nullptr : &mean[N_start];
+        const char *const residual_ptr = fuse_residual_add
+                ? residual + N_start * C_padded * src_d.data_type_size()
+                : nullptr;
+        char *const src_sum_ptr = fuse_residual_add
+                ? src_sum + N_start * C_padded * src_d.data_type_size()
+                : nullptr;
+        (*stat_and_data_kernel_)(src_ptr, dst_ptr, scale, shift, mean_ptr,
+                &variance[N_start], src_scales, dst_scales, residual_ptr,
+                src_sum_ptr, post_ops_binary_rhs_arg_vec.data(), dst,
+                block_size);
     });
     return status::success;
 }
@@ -1168,6 +1321,7 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
     }
 
     const int max_nthr = pd()->nthr_;
+    const bool skip_mean = pd()->skip_mean();
 
     parallel(max_nthr, [&](int ithr, int nthr) {
         dim_t N_start = 0, N_end = 0;
@@ -1186,8 +1340,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
             my_diff_gamma[c] = 0.;
             my_diff_beta[c] = 0.;
         }
+        const float *const mean_ptr = skip_mean ? nullptr : &mean[N_start];
         (*diff_ss_kernel_)(src_ptr, diff_dst_ptr, my_diff_gamma, my_diff_beta,
-                &mean[N_start], &variance[N_start], &inv_sqrtvar[N_start],
+                mean_ptr, &variance[N_start], &inv_sqrtvar[N_start],
                 block_size);
     });
 
@@ -1214,8 +1369,9 @@ status_t jit_uni_layer_normalization_bwd_t::execute_backward(
         char *const __restrict diff_src_ptr = reinterpret_cast<char *>(diff_src)
                 + N_start * C_padded * diff_src_d.data_type_size();
 
+        const float *const mean_ptr = skip_mean ? nullptr : &mean[N_start];
         (*diff_data_kernel_)(src_ptr, diff_dst_ptr, diff_src_ptr, scale,
-                &mean[N_start], &inv_sqrtvar[N_start], block_size);
+                mean_ptr, &inv_sqrtvar[N_start], block_size);
     });
     return status::success;
 }
@@ -30,12 +30,17 @@
 #include "cpu/cpu_layer_normalization_pd.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
 
 namespace dnnl {
 namespace impl {
 namespace cpu {
 namespace x64 {
 
+namespace lnorm_impl {
+bcast_set_t get_supported_bcast_strategies();
+} // namespace lnorm_impl
+
 struct stat_and_data_kernel_t {
     static stat_and_data_kernel_t *create(const layer_normalization_pd_t *pd);
     virtual ~stat_and_data_kernel_t() = default;
@@ -43,6 +48,8 @@ struct stat_and_data_kernel_t {
     virtual void operator()(const void *src, void *dst, const float *scale,
             const float *shift, float *mean, float *var,
             const float *src_scales, const float *dst_scales,
+            const void *residual, void *src_sum,
+            const void *post_ops_binary_rhs_arg_vec, const void *dst_orig,
             const size_t block_size) const {};
 
     virtual status_t create_kernel() { return status::success; }
@@ -111,8 +118,14 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
                             mayiuse(avx512_core_fp16) || mayiuse(avx2_vnni_2))
                     && stat_md()->data_type == f32
                     && check_scale_shift_data_type()
-                    && attr()->has_default_values(skip_mask_t::scales_runtime)
+                    // the summed tensor is stored in the source data type
+                    && IMPLICATION(fuse_residual_add(),
+                            utils::one_of(src_md()->data_type, f32, bf16, f16))
+                    && attr()->has_default_values(skip_mask_t::scales_runtime
+                            | skip_mask_t::post_ops)
                     && attr_scales_ok() && set_default_formats_common()
+                    && post_ops_ok()
+                    && attr_.set_default_formats(dst_md(0)) == status::success
                     && src_d.is_blocking_desc()
                     // plain format, last logical dim is last physical
                     && src_d.blocking_desc().strides[ndims() - 1] == 1;
@@ -136,6 +149,18 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         memory_desc_t reordered_stat_md_;
 
     private:
+        bool post_ops_ok() const {
+            const cpu_isa_t isa = mayiuse(avx512_core) ? avx512_core
+                    : mayiuse(avx2)                    ? avx2
+                                                       : sse41;
+            const memory_desc_wrapper dst_d(dst_md());
+            injector::post_ops_ok_args_t post_ops_args(isa,
+                    {injector::eltwise, injector::binary}, attr()->post_ops_,
+                    &dst_d, true, true, true, true,
+                    lnorm_impl::get_supported_bcast_strategies());
+            return injector::post_ops_ok(post_ops_args);
+        }
+
         void init_scratchpad() {
             using namespace memory_tracking::names;
             auto scratchpad = scratchpad_registry().registrar();
@@ -193,8 +218,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
 
         // reorder input stats
         if (pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
@@ -202,8 +228,9 @@ struct jit_uni_layer_normalization_fwd_t : public primitive_t {
         if (status != status::success) return status;
         // reorder output stats
         if (!pd()->stats_are_src() && reorder_) {
-            reorder_stat(
-                    ctx, engine, {&mean, true}, ctx.args().at(DNNL_ARG_MEAN));
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, {&mean, true},
+                        ctx.args().at(DNNL_ARG_MEAN));
             reorder_stat(ctx, engine, {&variance, true},
                     ctx.args().at(DNNL_ARG_VARIANCE));
         }
@@ -336,8 +363,9 @@ struct jit_uni_layer_normalization_bwd_t : public primitive_t {
                     engine, &(pd()->reordered_stat_md_), std::move(mean_mem));
             memory_t variance(engine, &(pd()->reordered_stat_md_),
                     std::move(variance_mem));
-            reorder_stat(
-                    ctx, engine, ctx.args().at(DNNL_ARG_MEAN), {&mean, false});
+            if (!pd()->skip_mean())
+                reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_MEAN),
+                        {&mean, false});
             reorder_stat(ctx, engine, ctx.args().at(DNNL_ARG_VARIANCE),
                     {&variance, false});
         }
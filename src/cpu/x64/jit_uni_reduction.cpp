@@ -35,6 +35,9 @@ static cpu_isa_t get_supported_isa() {
     return isa_undef;
 }
 
+// The number of f32 values in a zmm, a multiple of all vector lengths.
+static constexpr dim_t max_simd_w = 16;
+
 static bool impl_supports_datatype(data_type_t data_type) {
     switch (data_type) {
         case data_type::bf16:
@@ -75,14 +78,61 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     const auto src_mdw = memory_desc_wrapper(src_md());
     const auto dst_mdw = memory_desc_wrapper(dst_md());
 
+    const format_tag_t src_md_desired_format = memory_desc_matches_one_of_tag(
+            *src_md(), x, nc, ncw, nchw, ncdhw);
+    const format_tag_t dst_md_desired_format = memory_desc_matches_one_of_tag(
+            *dst_md(), x, nc, ncw, nchw, ncdhw);
+    if (src_md_desired_format != dst_md_desired_format
+            || src_md_desired_format == format_tag::undef)
+        return status::unimplemented;
+
+    const int ndims = src_mdw.ndims();
+    const auto &src_dims = src_mdw.dims();
+    const auto &dst_dims = dst_mdw.dims();
+
+    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
+
+    // The reduced dimensions must be adjacent: src is viewed as
+    // [outer][reduce][inner], where dimensions of size one belong to any
+    // group.
+    conf_.idle_size = dst_mdw.nelems();
+    conf_.reduce_size = 1;
+    conf_.inner_size = 1;
+    int d = ndims - 1;
+    for (; d >= 0 && src_dims[d] == dst_dims[d]; --d)
+        conf_.inner_size *= src_dims[d];
+    for (; d >= 0 && (src_dims[d] != dst_dims[d] || src_dims[d] == 1); --d)
+        conf_.reduce_size *= src_dims[d];
+    for (; d >= 0; --d)
+        if (src_dims[d] != dst_dims[d]) return status::unimplemented;
+
+    if (conf_.reduce_size == 1) return status::unimplemented;
+    if (conf_.inner_size == 1)
+        conf_.inner_blk = 1;
+    else {
+        conf_.inner_blk = nstl::min<dim_t>(
+                utils::rnd_up(conf_.inner_size, max_simd_w), 4 * max_simd_w);
+        // the stride between rows is an immediate value in strided kernels
+        const dim_t max_stride = INT_MAX;
+        if (conf_.inner_size * (dim_t)conf_.src_dt_size > max_stride)
+            return status::unimplemented;
+    }
+    conf_.mean_size = conf_.reduce_size;
+
+    const bool is_strided = conf_.inner_size > 1;
     const std::vector<injector::post_op_type> accepted_post_ops
             = {injector::sum, injector::eltwise, injector::binary};
     static constexpr bool sum_at_0_pos_only = false;
     static constexpr bool sum_requires_scale_one = false;
     static constexpr bool sum_requires_zp_zero = true;
     static constexpr bool sum_requires_same_params = false;
-    const bcast_set_t accepted_broadcasts
-            = {broadcasting_strategy_t::scalar, broadcasting_strategy_t::per_oc,
+    // Strided kernels store vectors of outputs, which may cross the
+    // boundaries of channels.
+    const bcast_set_t accepted_broadcasts = is_strided
+            ? bcast_set_t {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::no_broadcast}
+            : bcast_set_t {broadcasting_strategy_t::scalar,
+                    broadcasting_strategy_t::per_oc,
                     broadcasting_strategy_t::per_oc_spatial,
                     broadcasting_strategy_t::no_broadcast};
     injector::post_ops_ok_args_t post_ops_args(conf_.isa, accepted_post_ops,
@@ -108,42 +158,80 @@ status_t jit_uni_reduction_t::pd_t::init(engine_t *engine) {
     conf_.with_postops
             = conf_.with_eltwise || conf_.with_binary || conf_.with_sum;
 
-    const format_tag_t src_md_desired_format = memory_desc_matches_one_of_tag(
-            *src_md(), x, nc, ncw, nchw, ncdhw);
-    const format_tag_t dst_md_desired_format = memory_desc_matches_one_of_tag(
-            *dst_md(), x, nc, ncw, nchw, ncdhw);
-    if (src_md_desired_format != dst_md_desired_format
-            || src_md_desired_format == format_tag::undef)
-        return status::unimplemented;
-
-    const int ndims = src_mdw.ndims();
-    const auto &src_dims = src_mdw.dims();
-    const auto &dst_dims = dst_mdw.dims();
-
-    conf_.is_saturation_needed = utils::one_of(conf_.dst_type, s32, s8, u8);
-
-    int num_of_reduced_dims = 0;
-    conf_.idle_size = dst_mdw.nelems();
-    conf_.reduce_size = 1;
-    for (int d = ndims - 1; d >= 0; --d) {
-        if (src_dims[d] != dst_dims[d]) {
-            num_of_reduced_dims++;
-            conf_.reduce_size *= src_dims[d];
-        } else
-            break;
+    conf_.alg = desc()->alg_kind;
+    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
+                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum)) {
+        // |src|^p is computed in f32, integer sources are not supported.
+        if (!utils::one_of(conf_.src_type, data_type::f32, data_type::bf16,
+                    data_type::f16))
+            return status::unimplemented;
+        conf_.p = desc()->p;
+        conf_.eps = desc()->eps;
     }
 
-    if (num_of_reduced_dims == 0) return status::unimplemented;
+    init_reduce_split();
 
-    for (int d = 0; d < ndims - num_of_reduced_dims; ++d)
-        if (src_dims[d] != dst_dims[d]) return status::unimplemented;
+    return status::success;
+}
 
-    conf_.alg = desc()->alg_kind;
-    if (utils::one_of(conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum,
-                reduction_norm_lp_power_p_max, reduction_norm_lp_power_p_sum))
-        return status::unimplemented;
+void jit_uni_reduction_t::pd_t::init_reduce_split() {
+    using namespace data_type;
 
-    return status::success;
+    // Not enough idle work for all the threads: the reduced range is split
+    // into chunks, which are reduced into f32 partial results, and the
+    // partial results are then reduced by the final kernel.
+    const dim_t nthr = dnnl_get_max_threads();
+    const dim_t outer_size = conf_.idle_size / conf_.inner_size;
+    const dim_t work_amount = outer_size
+            * utils::div_up(conf_.inner_size, conf_.inner_blk);
+    const dim_t row_size = nstl::min(conf_.inner_size, conf_.inner_blk);
+    const dim_t min_chunk_elems = 4096;
+    const dim_t max_nchunks = conf_.reduce_size * row_size / min_chunk_elems;
+    if (work_amount >= nthr || max_nchunks < 2) return;
+
+    dim_t nchunks = nstl::min(nthr / work_amount, max_nchunks);
+    // Chunks of trailing reductions consist of full vectors only.
+    const dim_t chunk_blk = conf_.inner_size == 1 ? max_simd_w : 1;
+    const dim_t chunk = utils::rnd_up(
+            utils::div_up(conf_.reduce_size, nchunks), chunk_blk);
+    nchunks = utils::div_up(conf_.reduce_size, chunk);
+    if (nchunks < 2) return;
+
+    partial_conf_ = conf_;
+    partial_conf_.dst_type = f32;
+    partial_conf_.dst_dt_size = types::data_type_size(f32);
+    partial_conf_.is_saturation_needed = false;
+    if (conf_.alg == alg_kind::reduction_mean)
+        partial_conf_.alg = alg_kind::reduction_sum;
+    // Partial lp-norms are plain sums of |src|^p, eps and the root are
+    // applied by the final kernel only.
+    const bool is_lp_norm = utils::one_of(conf_.alg,
+            alg_kind::reduction_norm_lp_max, alg_kind::reduction_norm_lp_sum,
+            alg_kind::reduction_norm_lp_power_p_max,
+            alg_kind::reduction_norm_lp_power_p_sum);
+    if (is_lp_norm) {
+        partial_conf_.alg = alg_kind::reduction_norm_lp_power_p_sum;
+        partial_conf_.eps = 0.f;
+    }
+    partial_conf_.post_ops = post_ops_t();
+    partial_conf_.with_postops = partial_conf_.with_eltwise
+            = partial_conf_.with_binary = partial_conf_.with_sum = false;
+    partial_conf_.sum_scales = std::queue<float>();
+    partial_conf_.reduce_size = chunk;
+
+    partial_tail_conf_ = partial_conf_;
+    partial_tail_conf_.reduce_size = conf_.reduce_size - (nchunks - 1) * chunk;
+
+    conf_.src_type = f32;
+    conf_.src_dt_size = types::data_type_size(f32);
+    conf_.reduce_size = nchunks;
+    conf_.reduce_nchunks = nchunks;
+    conf_.reduce_chunk = chunk;
+    conf_.src_is_power_p = is_lp_norm;
+
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(memory_tracking::names::key_reduction,
+            outer_size * nchunks * conf_.inner_size);
 }
 
 status_t jit_uni_reduction_t::init(engine_t *engine) {
@@ -152,9 +240,18 @@ status_t jit_uni_reduction_t::init(engine_t *engine) {
     const memory_desc_t *dst_md = pd()->dst_md();
     const jit_reduction_conf_t &conf = pd()->get_conf();
 
-    CHECK(get_proper_kernel(dst_md, conf));
+    CHECK(get_proper_kernel(kernel_, dst_md, conf));
     CHECK(kernel_->create_kernel());
 
+    if (conf.reduce_nchunks > 1) {
+        CHECK(get_proper_kernel(
+                partial_kernel_, dst_md, pd()->get_partial_conf()));
+        CHECK(partial_kernel_->create_kernel());
+        CHECK(get_proper_kernel(
+                partial_tail_kernel_, dst_md, pd()->get_partial_tail_conf()));
+        CHECK(partial_tail_kernel_->create_kernel());
+    }
+
     return status::success;
 }
 
@@ -162,75 +259,132 @@ status_t jit_uni_reduction_t::execute(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const uint8_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(uint8_t *, DNNL_ARG_DST);
 
-    const dim_t idle_size = pd()->get_conf().idle_size;
-    const dim_t reduce_size = pd()->get_conf().reduce_size;
-    const std::size_t src_dt_size = pd()->get_conf().src_dt_size;
-    const std::size_t dst_dt_size = pd()->get_conf().dst_dt_size;
+    const auto &conf = pd()->get_conf();
+    const dim_t inner_size = conf.inner_size;
+    const dim_t inner_blk = conf.inner_blk;
+    const dim_t outer_size = conf.idle_size / inner_size;
+    const dim_t nb_inner = utils::div_up(inner_size, inner_blk);
+    const std::size_t dst_dt_size = conf.dst_dt_size;
     const auto &post_ops = pd()->attr()->post_ops_;
     const auto &post_ops_binary_rhs_arg_vec
             = binary_injector::prepare_binary_args(post_ops, ctx);
 
-    parallel_nd(idle_size, [&](dim_t i) {
-        const dim_t src_off = i * reduce_size * src_dt_size;
-        const dim_t dst_off = i * dst_dt_size;
+    // Reduces [reduce_size][inner_size] rows of src into one row of dst
+    // with a given kernel, the inner block ib only for strided kernels.
+    const auto reduce = [&](const jit_uni_reduction_kernel_base_t *kernel,
+                                const uint8_t *ker_src, uint8_t *ker_dst,
+                                std::size_t src_dt_size,
+                                std::size_t ker_dst_dt_size, dim_t ib) {
+        const dim_t inner_start = ib * inner_blk;
+        const dim_t inner_len
+                = nstl::min(inner_blk, inner_size - inner_start);
+        const dim_t simd_w = (dim_t)kernel->get_simd_w();
 
         jit_reduction_call_s args = jit_reduction_call_s();
-        args.src = src + src_off;
-        args.dst = dst + dst_off;
+        args.src = ker_src + inner_start * src_dt_size;
+        args.dst = ker_dst + inner_start * ker_dst_dt_size;
         args.dst_orig = dst;
         args.post_ops_binary_rhs_arg_vec = post_ops_binary_rhs_arg_vec.data();
+        args.inner_work = inner_len / simd_w;
+        args.inner_tail = inner_len % simd_w != 0;
+
+        (*kernel)(&args);
+    };
+
+    const dim_t nchunks = conf.reduce_nchunks;
+    if (nchunks == 1) {
+        const dim_t reduce_size = conf.reduce_size;
+        const std::size_t src_dt_size = conf.src_dt_size;
+        parallel_nd(outer_size, nb_inner, [&](dim_t o, dim_t ib) {
+            reduce(kernel_.get(),
+                    src + o * reduce_size * inner_size * src_dt_size,
+                    dst + o * inner_size * dst_dt_size, src_dt_size,
+                    dst_dt_size, ib);
+        });
+        return status::success;
+    }
 
-        (*kernel_)(&args);
+    // Partial results are laid out as [outer][nchunks][inner], so that the
+    // final kernel reduces them in the same way as a non-split source.
+    auto partial = ctx.get_scratchpad_grantor().template get<float>(
+            memory_tracking::names::key_reduction);
+    auto partial_ptr = reinterpret_cast<uint8_t *>(partial);
+    const auto &partial_conf = pd()->get_partial_conf();
+    const dim_t reduce_size = conf.reduce_chunk * (nchunks - 1)
+            + pd()->get_partial_tail_conf().reduce_size;
+    const std::size_t src_dt_size = partial_conf.src_dt_size;
+    const std::size_t partial_dt_size = sizeof(float);
+
+    parallel_nd(outer_size, nchunks, nb_inner,
+            [&](dim_t o, dim_t ic, dim_t ib) {
+                const auto *kernel = ic < nchunks - 1
+                        ? partial_kernel_.get()
+                        : partial_tail_kernel_.get();
+                const dim_t src_off
+                        = (o * reduce_size + ic * conf.reduce_chunk)
+                        * inner_size;
+                const dim_t partial_off = (o * nchunks + ic) * inner_size;
+                reduce(kernel, src + src_off * src_dt_size,
+                        partial_ptr + partial_off * partial_dt_size,
+                        src_dt_size, partial_dt_size, ib);
+            });
+
+    parallel_nd(outer_size, nb_inner, [&](dim_t o, dim_t ib) {
+        reduce(kernel_.get(),
+                partial_ptr + o * nchunks * inner_size * partial_dt_size,
+                dst + o * inner_size * dst_dt_size, partial_dt_size,
+                dst_dt_size, ib);
     });
 
     return status::success;
 }
 
 status_t jit_uni_reduction_t::get_proper_kernel(
+        std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
         const memory_desc_t *dst_md, const jit_reduction_conf_t &conf) {
     using namespace data_type;
 
     if (conf.isa == avx512_core_fp16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_fp16>(conf, dst_md));
     if (conf.isa == avx512_core_bf16)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core_bf16>(conf, dst_md));
     else if (conf.isa == avx512_core)
-        return safe_ptr_assign(kernel_,
+        return safe_ptr_assign(kernel,
                 new jit_uni_reduction_kernel_t<avx512_core>(conf, dst_md));
     else if (is_superset(conf.isa, avx)) {
         const bool is_src_i8 = utils::one_of(conf.src_type, s8, u8);
         const bool is_dst_i8 = utils::one_of(conf.dst_type, s8, u8);
         if (conf.isa == avx2_vnni_2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2_vnni_2>(
                                 conf, dst_md));
         } else if (conf.isa == avx2) {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx2>(conf, dst_md));
         } else {
             if (is_src_i8 || is_dst_i8)
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx, Xbyak::Xmm>(
                                 conf, dst_md));
             else
-                return safe_ptr_assign(kernel_,
+                return safe_ptr_assign(kernel,
                         new jit_uni_reduction_kernel_t<avx>(conf, dst_md));
         }
     } else if (conf.isa == sse41)
         return safe_ptr_assign(
-                kernel_, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
+                kernel, new jit_uni_reduction_kernel_t<sse41>(conf, dst_md));
     else
         return status::runtime_error;
 }
@@ -41,11 +41,22 @@ struct jit_uni_reduction_t : public primitive_t {
         status_t init(engine_t *engine);
 
         const jit_reduction_conf_t &get_conf() const { return conf_; };
+        const jit_reduction_conf_t &get_partial_conf() const {
+            return partial_conf_;
+        };
+        const jit_reduction_conf_t &get_partial_tail_conf() const {
+            return partial_tail_conf_;
+        };
 
     private:
         bool fill_post_ops_conf();
+        void init_reduce_split();
 
         jit_reduction_conf_t conf_;
+        // Confs of the kernels producing partial results of full chunks and
+        // of the last chunk of a split reduced range.
+        jit_reduction_conf_t partial_conf_;
+        jit_reduction_conf_t partial_tail_conf_;
     };
 
     jit_uni_reduction_t(const pd_t *apd) : primitive_t(apd) {}
@@ -56,11 +67,14 @@ struct jit_uni_reduction_t : public primitive_t {
 
 private:
     status_t get_proper_kernel(
+            std::unique_ptr<jit_uni_reduction_kernel_base_t> &kernel,
             const memory_desc_t *dst_md, const jit_reduction_conf_t &conf);
 
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
 
     std::unique_ptr<jit_uni_reduction_kernel_base_t> kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> partial_kernel_;
+    std::unique_ptr<jit_uni_reduction_kernel_base_t> partial_tail_kernel_;
 };
 
 } // namespace x64
@@ -38,7 +38,14 @@ template <cpu_isa_t isa, typename Vmm>
 jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
         const jit_reduction_conf_t &conf, const memory_desc_t *dst_md)
     : jit_uni_reduction_kernel_base_t(conf)
-    , load_tail_size_(conf.reduce_size % simd_w_)
+    , is_strided_(conf.inner_size > 1)
+    , is_lp_norm_(utils::one_of(conf.alg, alg_kind::reduction_norm_lp_max,
+              alg_kind::reduction_norm_lp_sum,
+              alg_kind::reduction_norm_lp_power_p_max,
+              alg_kind::reduction_norm_lp_power_p_sum))
+    , load_tail_size_(
+              (is_strided_ ? conf.inner_size : conf.reduce_size) % simd_w_)
+    , store_tail_size_(is_strided_ ? load_tail_size_ : 1)
     , io_load_(this, isa, conf_.src_type, {false},
               io::io_tail_conf_t {simd_w_, load_tail_size_, k_tail_load_mask_,
                       vmm_tail_load_mask_.getIdx(), reg_tmp_},
@@ -56,6 +63,21 @@ jit_uni_reduction_kernel_t<isa, Vmm>::jit_uni_reduction_kernel_t(
     init_compute_op();
     init_compute_scalar_op();
     if (conf_.with_postops) init_post_ops_injector(dst_md);
+
+    if (is_lp_norm_ && !utils::one_of(conf_.p, 1.f, 2.f)) {
+        using namespace alg_kind;
+        if (!conf_.src_is_power_p)
+            power_injector_.reset(
+                    new jit_uni_eltwise_injector_f32<inject_isa_, Vmm>(this,
+                            eltwise_pow, 1.f, conf_.p, 1.f, true,
+                            reg_power_table_, k_lp_norm_mask_));
+        if (utils::one_of(
+                    conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum))
+            root_injector_.reset(
+                    new jit_uni_eltwise_injector_f32<inject_isa_, Vmm>(this,
+                            eltwise_pow, 1.f, 1.f / conf_.p, 1.f, true,
+                            reg_root_table_, k_lp_norm_mask_));
+    }
 }
 
 template <cpu_isa_t isa, typename Vmm>
@@ -74,6 +96,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_acc() {
         case reduction_mean:
         case reduction_sum: starting_val = 0.f; break;
         case reduction_mul: starting_val = 1.f; break;
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum: starting_val = 0.f; break;
         default: assert(!"unknown alg");
     }
 
@@ -98,6 +124,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_op_ = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                 uni_vaddps(acc, acc, to_acc);
             };
@@ -130,6 +160,10 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::init_compute_scalar_op() {
             break;
         case reduction_mean:
         case reduction_sum:
+        case reduction_norm_lp_max:
+        case reduction_norm_lp_sum:
+        case reduction_norm_lp_power_p_max:
+        case reduction_norm_lp_power_p_sum:
             compute_scalar_op_
                     = [&](const Xbyak::Xmm &acc, const Xbyak::Xmm &to_acc) {
                           addss(acc, to_acc);
@@ -271,6 +305,8 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
         cmp(reg_work_, 2);
         jl(label_work_tail_begin);
         io_load_.load_two_simdw_xf16(ptr[reg_src_], vmm_tmp1_, vmm_tmp2_);
+        apply_power(vmm_tmp1_);
+        apply_power(vmm_tmp2_);
 
         compute_op_(vmm_acc_, vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp2_);
@@ -286,6 +322,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
         cmp(reg_work_, 0);
         je(label_work_tail_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_power(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -297,6 +334,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_ne_convert_xf16() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_power(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -312,6 +350,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
         cmp(reg_work_, 0);
         je(label_work_end);
         io_load_.load(ptr[reg_src_], vmm_tmp1_, false);
+        apply_power(vmm_tmp1_);
         compute_op_(vmm_acc_, vmm_tmp1_);
 
         add(reg_src_, simd_w_ * conf_.src_dt_size);
@@ -323,6 +362,7 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_base() {
 
     if (load_tail_size_) {
         io_load_.load(ptr[reg_src_], vmm_tmp1_, true);
+        apply_power(vmm_tmp1_);
         reduce_vmm_to_scalar(
                 vmm_tmp1_, vmm_tmp2_, vmm_tmp3_, vmm_tmp4_, load_tail_size_);
         compute_scalar_op_(Xmm(vmm_acc_.getIdx()), Xmm(vmm_tmp1_.getIdx()));
@@ -338,23 +378,149 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::reduce() {
         reduce_base();
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::broadcast_f32(
+        const Vmm &vmm, float val) {
+    const Xmm xmm(vmm.getIdx());
+    mov(reg_tmp_.cvt32(), float2int(val));
+    uni_vmovd(xmm, reg_tmp_.cvt32());
+    uni_vbroadcastss(vmm, xmm);
+}
+
+// Replaces loaded values with |src|^p for lp-norms.
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_power(const Vmm &vmm) {
+    if (!is_lp_norm_ || conf_.src_is_power_p) return;
+
+    if (conf_.p == 2.f) {
+        uni_vmulps(vmm, vmm, vmm);
+        return;
+    }
+    uni_vandps(vmm, vmm, vmm_abs_mask_);
+    if (power_injector_) power_injector_->compute_vector(vmm.getIdx());
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_lp_norm_finalization(
+        const Vmm &vmm_acc, const Vmm &vmm_eps) {
+    using namespace alg_kind;
+    if (!is_lp_norm_) return;
+
+    const bool is_max = utils::one_of(
+            conf_.alg, reduction_norm_lp_max, reduction_norm_lp_power_p_max);
+    const bool with_root = utils::one_of(
+            conf_.alg, reduction_norm_lp_max, reduction_norm_lp_sum);
+    if (is_max)
+        uni_vmaxps(vmm_acc, vmm_acc, vmm_eps);
+    else
+        uni_vaddps(vmm_acc, vmm_acc, vmm_eps);
+
+    if (with_root) {
+        if (conf_.p == 2.f)
+            uni_vsqrtps(vmm_acc, vmm_acc);
+        else if (root_injector_)
+            root_injector_->compute_vector(vmm_acc.getIdx());
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_strided_block(
+        const int ur, const bool tail) {
+    Label label_reduce_begin;
+
+    const auto acc = [&](int u) { return Vmm(vmm_strided_acc_start_idx_ + u); };
+
+    for (int u = 0; u < ur; u++)
+        uni_vmovups(acc(u), vmm_acc_);
+
+    mov(reg_src_reduce_, reg_src_);
+    mov(reg_reduce_work_, conf_.reduce_size);
+    L(label_reduce_begin);
+    {
+        for (int u = 0; u < ur; u++) {
+            io_load_.load(
+                    ptr[reg_src_reduce_ + u * simd_w_ * conf_.src_dt_size],
+                    vmm_tmp1_, tail);
+            apply_power(vmm_tmp1_);
+            compute_op_(acc(u), vmm_tmp1_);
+        }
+        add(reg_src_reduce_, conf_.inner_size * conf_.src_dt_size);
+        dec(reg_reduce_work_);
+        jnz(label_reduce_begin, T_NEAR);
+    }
+
+    for (int u = 0; u < ur; u++) {
+        const std::size_t dst_off = u * simd_w_ * conf_.dst_dt_size;
+        if (conf_.alg == alg_kind::reduction_mean)
+            uni_vdivps(acc(u), acc(u), vmm_tmp4_);
+        apply_lp_norm_finalization(acc(u), vmm_tmp4_);
+        if (conf_.with_postops) apply_postops(acc(u).getIdx(), dst_off, tail);
+        io_store_.store(acc(u), ptr[reg_dst_ + dst_off], tail);
+    }
+}
+
+// Reduces the rows of a [reduce_size][inner_size] block into a row of
+// inner_size values, i.e. every vector lane accumulates its own output.
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_reduction_kernel_t<isa, Vmm>::reduce_strided() {
+    Label label_ur_begin, label_single_begin, label_tail, label_end;
+
+    if (conf_.alg == alg_kind::reduction_mean)
+        broadcast_f32(vmm_tmp4_, static_cast<float>(conf_.mean_size));
+    if (is_lp_norm_) broadcast_f32(vmm_tmp4_, conf_.eps);
+
+    L(label_ur_begin);
+    {
+        cmp(reg_work_, ur_strided_);
+        jl(label_single_begin, T_NEAR);
+        reduce_strided_block(ur_strided_, false);
+        add(reg_src_, ur_strided_ * simd_w_ * conf_.src_dt_size);
+        add(reg_dst_, ur_strided_ * simd_w_ * conf_.dst_dt_size);
+        sub(reg_work_, ur_strided_);
+        jmp(label_ur_begin, T_NEAR);
+    }
+
+    L(label_single_begin);
+    {
+        cmp(reg_work_, 0);
+        je(label_tail, T_NEAR);
+        reduce_strided_block(1, false);
+        add(reg_src_, simd_w_ * conf_.src_dt_size);
+        add(reg_dst_, simd_w_ * conf_.dst_dt_size);
+        dec(reg_work_);
+        jmp(label_single_begin, T_NEAR);
+    }
+
+    L(label_tail);
+    if (load_tail_size_) {
+        cmp(qword[reg_param_ + GET_OFF(inner_tail)], 0);
+        je(label_end, T_NEAR);
+        reduce_strided_block(1, true);
+    }
+    L(label_end);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_reduction_kernel_t<isa, Vmm>::load_params() {
     mov(reg_src_, ptr[reg_param_ + GET_OFF(src)]);
     mov(reg_dst_, ptr[reg_param_ + GET_OFF(dst)]);
-    mov(reg_work_, conf_.reduce_size / simd_w_);
+    if (is_strided_)
+        mov(reg_work_, ptr[reg_param_ + GET_OFF(inner_work)]);
+    else
+        mov(reg_work_, conf_.reduce_size / simd_w_);
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(
+        const int data_idx, const std::size_t dst_off, const bool tail) {
     if (conf_.with_sum) {
         assert(!conf_.sum_scales.empty()
                 && "No scales for sum post operation.");
-        const auto sum_injector = [this, data_idx]() {
+        const auto sum_injector = [this, data_idx, dst_off, tail]() {
             const Vmm vmm_prev_dst(vmm_tmp1_.getIdx());
             const Vmm vmm_dst(data_idx);
 
-            io_store_.load(ptr[reg_dst_], vmm_prev_dst, true);
+            io_store_.load(ptr[reg_dst_ + dst_off], vmm_prev_dst, tail);
             const float sum_scale = sum_scales_.front();
             if (sum_scale == 1.f)
                 uni_vaddps(vmm_dst, vmm_dst, vmm_prev_dst);
@@ -374,14 +540,16 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::apply_sum(const int data_idx) {
 }
 
 template <cpu_isa_t isa, typename Vmm>
-void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(const int data_idx) {
+void jit_uni_reduction_kernel_t<isa, Vmm>::apply_postops(
+        const int data_idx, const std::size_t dst_off, const bool tail) {
     binary_injector::rhs_arg_dynamic_params_t rhs_arg_params;
 
-    if (conf_.with_sum) apply_sum(data_idx);
+    if (conf_.with_sum) apply_sum(data_idx, dst_off, tail);
 
     if (conf_.with_binary) {
         rhs_arg_params.vmm_idx_to_out_reg.emplace(data_idx, reg_dst_);
-        rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
+        rhs_arg_params.vmm_idx_to_out_elem_off_val.emplace(data_idx, dst_off);
+        if (tail) rhs_arg_params.vmm_tail_idx_.emplace(data_idx);
     }
 
     postops_injector_->compute_vector(data_idx, rhs_arg_params);
@@ -397,11 +565,16 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::finalize() {
     if (conf_.alg == alg_kind::reduction_mean) {
         const Xmm xmm_acc(vmm_acc_.getIdx());
         const Xmm xmm_reduce_size(vmm_tmp1_.getIdx());
-        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.reduce_size)));
+        mov(reg_tmp_.cvt32(), float2int(static_cast<float>(conf_.mean_size)));
         uni_vmovd(xmm_reduce_size, reg_tmp_.cvt32());
         uni_vdivss(xmm_acc, xmm_acc, xmm_reduce_size);
     }
 
+    if (is_lp_norm_) {
+        broadcast_f32(vmm_tmp1_, conf_.eps);
+        apply_lp_norm_finalization(vmm_acc_, vmm_tmp1_);
+    }
+
     if (conf_.with_postops) apply_postops(vmm_acc_.getIdx());
 
     io_store_.store(vmm_acc_, ptr[reg_dst_], true);
@@ -415,17 +588,29 @@ void jit_uni_reduction_kernel_t<isa, Vmm>::generate() {
     if (conf_.is_saturation_needed) io_store_.init_saturate_f32();
 
     if (load_tail_size_ > 0) io_load_.prepare_tail_mask();
-    io_store_.prepare_tail_mask();
+    if (store_tail_size_ > 0) io_store_.prepare_tail_mask();
+
+    if (is_lp_norm_ && !conf_.src_is_power_p && conf_.p != 2.f)
+        broadcast_f32(
+                vmm_abs_mask_, utils::bit_cast<float>(uint32_t(0x7fffffff)));
+    if (power_injector_) power_injector_->load_table_addr();
+    if (root_injector_) root_injector_->load_table_addr();
 
     load_params();
     init_acc();
-    reduce();
-    finalize();
+    if (is_strided_)
+        reduce_strided();
+    else {
+        reduce();
+        finalize();
+    }
 
     postamble();
 
     if (conf_.with_eltwise && postops_injector_)
         postops_injector_->prepare_table();
+    if (power_injector_) power_injector_->prepare_table();
+    if (root_injector_) root_injector_->prepare_table();
 }
 
 template struct jit_uni_reduction_kernel_t<avx512_core_fp16>;
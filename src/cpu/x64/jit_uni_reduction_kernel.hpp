@@ -42,7 +42,7 @@ struct jit_uni_reduction_kernel_base_t : public jit_generator {
         , sum_scales_(conf_.sum_scales) {}
     virtual ~jit_uni_reduction_kernel_base_t() = default;
 
-    virtual std::size_t get_simd_w() = 0;
+    virtual std::size_t get_simd_w() const = 0;
 
 protected:
     const jit_reduction_conf_t &conf_;
@@ -56,7 +56,7 @@ struct jit_uni_reduction_kernel_t : public jit_uni_reduction_kernel_base_t {
 
     virtual ~jit_uni_reduction_kernel_t() = default;
 
-    std::size_t get_simd_w() override { return simd_w_; }
+    std::size_t get_simd_w() const override { return simd_w_; }
 
 private:
     using compute_fn_t = std::function<void(
@@ -84,10 +84,17 @@ private:
     void reduce();
     void reduce_base();
     void reduce_ne_convert_xf16();
+    void apply_power(const Vmm &vmm);
+    void apply_lp_norm_finalization(const Vmm &vmm_acc, const Vmm &vmm_eps);
+    void broadcast_f32(const Vmm &vmm, float val);
+    void reduce_strided_block(const int ur, const bool tail);
+    void reduce_strided();
 
     void load_params();
-    void apply_sum(const int data_idx);
-    void apply_postops(const int data_idx);
+    void apply_sum(const int data_idx, const std::size_t dst_off,
+            const bool tail);
+    void apply_postops(const int data_idx, const std::size_t dst_off = 0,
+            const bool tail = true);
     void finalize();
     void generate() override;
 
@@ -102,6 +109,9 @@ private:
     const Vmm vmm_tmp4_ = Vmm(8);
     const Vmm vmm_sum_scale_ = Vmm(9);
     const Vmm rhs_dt_helper_vmm_ = Vmm(10);
+    // accumulators of the strided kernel, ur_strided_ of them
+    const int vmm_strided_acc_start_idx_ = 11;
+    const Vmm vmm_abs_mask_ = Vmm(15);
     const Xbyak::Zmm vmm_bf16_emu_1_ = Xbyak::Zmm(28);
     const Xbyak::Zmm vmm_bf16_emu_2_ = Xbyak::Zmm(29);
     const Xbyak::Zmm vmm_bf16_emu_3_ = Xbyak::Zmm(30);
@@ -116,6 +126,10 @@ private:
     const Xbyak::Reg64 reg_param_ = abi_param1;
     const Xbyak::Reg64 reg_tmp_ = abi_not_param1;
     const Xbyak::Reg64 reg_tmp1_ = r13;
+    const Xbyak::Reg64 reg_src_reduce_ = r8;
+    const Xbyak::Reg64 reg_reduce_work_ = r9;
+    const Xbyak::Reg64 reg_power_table_ = r10;
+    const Xbyak::Reg64 reg_root_table_ = r11;
 
     static constexpr bool is_zmm_ = std::is_same<Vmm, Xbyak::Zmm>::value;
     static constexpr bool is_ymm_ = std::is_same<Vmm, Xbyak::Ymm>::value;
@@ -124,8 +138,11 @@ private:
     static constexpr std::size_t number_of_f32_in_xmm_ = 4;
     static constexpr std::size_t number_of_f32_in_ymm_ = 8;
     static constexpr std::size_t number_of_f32_in_zmm_ = 16;
+    static constexpr int ur_strided_ = 4;
+    const bool is_strided_;
+    const bool is_lp_norm_;
     const std::size_t load_tail_size_;
-    static constexpr std::size_t store_tail_size_ = 1;
+    const std::size_t store_tail_size_;
 
     io::jit_io_helper_t<Vmm> io_load_;
     io::jit_io_helper_t<Vmm> io_store_;
@@ -143,6 +160,13 @@ private:
             = isa == avx512_core_bf16 ? avx512_core : isa;
     std::unique_ptr<injector::jit_uni_postops_injector_t<inject_isa_, Vmm>>
             postops_injector_;
+
+    // |src|^p and acc^(1/p) of lp-norms, not needed for p = 1 and p = 2
+    const Xbyak::Opmask k_lp_norm_mask_ = k2;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>
+            power_injector_;
+    std::unique_ptr<jit_uni_eltwise_injector_f32<inject_isa_, Vmm>>
+            root_injector_;
 };
 
 } // namespace x64
@@ -15,6 +15,7 @@
 *******************************************************************************/
 
 #include <assert.h>
+#include <cmath>
 #include <numeric>
 
 #include "oneapi/dnnl/dnnl_debug.h"
@@ -459,27 +460,38 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         // This processing is relied on swaping two innermost dimension.
         // Therefore, input stride in second node and output stride in first node
         // have to be equal to 1.
+        // Tiles bigger than 8x8 (e.g. 16x16 ones made by cache blocking) are
+        // transposed by 8x8 sub-tiles.
 
         return mayiuse(avx2) && prb_.ndims >= 2
                 && ((utils::one_of(prb_.itype, u8, s8, s32, f32, bf16, f16)
                         && utils::one_of(
                                 prb_.otype, u8, s8, s32, f32, bf16, f16)))
-                && utils::everyone_is(desirable_node_size, prb_.n(0), prb_.n(1))
+                && prb_.n(0) % desirable_node_size == 0
+                && prb_.n(1) % desirable_node_size == 0
+                && prb_.n(0) * prb_.n(1) <= len_unroll_max
                 && utils::everyone_is(desirable_stride, prb_.os(0), prb_.is(1))
                 && !prb_.is_tail_present
                 && prb_.src_scale_type == scale_type_t::NONE
                 && prb_.dst_scale_type == scale_type_t::NONE
-                && prb_.beta == 0.f;
+                && prb_.beta == 0.f && !compensation_needed_
+                && !prb_.req_src_zp && !prb_.req_dst_zp;
     }
 
     bool process_unroll_tr8x8(const int ndims, const int len) {
         if (!can_do_tr8x8()) return false;
 
-        const int step_size = prb_.n(0) * prb_.n(1);
+        static constexpr int tr_size = 8;
+        const int n0 = static_cast<int>(prb_.n(0));
+        const int n1 = static_cast<int>(prb_.n(1));
+        const int step_size = n0 * n1;
         int i_off = 0, o_off = 0;
         for (int off = 0; off < len; off += step_size) {
             step(off, i_off, o_off, i_off, o_off, step_size);
-            tr8x8_avx2(i_off, o_off);
+            for_(int i1 = 0; i1 < n1; i1 += tr_size)
+            for (int i0 = 0; i0 < n0; i0 += tr_size)
+                tr8x8_avx2(i_off + i0 * prb_.is(0) + i1 * prb_.is(1),
+                        o_off + i0 * prb_.os(0) + i1 * prb_.os(1));
         }
 
         return true;
@@ -516,42 +528,65 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         assert(zero_idx >= max_unroll);
         assert(saturation_ubound_idx >= max_unroll);
 
-        io::io_conf_t io_conf;
-        io::io_tail_conf_t io_tail_conf(
-                simd_w, len_tail, tail_opmask_idx, tail_vmm_idx, reg_tmp_);
-        io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
-                bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp_,
-                bf16_emu_zmm_4_idx_);
-        io::io_saturation_conf_t io_saturation_conf(
-                zero_idx, saturation_ubound_idx, reg_tmp_);
-        io::jit_io_multi_dt_helper_t<Vmm> io(this, isa_,
-                {prb_.itype, prb_.otype}, io_conf, io_tail_conf, io_bf16_conf,
-                {{prb_.otype, io_saturation_conf}});
-
-        io.init_saturate_f32({prb_.otype});
-
-        int off = 0;
-        for (; off + len_tail < len_unroll;) {
-            int n_vregs_to_process_len_unroll = (len_unroll - off) / simd_w;
-            int unroll = nstl::min(max_unroll, n_vregs_to_process_len_unroll);
-
-            for (int ur = 0; ur < unroll; ++ur) {
-                const auto vmm = Vmm(ur);
-                io[prb_.itype]->load(i_addr(off + ur * simd_w), vmm, false);
-                io[prb_.otype]->store(vmm, o_addr(off + ur * simd_w), false);
+        auto copy = [&](bool use_nt_stores) {
+            io::io_conf_t io_conf(use_nt_stores);
+            io::io_tail_conf_t io_tail_conf(
+                    simd_w, len_tail, tail_opmask_idx, tail_vmm_idx, reg_tmp_);
+            io::io_emu_bf16_conf_t io_bf16_conf(bf16_emu_zmm_1_idx_,
+                    bf16_emu_zmm_2_idx_, bf16_emu_zmm_3_idx_, reg_tmp_,
+                    bf16_emu_zmm_4_idx_);
+            io::io_saturation_conf_t io_saturation_conf(
+                    zero_idx, saturation_ubound_idx, reg_tmp_);
+            io::jit_io_multi_dt_helper_t<Vmm> io(this, isa_,
+                    {prb_.itype, prb_.otype}, io_conf, io_tail_conf,
+                    io_bf16_conf, {{prb_.otype, io_saturation_conf}});
+
+            io.init_saturate_f32({prb_.otype});
+
+            int off = 0;
+            for (; off + len_tail < len_unroll;) {
+                int n_vregs_to_process_len_unroll = (len_unroll - off) / simd_w;
+                int unroll
+                        = nstl::min(max_unroll, n_vregs_to_process_len_unroll);
+
+                for (int ur = 0; ur < unroll; ++ur) {
+                    const auto vmm = Vmm(ur);
+                    io[prb_.itype]->load(i_addr(off + ur * simd_w), vmm, false);
+                    io[prb_.otype]->store(
+                            vmm, o_addr(off + ur * simd_w), false);
+                }
+
+                off += unroll * simd_w;
+                assert(off <= len_unroll);
             }
 
-            off += unroll * simd_w;
-            assert(off <= len_unroll);
-        }
+            if (len_tail) {
+                io.prepare_tail_mask();
+                const auto vmm = Vmm(tail_vmm_idx + 1);
+                io[prb_.itype]->load(i_addr(off), vmm, true);
+                io[prb_.otype]->store(vmm, o_addr(off), true);
+            }
+        };
 
-        if (len_tail) {
-            io.prepare_tail_mask();
-            const auto vmm = Vmm(tail_vmm_idx + 1);
-            io[prb_.itype]->load(i_addr(off), vmm, true);
-            io[prb_.otype]->store(vmm, o_addr(off), true);
+        // Non-temporal stores require aligned vectors. The vectors are at
+        // multiples of vlen from the output pointer of the call if the
+        // unrolled length is, so only the output pointer is checked.
+        const bool use_nt_stores
+                = desc_.use_nt_stores && (len_unroll * otype_sz_) % vlen == 0;
+        if (!use_nt_stores) {
+            copy(false);
+            return true;
         }
 
+        Label regular_stores, end;
+        test(reg_ptr_out_, vlen - 1);
+        jnz(regular_stores, T_NEAR);
+        copy(true);
+        jmp(end, T_NEAR);
+        L(regular_stores);
+        copy(false);
+        L(end);
+
         return true;
     }
 
@@ -1512,6 +1547,8 @@ struct jit_uni_reorder_kernel_f32_t : public kernel_t, public jit_generator {
         impl();
 
         L(end_of_kernel);
+        // Make the non-temporal stores visible to the other threads.
+        if (desc_.use_nt_stores) sfence();
         postamble();
     }
 
@@ -1945,6 +1982,47 @@ kernel_t *kernel_t::create(const kernel_t::desc_t &desc) {
 
 } // namespace tr
 
+/* For a large transpose split into tiles, block the grid of tiles, so that the
+ * tiles processed one after another share cache lines in L2 (tiles of data
+ * types smaller than f32 occupy only a part of a cache line). The blocks are
+ * the outermost dimensions, so threads get 2D sub-grids of them:
+ * [16n0][16n1][n0'][n1'] --> [16n0][16n1][bn0'][bn1'][n0'/bn0'][n1'/bn1'] */
+static bool prb_block_tiles_for_l2(tr::prb_t &prb) {
+    static constexpr int grid_node = 2;
+    if (prb.is_tail_present || prb.ndims < grid_node + 2
+            || prb.ndims + 2 >= tr::max_ndims)
+        return false;
+
+    const size_t tile_sz = prb.nodes[0].n * prb.nodes[1].n
+            * (data_type_size(prb.itype) + data_type_size(prb.otype));
+    const size_t L2_cache_sz = platform::get_per_core_cache_size(2) / 2;
+    const size_t n0 = prb.nodes[grid_node].n;
+    const size_t n1 = prb.nodes[grid_node + 1].n;
+    if (n0 * n1 * tile_sz <= L2_cache_sz) return false;
+
+    const size_t blk_max = nstl::max<size_t>(
+            1, static_cast<size_t>(std::sqrt(L2_cache_sz / tile_sz)));
+    const auto get_blk = [&](size_t n) {
+        size_t blk = nstl::min(n, blk_max);
+        while (n % blk)
+            --blk;
+        return blk;
+    };
+    const size_t blk0 = get_blk(n0);
+    const size_t blk1 = get_blk(n1);
+    // Prime sizes or a degenerate blocking, nothing to gain.
+    if (blk0 == 1 || blk1 == 1 || (blk0 == n0 && blk1 == n1)) return false;
+
+    const bool split0 = blk0 < n0;
+    const bool split1 = blk1 < n1;
+    if (split0) prb_node_split(prb, grid_node, blk0);
+    if (split1) prb_node_split(prb, grid_node + 1 + split0, blk1);
+    if (split0) prb_node_move(prb, grid_node + 2, grid_node + 1);
+    prb_node_dependency(prb);
+
+    return true;
+}
+
 static void prb_block_for_cache(tr::prb_t &prb) {
     /* If strides for 0th and 1st nodes are cache friendly
      * then one can altogether do away with blocking ! */
@@ -2009,6 +2087,8 @@ static void prb_block_for_cache(tr::prb_t &prb) {
             // Update node information
             prb_node_dependency(prb);
 
+            if (prb_block_tiles_for_l2(prb)) return;
+
             // heuristics - looping over the unrolled dims should maximize reuse
             // of the already cached data; observation is choosing the smallest
             // dim from the remaining (from 2 up to ndims) gives good results
@@ -2144,12 +2224,9 @@ status_t jit_uni_reorder_t::pd_t::init_scratchpad() {
     const bool compensation_needed
             = prb_.req_s8s8_comp || prb_.req_asymmetric_comp;
     if (compensation_needed) {
-        const memory_desc_wrapper od(dst_md());
-        const auto G = with_groups_ ? od.padded_dims()[0] : 1;
-        const auto N = od.padded_dims()[with_groups_ ? 1 : 0];
         static constexpr int cache_line_size = 16;
         const auto wspace_per_thr_size
-                = utils::rnd_up(G * N, cache_line_size) * sizeof(int32_t);
+                = utils::rnd_up(comp_size_, cache_line_size) * sizeof(int32_t);
 
         const auto compensation_reduce_size = wspace_per_thr_size * nthr_;
 
@@ -2206,6 +2283,14 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
     if (ndims_driver > jit_uni_reorder_t::ndims_driver_max)
         return status::unimplemented;
 
+    if (tr::is_direct_copy(ker_desc.prb)) {
+        size_t nelems = 1;
+        for (int d = 0; d < prb.ndims; ++d)
+            nelems *= prb.nodes[d].n;
+        ker_desc.use_nt_stores = io::nt_stores_beneficial(nelems
+                * (data_type_size(prb.itype) + data_type_size(prb.otype)));
+    }
+
     DEBUG({
         printf("ker  : ");
         prb_dump(ker_desc.prb);
@@ -2217,8 +2302,13 @@ status_t jit_uni_reorder_t::pd_t::create(reorder_pd_t **reorder_pd,
 
     _pd->nthr_ = nthr;
     _pd->prb_ = prb;
-    _pd->with_groups_
-            = prb.compensation_mask == tr::prb_t::comp_mask_with_groups;
+    if (prb.req_s8s8_comp || prb.req_asymmetric_comp) {
+        const memory_desc_wrapper od(dst_md);
+        _pd->comp_size_ = 1;
+        for (int d = 0; d < od.ndims(); ++d)
+            if (prb.compensation_mask & (1 << d))
+                _pd->comp_size_ *= od.padded_dims()[d];
+    }
     if (_pd->init(engine, src_engine, dst_engine) != status::success) {
         delete _pd;
         return status::unimplemented;
@@ -2438,11 +2528,9 @@ void jit_uni_reorder_t::omp_driver(const char *in, char *out,
     int32_t *compensation_reduce_scratch = scratchpad.template get<int32_t>(
             memory_tracking::names::key_reorder_space);
 
-    const memory_desc_wrapper od(pd()->dst_md());
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
     static constexpr int cache_line_size = 16;
-    const auto wspace_per_thr_size = utils::rnd_up(G * N, cache_line_size);
+    const auto wspace_per_thr_size
+            = utils::rnd_up(pd()->comp_size_, cache_line_size);
     const auto wspace_per_thr_bytes = wspace_per_thr_size * sizeof(int32_t);
 
     if (ndims - ndims_ker == 0) {
@@ -2502,9 +2590,7 @@ void jit_uni_reorder_t::reduce_compensation(char *out,
 
     // Note: We do not need to explicitly zero-out compensation buffer, as the
     // per_thread buffers are already zeroed out in the padded area.
-    const auto G = pd()->with_groups_ ? od.padded_dims()[0] : 1;
-    const auto N = od.padded_dims()[pd()->with_groups_ ? 1 : 0];
-    const auto GN = G * N;
+    const auto GN = pd()->comp_size_;
     const bool req_s8s8_comp = pd()->prb_.req_s8s8_comp;
     const bool req_asymmetric_comp = pd()->prb_.req_asymmetric_comp;
     const size_t zp_offset
@@ -176,6 +176,8 @@ struct kernel_t {
     struct desc_t {
         int id;
         prb_t prb;
+        // Store full vectors of a direct copy with non-temporal stores.
+        bool use_nt_stores = false;
     };
 
     kernel_t(const desc_t &desc)
@@ -220,7 +222,9 @@ struct jit_uni_reorder_t : public primitive_t {
         tr::prb_t prb_;
         tr::kernel_t::desc_t ker_desc_;
         int nthr_;
-        bool with_groups_ = false;
+        // Number of compensation values, the product of the padded output
+        // dimensions in the compensation mask.
+        dim_t comp_size_ = 0;
         dim_t D_mask_ = 0;
 
         status_t init(
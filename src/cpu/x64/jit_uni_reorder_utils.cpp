@@ -133,20 +133,6 @@ status_t cvt_mem_desc_to_layout_desc(const memory_desc_t &md_,
     return success;
 }
 
-static bool is_with_groups(const memory_desc_t &dst_md) {
-    using namespace memory_extra_flags;
-    auto dst_d = memory_desc_wrapper(dst_md);
-    const int grp_bit = 1 << 1;
-    auto check_flag_and_mask = [&](int flag, int mask) {
-        return (dst_d.extra().flags & flag) && (mask & grp_bit);
-    };
-
-    return check_flag_and_mask(
-                   compensation_conv_s8s8, dst_d.extra().compensation_mask)
-            || check_flag_and_mask(compensation_conv_asymmetric_src,
-                    dst_d.extra().asymm_compensation_mask);
-}
-
 static inline int get_next_parent_node(node_t *nodes, int ndims, int cur_node) {
     const int cur_id = nodes[cur_node].dim_id;
     for (int d = cur_node + 1; d < ndims; ++d) {
@@ -300,16 +286,32 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
     p.req_asymmetric_comp = om_d.extra().flags
             & memory_extra_flags::compensation_conv_asymmetric_src;
 
-    const bool with_groups = is_with_groups(omd);
-
+    // Compensation is accumulated with strides which are dense over the
+    // dimensions of the mask in the order of the output strides. It matches
+    // the buffer layout only if outer logical dimensions have larger strides,
+    // e.g. (g, o) for convolution and (batch, n) for matmul weights.
     auto mask_ok = [&](bool check, int mask) {
-        return IMPLICATION(check, mask == (with_groups ? 0x3 : 0x1));
+        if (!check) return true;
+        if (mask <= 0) return false;
+        const auto &strides = om_d.blocking_desc().strides;
+        int prev_d = -1;
+        for (int d = 0; d < om_d.ndims(); ++d) {
+            if (!(mask & (1 << d))) continue;
+            if (prev_d >= 0 && strides[prev_d] < strides[d]) return false;
+            prev_d = d;
+        }
+        return true;
     };
 
     if (!mask_ok(p.req_s8s8_comp, om_d.extra().compensation_mask)
             || !mask_ok(p.req_asymmetric_comp,
                     om_d.extra().asymm_compensation_mask))
         return status::unimplemented;
+    // Both compensations are computed from the same accumulated values.
+    if (p.req_s8s8_comp && p.req_asymmetric_comp
+            && om_d.extra().compensation_mask
+                    != om_d.extra().asymm_compensation_mask)
+        return status::unimplemented;
 
     ptrdiff_t ss[max_ndims] = {0}; // scales strides
     if (p.src_scale_type == scale_type_t::MANY
@@ -338,12 +340,6 @@ status_t prb_init(prb_t &p, const memory_desc_t &imd, const memory_desc_t &omd,
                 ? om_d.extra().compensation_mask
                 : (p.req_asymmetric_comp ? om_d.extra().asymm_compensation_mask
                                          : tr::prb_t::invalid_comp_mask);
-
-        if (p.compensation_mask == tr::prb_t::asymmetric_comp_mask)
-            return unimplemented;
-
-        assert(p.compensation_mask == tr::prb_t::standard_comp_mask
-                || p.compensation_mask == tr::prb_t::comp_mask_with_groups);
     }
 
     int ndims = 0;
@@ -0,0 +1,382 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/jit_uni_rope.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+jit_uni_rope_kernel_t<isa>::jit_uni_rope_kernel_t(const jit_rope_conf_t &jrp)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+    , jrp_(jrp)
+    , src_dt_size_(types::data_type_size(jrp.src_dt))
+    , dst_dt_size_(types::data_type_size(jrp.dst_dt))
+    , len_(jrp.is_interleaved ? jrp.row_size : jrp.row_size / 2)
+    , tail_(static_cast<int>(len_ % simd_w)) {}
+
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::load(
+        const Vmm &vmm, const Address &addr, bool tail) {
+    using namespace data_type;
+    // Only avx512 handles partial vectors, the tail is masked with zeroing.
+    const Vmm dst = tail ? vmm | k_tail | T_z : vmm;
+    switch (jrp_.src_dt) {
+        case f32: vmovups(dst, addr); break;
+        case bf16:
+            vpmovzxwd(dst, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        case f16: vcvtph2ps(dst, addr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::store(
+        const Address &addr, const Vmm &vmm, bool tail) {
+    using namespace data_type;
+    const Address dst = tail ? addr | k_tail : addr;
+    const Vmm_half vmm_half = Vmm_half(vmm.getIdx());
+    switch (jrp_.dst_dt) {
+        case f32: vmovups(dst, vmm); break;
+        case bf16:
+            vcvtneps2bf16(vmm_half, vmm);
+            vmovdqu16(dst, vmm_half);
+            break;
+        case f16: vcvtps2ph(dst, vmm, _op_mxcsr); break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// Loads the cosines or sines of simd_w / 2 pairs and duplicates each value
+// for both elements of its pair.
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::load_pairs(
+        const Vmm &vmm, const Address &addr, bool tail) {
+    const Vmm_half vmm_half = Vmm_half(vmm.getIdx());
+    if (tail)
+        vmovups(vmm_half | k_tail_pairs | T_z, addr);
+    else
+        vmovups(vmm_half, addr);
+    vpermps(vmm, vmm_perm, vmm);
+}
+
+// Pairs (x0, x1) are formed by the two halves of a row:
+//     y0 = x0 * cos - x1 * sin, y1 = x0 * sin + x1 * cos.
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::rotate_half(bool tail) {
+    const dim_t half = jrp_.row_size / 2;
+
+    load(vmm_x0, ptr[reg_src_v], tail);
+    load(vmm_x1, ptr[reg_src_v + half * src_dt_size_], tail);
+    const Vmm cos = tail ? vmm_cos | k_tail | T_z : vmm_cos;
+    const Vmm sin = tail ? vmm_sin | k_tail | T_z : vmm_sin;
+    vmovups(cos, ptr[reg_cs_v]);
+    vmovups(sin, ptr[reg_cs_v + half * sizeof(float)]);
+
+    vmulps(vmm_y0, vmm_x0, vmm_cos);
+    vfnmadd231ps(vmm_y0, vmm_x1, vmm_sin);
+    vmulps(vmm_y1, vmm_x0, vmm_sin);
+    vfmadd231ps(vmm_y1, vmm_x1, vmm_cos);
+
+    store(ptr[reg_dst_v], vmm_y0, tail);
+    store(ptr[reg_dst_v + half * dst_dt_size_], vmm_y1, tail);
+}
+
+// Pairs are adjacent elements. With x' being x with the elements of each
+// pair swapped and sin' being sin with the even elements negated:
+//     y = x * cos + x' * sin'.
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::rotate_interleaved(bool tail) {
+    const dim_t half = jrp_.row_size / 2;
+
+    load(vmm_x0, ptr[reg_src_v], tail);
+    load_pairs(vmm_cos, ptr[reg_cs_v], tail);
+    load_pairs(vmm_sin, ptr[reg_cs_v + half * sizeof(float)], tail);
+
+    vpermilps(vmm_x1, vmm_x0, 0xb1);
+    vxorps(vmm_sin, vmm_sin, vmm_sign);
+    vmulps(vmm_y0, vmm_x0, vmm_cos);
+    vfmadd231ps(vmm_y0, vmm_x1, vmm_sin);
+
+    store(ptr[reg_dst_v], vmm_y0, tail);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_rope_kernel_t<isa>::generate() {
+    const bool is_interleaved = jrp_.is_interleaved;
+    const dim_t nfull = len_ / simd_w;
+    const int src_step = static_cast<int>(simd_w * src_dt_size_);
+    const int dst_step = static_cast<int>(simd_w * dst_dt_size_);
+    const int cs_step = static_cast<int>(
+            (is_interleaved ? simd_w / 2 : simd_w) * sizeof(float));
+
+    preamble();
+
+    if (tail_ > 0) {
+        mov(reg_tmp.cvt32(), (1 << tail_) - 1);
+        kmovw(k_tail, reg_tmp.cvt32());
+        mov(reg_tmp.cvt32(), (1 << (tail_ / 2)) - 1);
+        kmovw(k_tail_pairs, reg_tmp.cvt32());
+    }
+    if (is_interleaved) {
+        mov(reg_tmp, l_table_);
+        vmovups(vmm_perm, ptr[reg_tmp]);
+        vmovups(vmm_sign, ptr[reg_tmp + 16 * sizeof(float)]);
+    }
+
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+    mov(reg_cs, ptr[reg_param + PARAM_OFF(cos_sin)]);
+    mov(reg_nrows, ptr[reg_param + PARAM_OFF(nrows)]);
+
+    Label l_row, l_end;
+    L(l_row);
+    {
+        test(reg_nrows, reg_nrows);
+        jz(l_end, T_NEAR);
+
+        mov(reg_src_v, reg_src);
+        mov(reg_dst_v, reg_dst);
+        mov(reg_cs_v, reg_cs);
+        if (nfull > 0) {
+            Label l_vec;
+            mov(reg_nvec, nfull);
+            L(l_vec);
+            {
+                if (is_interleaved)
+                    rotate_interleaved(false);
+                else
+                    rotate_half(false);
+                add(reg_src_v, src_step);
+                add(reg_dst_v, dst_step);
+                add(reg_cs_v, cs_step);
+                dec(reg_nvec);
+                jnz(l_vec, T_NEAR);
+            }
+        }
+        if (tail_ > 0) {
+            if (is_interleaved)
+                rotate_interleaved(true);
+            else
+                rotate_half(true);
+        }
+
+        add(reg_src, static_cast<int>(jrp_.src_row_stride));
+        add(reg_dst, static_cast<int>(jrp_.dst_row_stride));
+        if (jrp_.cs_row_stride != 0)
+            add(reg_cs, static_cast<int>(jrp_.cs_row_stride));
+        dec(reg_nrows);
+        jmp(l_row, T_NEAR);
+    }
+    L(l_end);
+
+    postamble();
+
+    if (is_interleaved) {
+        // Indices duplicating each of the lower simd_w / 2 elements, then a
+        // mask of sign bits of even elements.
+        align(64);
+        L(l_table_);
+        for (int i = 0; i < 16; i++)
+            dd(i / 2);
+        for (int i = 0; i < 16; i++)
+            dd(i % 2 == 0 ? 0x80000000 : 0);
+    }
+}
+
+#undef PARAM_OFF
+
+template <cpu_isa_t isa>
+bool jit_uni_rope_t<isa>::pd_t::rows_are_dense(
+        const memory_desc_t *md) const {
+    const memory_desc_wrapper mdw(md);
+    const auto &strides = mdw.blocking_desc().strides;
+    const int nd = mdw.ndims();
+    return mdw.is_plain() && strides[nd - 1] == 1
+            && strides[nd - 2] * mdw.data_type_size() <= INT32_MAX;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_rope_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+    constexpr int simd_w = jit_uni_rope_kernel_t<isa>::simd_w;
+
+    VDISPATCH_ROPE(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+
+    const auto src_dt = src_md()->data_type;
+    const auto dst_dt = dst_md()->data_type;
+    VDISPATCH_ROPE(
+            utils::one_of(src_dt, f32, bf16, f16), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(utils::one_of(dst_dt, f32, src_dt), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(platform::has_data_type_support(src_dt),
+            VERBOSE_UNSUPPORTED_DT);
+    // Conversion to bf16 requires native instructions.
+    VDISPATCH_ROPE(IMPLICATION(dst_dt == bf16,
+                           isa == avx512_core && mayiuse(avx512_core_bf16)),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_ROPE(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_ROPE(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_ROPE(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(rows_are_dense(src_md()) && rows_are_dense(dst_md()),
+            VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_ROPE(IMPLICATION(!with_positions(), rows_are_dense(cos_sin_md())),
+            VERBOSE_UNSUPPORTED_TAG);
+    // Partial vectors are processed with masks which avx2 lacks.
+    const dim_t len = is_interleaved() ? row_size() : row_size() / 2;
+    VDISPATCH_ROPE(IMPLICATION(isa == avx2, len % simd_w == 0),
+            VERBOSE_BAD_DIM, "src", ndims() - 1);
+
+    const memory_desc_wrapper src_d(src_md());
+    const memory_desc_wrapper dst_d(dst_md());
+    const memory_desc_wrapper cs_d(cos_sin_md());
+    const int nd = ndims();
+    jrp_.src_dt = src_dt;
+    jrp_.dst_dt = dst_dt;
+    jrp_.is_interleaved = is_interleaved();
+    jrp_.row_size = row_size();
+    jrp_.src_row_stride
+            = src_d.blocking_desc().strides[nd - 2] * src_d.data_type_size();
+    jrp_.dst_row_stride
+            = dst_d.blocking_desc().strides[nd - 2] * dst_d.data_type_size();
+    const dim_t cs_stride = with_positions()
+            ? row_size()
+            : cs_d.blocking_desc().strides[0];
+    jrp_.cs_row_stride
+            = axis() == nd - 2 ? cs_stride * (dim_t)sizeof(float) : 0;
+
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_rope_t<isa>::pd_t::init_scratchpad() {
+    if (!with_positions()) return;
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<float>(key_rope_cos_sin, seq_len() * row_size());
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_rope_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(
+            kernel_, new jit_uni_rope_kernel_t<isa>(pd()->jrp_)));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_rope_t<isa>::execute(const exec_ctx_t &ctx) const {
+    using call_params_t = typename jit_uni_rope_kernel_t<isa>::call_params_t;
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto cos_sin = CTX_IN_MEM(const void *, DNNL_ARG_SRC_1);
+    auto dst = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper cs_d(pd()->cos_sin_md());
+
+    const int ndims = pd()->ndims();
+    const int axis = pd()->axis();
+    const dim_t T = pd()->seq_len();
+    const dim_t D = pd()->row_size();
+    const dim_t half = D / 2;
+
+    // With positions, the table of cosines and sines is computed once per
+    // call and then read by the kernel as a user table would be.
+    const float *table = static_cast<const float *>(cos_sin);
+    dim_t table_stride = 0;
+    if (pd()->with_positions()) {
+        auto pos = static_cast<const int32_t *>(cos_sin);
+        float *cs = ctx.get_scratchpad_grantor().template get<float>(
+                memory_tracking::names::key_rope_cos_sin);
+        const float theta = pd()->desc()->theta;
+        parallel_nd(T, half, [&](dim_t t, dim_t i) {
+            const float angle = rope_angle(pos[cs_d.off(t)], i, D, theta);
+            cs[t * D + i] = std::cos(angle);
+            cs[t * D + half + i] = std::sin(angle);
+        });
+        table = cs;
+        table_stride = D;
+    } else {
+        table += cs_d.offset0();
+        table_stride = cs_d.blocking_desc().strides[0];
+    }
+
+    // The kernel walks rows along the dimension before the last one, the
+    // rest of the dimensions and chunks of rows are split between threads.
+    const dim_t inner = src_d.dims()[ndims - 2];
+    const dim_t outer = src_d.nelems() / (inner * D);
+    const dim_t nchunks = nstl::min(
+            inner, utils::div_up((dim_t)dnnl_get_max_threads(), outer));
+    const dim_t chunk = utils::div_up(inner, nchunks);
+
+    const auto &src_strides = src_d.blocking_desc().strides;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+
+    parallel_nd(outer, nchunks, [&](dim_t o, dim_t c) {
+        const dim_t r0 = c * chunk;
+        if (r0 >= inner) return;
+
+        dims_t pos;
+        utils::l_dims_by_l_offset(pos, o, src_d.dims(), ndims - 2);
+        pos[ndims - 2] = r0;
+        pos[ndims - 1] = 0;
+
+        dim_t src_off = src_d.offset0(), dst_off = dst_d.offset0();
+        for (int d = 0; d < ndims; d++) {
+            src_off += pos[d] * src_strides[d];
+            dst_off += pos[d] * dst_strides[d];
+        }
+
+        call_params_t p;
+        p.src = src + src_off * src_d.data_type_size();
+        p.dst = dst + dst_off * dst_d.data_type_size();
+        p.cos_sin = table + pos[axis] * table_stride;
+        p.nrows = nstl::min(chunk, inner - r0);
+        (*kernel_)(&p);
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_rope_kernel_t<avx512_core>;
+template struct jit_uni_rope_kernel_t<avx2>;
+template struct jit_uni_rope_t<avx512_core>;
+template struct jit_uni_rope_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
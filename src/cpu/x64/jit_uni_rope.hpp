@@ -0,0 +1,151 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_ROPE_HPP
+#define CPU_X64_JIT_UNI_ROPE_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_rope_pd.hpp"
+#include "cpu/platform.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+struct jit_rope_conf_t {
+    data_type_t src_dt;
+    data_type_t dst_dt;
+    bool is_interleaved;
+    dim_t row_size;
+    // Distances in bytes between consecutive rows along the dimension
+    // before the last one. The table stride is zero unless that dimension
+    // is the axis of positions.
+    dim_t src_row_stride;
+    dim_t dst_row_stride;
+    dim_t cs_row_stride;
+};
+
+// Rotates a number of consecutive rows in a single pass. Each vector of a
+// row is loaded, rotated with the cosines and sines of its pairs, and
+// stored, so the operation costs one read and one write of the tensor.
+template <cpu_isa_t isa>
+struct jit_uni_rope_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_rope_kernel_t)
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *src;
+        void *dst;
+        const float *cos_sin; // cosines of the first row, sines follow
+        size_t nrows;
+    };
+
+    jit_uni_rope_kernel_t(const jit_rope_conf_t &jrp);
+
+    void operator()(const call_params_t *p) const {
+        jit_generator::operator()(p);
+    }
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+    using Vmm_half = typename vreg_traits<Vmm>::Vmm_lower_t;
+
+    void generate() override;
+    void load(const Vmm &vmm, const Xbyak::Address &addr, bool tail);
+    void store(const Xbyak::Address &addr, const Vmm &vmm, bool tail);
+    void load_pairs(const Vmm &vmm, const Xbyak::Address &addr, bool tail);
+    void rotate_half(bool tail);
+    void rotate_interleaved(bool tail);
+
+    const jit_rope_conf_t jrp_;
+    const size_t src_dt_size_;
+    const size_t dst_dt_size_;
+    // Elements of a row processed by one vector iteration and its tail.
+    const dim_t len_;
+    const int tail_;
+
+    Xbyak::Label l_table_;
+
+    const Vmm vmm_x0 = Vmm(0);
+    const Vmm vmm_x1 = Vmm(1);
+    const Vmm vmm_cos = Vmm(2);
+    const Vmm vmm_sin = Vmm(3);
+    const Vmm vmm_y0 = Vmm(4);
+    const Vmm vmm_y1 = Vmm(5);
+    const Vmm vmm_perm = Vmm(6);
+    const Vmm vmm_sign = Vmm(7);
+    const Xbyak::Opmask k_tail = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_tail_pairs = Xbyak::Opmask(2);
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_tmp = rax;
+    const Xbyak::Reg64 reg_src = rbx;
+    const Xbyak::Reg64 reg_dst = rdx;
+    const Xbyak::Reg64 reg_cs = rsi;
+    const Xbyak::Reg64 reg_nrows = r8;
+    const Xbyak::Reg64 reg_src_v = r9;
+    const Xbyak::Reg64 reg_dst_v = r10;
+    const Xbyak::Reg64 reg_cs_v = r11;
+    const Xbyak::Reg64 reg_nvec = r12;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_rope_t : public primitive_t {
+    struct pd_t : public cpu_rope_pd_t {
+        using cpu_rope_pd_t::cpu_rope_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_rope_t);
+
+        status_t init(engine_t *engine);
+
+        jit_rope_conf_t jrp_;
+
+    private:
+        bool rows_are_dense(const memory_desc_t *md) const;
+        void init_scratchpad();
+    };
+
+    jit_uni_rope_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<jit_uni_rope_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -100,12 +100,15 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
     Vmm vzero = Vmm(is_superset(isa, avx512_core) ? 21 : 11);
     Vmm vcvt_vmm = Vmm(is_superset(isa, avx512_core) ? 22 : 10);
     Vmm vsaturation_ubound = vneg_flt_max;
+    // vmax is alive during compute_dst() in the online mode
+    Vmm vscale_ = Vmm(is_superset(isa, avx512_core) ? 27 : 9);
 
     bool is_bf16_ = false;
     bool is_f16_ = false;
     bool is_avx2_ne_xf16_ = false;
     bool is_softmax_ = pd_->is_softmax();
     bool is_logsoftmax_ = pd_->is_logsoftmax();
+    bool use_online_ = false;
     bool axis_is_blocked_;
     bool need_scratchpad_;
     bool with_postops_ = false;
@@ -241,7 +244,7 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
 
     template <typename body_t>
     void axis_loop(body_t body) {
-        Label main_loop, tail_loop, tail_axis;
+        Label main_loop, tail_loop, tail_axis, loop_end;
 
         // reverse_spat_offt to dispatch between labels
         mov(reg_reverse_n_elems, reg_process_n_elems);
@@ -273,6 +276,12 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
 
         L(tail_loop);
         {
+            // With the axis split between threads only the last chunk has
+            // tails, the others end right after the main loop.
+            if (use_online_ && (loop_tail_ || axis_simd_tail_)) {
+                test(reg_reverse_n_elems, reg_reverse_n_elems);
+                jz(loop_end, T_NEAR);
+            }
             if (loop_tail_) {
                 body(loop_tail_, false);
                 add(reg_src_spat_offt, loop_tail_ * src_axis_stride_);
@@ -290,6 +299,7 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
         {
             if (axis_simd_tail_) { body(1, true); }
         }
+        L(loop_end);
     }
 
     void uni_vaddps_maybe_tail(
@@ -554,7 +564,13 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
         axis_loop([&](int unroll, bool tail = false) {
             for (int i = 0; i < unroll; i++) {
                 Vmm vreg_tmp_src = Vmm(i + 1);
-                if (need_scratchpad_)
+                if (use_online_) {
+                    io_[src_d_.data_type()]->load(
+                            src_ptr(src_axis_stride_ * i), vreg_tmp_src, tail);
+                    uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                    if (is_softmax_)
+                        exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                } else if (need_scratchpad_)
                     io_[data_type::f32]->load(
                             interim_ptr(interim_axis_stride_ * i), vreg_tmp_src,
                             tail);
@@ -567,7 +583,7 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
                     uni_vsubps(vreg_tmp_src, vreg_tmp_src, vsum);
 
                 if (is_superset(isa, avx512_core)) {
-                    Vmm vscale = vmax;
+                    Vmm vscale = vscale_;
                     uni_vmovups(vscale, ptr[reg_src_scales]);
                     uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
                 }
@@ -586,7 +602,7 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
                             vreg_tmp_src.getIdx(), rhs_arg_params);
                 }
                 if (is_superset(isa, avx512_core)) {
-                    Vmm vscale = vmax;
+                    Vmm vscale = vscale_;
                     uni_vmovups(vscale, ptr[reg_dst_scales]);
                     uni_vmulps(vreg_tmp_src, vreg_tmp_src, vscale);
                 }
@@ -644,7 +660,88 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
         });
     }
 
+    // Computes the maximum and the sum of exponents in a single pass over the
+    // axis. Every lane keeps a running maximum, and the running sum is
+    // rescaled by exp(old_max - new_max) once per unrolled block.
+    void accumulate_online_stats() {
+        const Vmm vblk_max = Vmm(unroll_regs_ + 1);
+        const Vmm valpha = Vmm(unroll_regs_ + 2);
+
+        // flush to -FLT_MAX and zero before accumulation
+        uni_vmovups(vmax, vneg_flt_max);
+        uni_vpxor(vsum, vsum, vsum);
+
+        axis_loop([&](int unroll, bool tail = false) {
+            vtmp = Vmm(unroll_regs_ + 3);
+            uni_vmovups(vblk_max, vmax);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                io_[src_d_.data_type()]->load(
+                        src_ptr(src_axis_stride_ * i), vreg_tmp_src, tail);
+                uni_vmaxps_maybe_tail(vblk_max, vreg_tmp_src, vtmp, tail);
+            }
+            uni_vsubps(valpha, vmax, vblk_max);
+            exp_injector_->compute_vector(valpha.getIdx());
+            uni_vmulps(vsum, vsum, valpha);
+            uni_vmovups(vmax, vblk_max);
+            for (int i = 0; i < unroll; i++) {
+                Vmm vreg_tmp_src = Vmm(i + 1);
+                uni_vsubps(vreg_tmp_src, vreg_tmp_src, vmax);
+                exp_injector_->compute_vector(vreg_tmp_src.getIdx());
+                uni_vaddps_maybe_tail(vsum, vreg_tmp_src, vtmp, tail);
+            }
+        });
+
+        // rescale the partial sums of all lanes to the common maximum
+        vtmp = Vmm(unroll_regs_ + 3);
+        uni_vmovups(vblk_max, vmax);
+        get_horizontal_op(vmax, vtmp, op_t::max);
+        uni_vsubps(valpha, vblk_max, vmax);
+        exp_injector_->compute_vector(valpha.getIdx());
+        uni_vmulps(vsum, vsum, valpha);
+        get_horizontal_op(vsum, vtmp, op_t::sum);
+    }
+
+    void forward_online() {
+        Label l_stats_src, l_finalize, l_compute_dst, l_end;
+
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(stats_src)]);
+        test(reg_tmp, reg_tmp);
+        jnz(l_stats_src, T_NEAR);
+
+        accumulate_online_stats();
+
+        mov(reg_tmp, ptr[reg_param + PARAM_OFF(stats_dst)]);
+        test(reg_tmp, reg_tmp);
+        jz(l_finalize, T_NEAR);
+        uni_vmovss(ptr[reg_tmp], Xmm(vmax.getIdx()));
+        uni_vmovss(ptr[reg_tmp + sizeof(float)], Xmm(vsum.getIdx()));
+        jmp(l_end, T_NEAR);
+
+        L(l_finalize);
+        vtmp = Vmm(unroll_regs_ + 3);
+        if (is_softmax_) uni_vdivps(vsum, vone, vsum, vtmp);
+        if (is_logsoftmax_) log_injector_->compute_vector(vsum.getIdx());
+        jmp(l_compute_dst, T_NEAR);
+
+        L(l_stats_src);
+        uni_vbroadcastss(vmax, ptr[reg_tmp]);
+        uni_vbroadcastss(vsum, ptr[reg_tmp + sizeof(float)]);
+
+        L(l_compute_dst);
+        // Initialize saturation vector register, it overlaps with the
+        // register used for tail processing in the statistics pass.
+        io_.init_saturate_f32({dst_d_.data_type()});
+        compute_dst();
+
+        L(l_end);
+    }
+
     void forward() {
+        if (use_online_) {
+            forward_online();
+            return;
+        }
         accumulate_vmax();
         accumulate_vsum();
         compute_dst();
@@ -708,12 +805,13 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
             postops_injector_->prepare_table();
     }
 
-    jit_softmax_kernel_t(const softmax_pd_t *pd)
+    jit_softmax_kernel_t(const softmax_pd_t *pd, bool use_online)
         : jit_softmax_kernel_base_t(pd)
         , jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
         , src_d_(pd_->is_fwd() ? pd_->src_md() : pd_->diff_src_md())
         , dst_d_(pd_->dst_md())
         , diff_dst_d_(pd_->diff_dst_md()) {
+        use_online_ = use_online && pd_->is_fwd();
         is_bf16_ = utils::one_of(
                 data_type::bf16, src_d_.data_type(), dst_d_.data_type());
         is_f16_ = utils::one_of(
@@ -723,8 +821,9 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
                 && (is_bf16_ || is_f16_);
         axis_simd_full_ = pd_->axis_size() / simd_w_;
         axis_simd_tail_ = pd_->axis_size() % simd_w_;
-        need_scratchpad_ = utils::one_of(
-                dst_d_.data_type(), data_type::u8, data_type::s8);
+        need_scratchpad_ = !use_online_
+                && utils::one_of(
+                        dst_d_.data_type(), data_type::u8, data_type::s8);
 
         const auto &post_ops = pd_->attr()->post_ops_;
         with_postops_ = post_ops.len() != 0;
@@ -748,9 +847,9 @@ struct jit_softmax_kernel_t : jit_softmax_kernel_base_t, public jit_generator {
 };
 
 jit_softmax_kernel_base_t *jit_softmax_kernel_base_t::create(
-        const softmax_pd_t *pd, const cpu_isa_t isa) {
+        const softmax_pd_t *pd, const cpu_isa_t isa, bool use_online) {
 #define HANDLE_ISA(isa_) \
-    if ((isa_) == isa) return new jit_softmax_kernel_t<isa_>(pd)
+    if ((isa_) == isa) return new jit_softmax_kernel_t<isa_>(pd, use_online)
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_fp16));
     REG_AVX512_ISA(HANDLE_ISA(avx512_core_bf16));
     REG_AVX512_ISA(HANDLE_ISA(avx512_core));
@@ -781,7 +880,8 @@ jit_uni_softmax_fwd_t::jit_uni_softmax_fwd_t(const pd_t *apd)
 
 status_t jit_uni_softmax_fwd_t::init(engine_t *engine) {
     CHECK(safe_ptr_assign(ker_,
-            softmax_impl::jit_softmax_kernel_base_t::create(pd(), pd()->isa_)));
+            softmax_impl::jit_softmax_kernel_base_t::create(
+                    pd(), pd()->isa_, pd()->use_online_)));
     if (ker_) CHECK(ker_->create_kernel());
     return status::success;
 }
@@ -817,25 +917,77 @@ status_t jit_uni_softmax_fwd_t::execute(const exec_ctx_t &ctx) const {
     const int nthr = pd()->nthr_;
 
     const char *dst_orig_ptr = dst;
+    const auto init_call_params
+            = [&](softmax_impl::jit_softmax_kernel_base_t::call_params_t &p,
+                      dim_t offset, size_t n_elems) {
+                  p.process_n_elems = n_elems;
+                  p.src = src + offset * src_data_type_size;
+                  p.dst = dst + offset * dst_data_type_size;
+                  p.interim = nullptr;
+                  p.src_scales = src_scales;
+                  p.dst_scales = dst_scales;
+                  p.stats_dst = nullptr;
+                  p.stats_src = nullptr;
+                  // post-ops
+                  p.dst_orig = dst_orig_ptr;
+                  p.post_ops_binary_rhs_arg_vec
+                          = post_ops_binary_rhs_arg_vec.data();
+              };
+
+    const dim_t nchunks = pd()->axis_nchunks_;
+    if (nchunks > 1) {
+        // The axis is split between threads: the statistics of every chunk
+        // are computed first, then each thread combines the statistics of
+        // its row and computes its chunk of the destination.
+        auto stats = ctx.get_scratchpad_grantor().template get<float>(
+                memory_tracking::names::key_softmax_reduction);
+        const dim_t chunk = pd()->axis_chunk_;
+        const dim_t axis_size = pd()->axis_size();
+
+        parallel_nd_ext(nthr, outer_size, nchunks,
+                [&](int, int, dim_t ou, dim_t ic) {
+                    const dim_t n_elems
+                            = nstl::min(chunk, axis_size - ic * chunk);
+                    softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
+                    init_call_params(p, ou * outer_stride + ic * chunk,
+                            (size_t)n_elems);
+                    p.stats_dst = &stats[2 * (ou * nchunks + ic)];
+                    (*ker_)(&p);
+                });
+
+        parallel_nd_ext(nthr, outer_size, nchunks,
+                [&](int, int, dim_t ou, dim_t ic) {
+                    const float *row_stats = &stats[2 * ou * nchunks];
+                    float max = -FLT_MAX;
+                    for (dim_t j = 0; j < nchunks; j++)
+                        max = nstl::max(max, row_stats[2 * j]);
+                    float sum = 0.f;
+                    for (dim_t j = 0; j < nchunks; j++)
+                        sum += row_stats[2 * j + 1]
+                                * ::expf(row_stats[2 * j] - max);
+                    const float axis_stats[2] = {max,
+                            pd()->is_softmax() ? 1.f / sum : ::logf(sum)};
+
+                    const dim_t n_elems
+                            = nstl::min(chunk, axis_size - ic * chunk);
+                    softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
+                    init_call_params(p, ou * outer_stride + ic * chunk,
+                            (size_t)n_elems);
+                    p.stats_src = axis_stats;
+                    (*ker_)(&p);
+                });
+
+        return status::success;
+    }
+
     parallel_nd_ext(nthr, outer_size, inner_size,
             [&](int ithr, int, dim_t ou, dim_t in) {
-                dim_t offset = (ou * outer_stride + in * inner_stride);
-                const char *src_ptr = src + offset * src_data_type_size;
-                char *dst_ptr = dst + offset * dst_data_type_size;
-                char *interim_ptr = scratchpad_ptr ? scratchpad_ptr
-                                + ithr * axis_size_padded * sizeof(float)
-                                                   : nullptr;
                 softmax_impl::jit_softmax_kernel_base_t::call_params_t p;
-                p.process_n_elems = process_n_elems;
-                p.src = src_ptr;
-                p.dst = dst_ptr;
-                p.interim = interim_ptr;
-                p.src_scales = src_scales;
-                p.dst_scales = dst_scales;
-                // post-ops
-                p.dst_orig = dst_orig_ptr;
-                p.post_ops_binary_rhs_arg_vec
-                        = post_ops_binary_rhs_arg_vec.data();
+                init_call_params(p, ou * outer_stride + in * inner_stride,
+                        process_n_elems);
+                p.interim = scratchpad_ptr ? scratchpad_ptr
+                                + ithr * axis_size_padded * sizeof(float)
+                                           : nullptr;
                 (*ker_)(&p);
             });
 
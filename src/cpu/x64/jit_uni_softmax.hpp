@@ -26,6 +26,7 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_softmax_pd.hpp"
+#include "cpu/platform.hpp"
 
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include "cpu/x64/injectors/jit_uni_postops_injector.hpp"
@@ -44,8 +45,8 @@ namespace softmax_impl {
 // This class isolates primitive implementation from templates introduced by
 // the kernel.
 struct jit_softmax_kernel_base_t {
-    static jit_softmax_kernel_base_t *create(
-            const softmax_pd_t *pd, const cpu_isa_t isa);
+    static jit_softmax_kernel_base_t *create(const softmax_pd_t *pd,
+            const cpu_isa_t isa, bool use_online = false);
 
     virtual ~jit_softmax_kernel_base_t() = default;
 
@@ -57,6 +58,10 @@ struct jit_softmax_kernel_base_t {
         const void *dst_scales; // dst_scales defined for all data type cases
         size_t process_n_elems;
 
+        // online softmax with the axis split between threads
+        void *stats_dst; // {max, sum} of the chunk, no dst is computed
+        const void *stats_src; // {max, 1/sum or log(sum)} of the whole axis
+
         // post ops
         const void *dst_orig;
         const void *post_ops_binary_rhs_arg_vec;
@@ -162,6 +167,7 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
             if (!ok) return status::unimplemented;
 
             nthr_ = dnnl_get_max_threads();
+            init_online();
             init_scratchpad();
 
             return status::success;
@@ -169,15 +175,64 @@ struct jit_uni_softmax_fwd_t : public primitive_t {
 
         int nthr_; // To not exceed the limit in execute used for set up.
         cpu_isa_t isa_ = isa_undef;
+        // The maximum and the sum of exponents are computed in a single pass
+        // over the axis, so that the source is read twice instead of three
+        // times.
+        bool use_online_ = false;
+        // The axis is processed by axis_nchunks_ threads in chunks of
+        // axis_chunk_ elements when there are not enough outer rows.
+        dim_t axis_nchunks_ = 1;
+        dim_t axis_chunk_ = 0;
 
     private:
+        void init_online() {
+            using namespace data_type;
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper dst_d(dst_md());
+            const auto src_dt = src_d.data_type();
+            const auto dst_dt = dst_d.data_type();
+            const bool is_avx2_ne_xf16 = is_superset(isa_, avx2_vnni_2)
+                    && !is_superset(isa_, avx512_core)
+                    && (utils::one_of(bf16, src_dt, dst_dt)
+                            || utils::one_of(f16, src_dt, dst_dt));
+
+            axis_chunk_ = axis_size();
+            if (!src_d.is_plain() || is_avx2_ne_xf16) return;
+
+            // Chunks are multiples of the kernel unrolling, so that only the
+            // last chunk has tails. 4 is for unroll_regs_ = 4.
+            const dim_t chunk_blk = 4 * isa_max_vlen(isa_) / sizeof(float);
+            const dim_t min_chunk = 4096;
+            const dim_t outer_size = src_d.nelems() / axis_size();
+            if (outer_size < nthr_ && axis_size() >= 2 * min_chunk) {
+                const dim_t nchunks = nstl::min<dim_t>(
+                        nthr_ / outer_size, axis_size() / min_chunk);
+                axis_chunk_ = utils::rnd_up(
+                        utils::div_up(axis_size(), nchunks), chunk_blk);
+                axis_nchunks_ = utils::div_up(axis_size(), axis_chunk_);
+            }
+
+            // The three-pass algorithm is cheaper while a row stays in cache.
+            const size_t row_size = axis_size()
+                    * (src_d.data_type_size() + dst_d.data_type_size());
+            use_online_ = axis_nchunks_ > 1
+                    || row_size > platform::get_per_core_cache_size(2);
+        }
+
         void init_scratchpad() {
-            if (utils::one_of(
-                        dst_md()->data_type, data_type::u8, data_type::s8)) {
-                auto scratchpad = scratchpad_registry().registrar();
+            auto scratchpad = scratchpad_registry().registrar();
+            if (!use_online_
+                    && utils::one_of(
+                            dst_md()->data_type, data_type::u8, data_type::s8))
                 scratchpad.template book<char>(
                         memory_tracking::names::key_softmax_interim_store,
                         axis_size(true) * sizeof(float) * nthr_);
+            if (axis_nchunks_ > 1) {
+                const dim_t outer_size
+                        = memory_desc_wrapper(src_md()).nelems() / axis_size();
+                scratchpad.template book<float>(
+                        memory_tracking::names::key_softmax_reduction,
+                        2 * outer_size * axis_nchunks_);
             }
         }
 
@@ -0,0 +1,416 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/ref_io_helper.hpp"
+
+#include "cpu/x64/jit_uni_topk.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+using namespace Xbyak;
+using namespace topk_utils;
+
+#define PARAM_OFF(x) offsetof(call_params_t, x)
+
+template <cpu_isa_t isa>
+jit_uni_topk_kernel_t<isa>::jit_uni_topk_kernel_t(
+        data_type_t data_type, bool is_max)
+    : jit_generator(jit_name(), nullptr, MAX_CODE_SIZE, true, isa)
+    , data_type_(data_type)
+    , dt_size_(types::data_type_size(data_type))
+    , is_max_(is_max) {}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_kernel_t<isa>::load(const Vmm &vmm, const Address &addr) {
+    using namespace data_type;
+    switch (data_type_) {
+        case f32: uni_vmovups(vmm, addr); break;
+        case bf16:
+            vpmovzxwd(vmm, addr);
+            vpslld(vmm, vmm, 16);
+            break;
+        case f16: vcvtph2ps(vmm, addr); break;
+        case s8:
+            vpmovsxbd(vmm, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        case u8:
+            vpmovzxbd(vmm, addr);
+            vcvtdq2ps(vmm, vmm);
+            break;
+        default: assert(!"unsupported data type");
+    }
+}
+
+// A lane passes if it is not worse than or equal to the threshold. Unordered
+// comparisons pass, which lets every value through the open (NaN) threshold.
+template <cpu_isa_t isa>
+void jit_uni_topk_kernel_t<isa>::compare(int i) {
+    const Vmm &a = is_max_ ? vmm_src(i) : vmm_thr;
+    const Vmm &b = is_max_ ? vmm_thr : vmm_src(i);
+    if (is_superset(isa, avx512_core))
+        vcmpps(k_cmp(i), a, b, _cmp_nle_us);
+    else
+        vcmpps(vmm_cmp(i), a, b, _cmp_nle_us);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_kernel_t<isa>::append_candidates(int i) {
+    Label l_done, l_bits;
+
+    if (is_superset(isa, avx512_core))
+        kmovw(reg_mask.cvt32(), k_cmp(i));
+    else
+        vmovmskps(reg_mask.cvt32(), vmm_cmp(i));
+    test(reg_mask, reg_mask);
+    jz(l_done, T_NEAR);
+
+    // Lanes are picked from the vector spilled to the stack.
+    uni_vmovups(ptr[rsp], vmm_src(i));
+    L(l_bits);
+    {
+        bsf(reg_bit, reg_mask);
+        mov(reg_tmp.cvt32(), dword[rsp + reg_bit * sizeof(float)]);
+        mov(dword[reg_cand + reg_cnt * sizeof(entry_t)], reg_tmp.cvt32());
+        lea(reg_tmp, ptr[reg_idx + reg_bit + i * simd_w]);
+        mov(dword[reg_cand + reg_cnt * sizeof(entry_t) + sizeof(float)],
+                reg_tmp.cvt32());
+        inc(reg_cnt);
+        // Clear the lowest set bit.
+        lea(reg_tmp, ptr[reg_mask - 1]);
+        and_(reg_mask, reg_tmp);
+        jnz(l_bits);
+    }
+    L(l_done);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_kernel_t<isa>::process(int nregs) {
+    Label l_next;
+
+    for (int i = 0; i < nregs; i++) {
+        load(vmm_src(i), ptr[reg_src + i * simd_w * dt_size_]);
+        compare(i);
+    }
+
+    // The common case of no candidates in the whole unrolled block is
+    // checked first.
+    if (is_superset(isa, avx512_core)) {
+        if (nregs == 1) {
+            kortestw(k_cmp(0), k_cmp(0));
+        } else {
+            const Opmask k_any = Opmask(1 + unroll);
+            korw(k_any, k_cmp(0), k_cmp(1));
+            for (int i = 2; i < nregs; i++)
+                korw(k_any, k_any, k_cmp(i));
+            kortestw(k_any, k_any);
+        }
+    } else {
+        uni_vmovups(vmm_any, vmm_cmp(0));
+        for (int i = 1; i < nregs; i++)
+            vorps(vmm_any, vmm_any, vmm_cmp(i));
+        vtestps(vmm_any, vmm_any);
+    }
+    jz(l_next, T_NEAR);
+
+    for (int i = 0; i < nregs; i++)
+        append_candidates(i);
+
+    L(l_next);
+    add(reg_src, nregs * simd_w * dt_size_);
+    add(reg_idx, nregs * simd_w);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_kernel_t<isa>::generate() {
+    constexpr int vlen = cpu_isa_traits<isa>::vlen;
+
+    preamble();
+    sub(rsp, vlen);
+
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_cand, ptr[reg_param + PARAM_OFF(cand)]);
+    mov(reg_nvec, ptr[reg_param + PARAM_OFF(nvec)]);
+    mov(reg_idx, ptr[reg_param + PARAM_OFF(base_idx)]);
+    uni_vbroadcastss(vmm_thr, ptr[reg_param + PARAM_OFF(thr)]);
+    xor_(reg_cnt, reg_cnt);
+
+    Label l_unroll, l_single, l_end;
+    L(l_unroll);
+    {
+        cmp(reg_nvec, unroll);
+        jb(l_single, T_NEAR);
+        process(unroll);
+        sub(reg_nvec, unroll);
+        jmp(l_unroll, T_NEAR);
+    }
+    L(l_single);
+    {
+        test(reg_nvec, reg_nvec);
+        jz(l_end, T_NEAR);
+        process(1);
+        dec(reg_nvec);
+        jmp(l_single, T_NEAR);
+    }
+    L(l_end);
+
+    mov(reg_tmp, ptr[reg_param + PARAM_OFF(ncand)]);
+    mov(ptr[reg_tmp], reg_cnt);
+
+    add(rsp, vlen);
+    postamble();
+}
+
+#undef PARAM_OFF
+
+template <cpu_isa_t isa>
+bool jit_uni_topk_t<isa>::pd_t::axis_is_dense(const memory_desc_t *md) const {
+    const memory_desc_wrapper mdw(md);
+    return mdw.is_plain() && mdw.blocking_desc().strides[axis()] == 1;
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::pd_t::init(engine_t *engine) {
+    using namespace data_type;
+
+    VDISPATCH_TOPK(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+
+    const auto src_dt = src_md()->data_type;
+    VDISPATCH_TOPK(utils::one_of(src_dt, f32, bf16, f16, s8, u8),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(src_dt == dst_md()->data_type, VERBOSE_INCONSISTENT_DT,
+            "src", "dst");
+    VDISPATCH_TOPK(
+            platform::has_data_type_support(src_dt), VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_TOPK(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_TOPK(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_TOPK(
+            set_default_params() == status::success, VERBOSE_UNSUPPORTED_TAG);
+    // Elements along the axis are expected to be contiguous.
+    VDISPATCH_TOPK(axis_is_dense(src_md()) && axis_is_dense(dst_md())
+                    && axis_is_dense(indices_md()),
+            VERBOSE_UNSUPPORTED_TAG);
+
+    init_conf();
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_t<isa>::pd_t::init_conf() {
+    constexpr dim_t simd_w = jit_uni_topk_kernel_t<isa>::simd_w;
+    const dim_t rows = outer_size() * inner_size();
+    const dim_t L = axis_size();
+
+    nthr_ = dnnl_get_max_threads();
+
+    // A chunk should be long enough for the threshold to settle, otherwise
+    // the merge of the chunk selections dominates.
+    const dim_t min_chunk = nstl::max<dim_t>(16 * k(), 4096);
+    nparts_ = 1;
+    if (rows < nthr_)
+        nparts_ = nstl::max<dim_t>(
+                1, nstl::min<dim_t>(nthr_ / rows, L / min_chunk));
+    chunk_ = utils::rnd_up(utils::div_up(L, nparts_), simd_w);
+    nparts_ = utils::div_up(L, chunk_);
+
+    // The threshold is updated after each block. The first blocks pass all
+    // their elements until k of them are selected, so shorter blocks tighten
+    // the threshold sooner.
+    block_ = nstl::min(chunk_, utils::rnd_up(nstl::max<dim_t>(4 * k(), 1024),
+                                       simd_w));
+
+    buf_size_ = nstl::max(k() + block_, nparts_ * k());
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_t<isa>::pd_t::init_scratchpad() {
+    using namespace memory_tracking::names;
+    auto scratchpad = scratchpad_registry().registrar();
+    scratchpad.template book<entry_t>(key_topk_candidates, nthr_ * buf_size_);
+    if (nparts_ > 1)
+        scratchpad.template book<entry_t>(key_topk_partial,
+                outer_size() * inner_size() * nparts_ * k());
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::init(engine_t *engine) {
+    CHECK(safe_ptr_assign(kernel_,
+            new jit_uni_topk_kernel_t<isa>(
+                    pd()->src_md()->data_type, pd()->is_max())));
+    return kernel_->create_kernel();
+}
+
+template <cpu_isa_t isa>
+dim_t jit_uni_topk_t<isa>::select_chunk(
+        const char *src, dim_t start, dim_t len, entry_t *buf) const {
+    using call_params_t = typename jit_uni_topk_kernel_t<isa>::call_params_t;
+    constexpr dim_t simd_w = jit_uni_topk_kernel_t<isa>::simd_w;
+
+    const auto dt = pd()->src_md()->data_type;
+    const dim_t dt_size = types::data_type_size(dt);
+    const dim_t k = pd()->k();
+    const bool is_max = pd()->is_max();
+
+    float thr = open_threshold();
+    dim_t n = 0;
+
+    const dim_t len_vec = utils::rnd_dn(len, simd_w);
+    for (dim_t off = 0; off < len_vec; off += pd()->block_) {
+        size_t ncand = 0;
+        call_params_t p;
+        p.src = src + (start + off) * dt_size;
+        p.cand = buf + n;
+        p.ncand = &ncand;
+        p.nvec = nstl::min(pd()->block_, len_vec - off) / simd_w;
+        p.base_idx = start + off;
+        p.thr = thr;
+        (*kernel_)(&p);
+        if (ncand) n = select(buf, n + ncand, k, is_max, false, &thr);
+    }
+
+    for (dim_t a = start + len_vec; a < start + len; a++) {
+        const float val = io::load_float_value(dt, src, a);
+        if (!passes(val, thr, is_max)) continue;
+        buf[n].val = val;
+        buf[n].idx = static_cast<int32_t>(a);
+        n++;
+    }
+
+    return select(buf, n, k, is_max, false);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_topk_t<isa>::store_row(dim_t row, entry_t *buf, dim_t n,
+        void *dst, int32_t *indices) const {
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper indices_d(pd()->indices_md());
+    const dim_t inner_size = pd()->inner_size();
+    const dim_t k = pd()->k();
+
+    n = select(buf, n, k, pd()->is_max(), true);
+    assert(n == k);
+
+    const dim_t l_off = (row / inner_size) * k * inner_size + row % inner_size;
+    const dim_t dst_off = dst_d.off_l(l_off);
+    const dim_t indices_off = indices_d.off_l(l_off);
+    for (dim_t a = 0; a < n; a++) {
+        io::store_float_value(
+                dst_d.data_type(), buf[a].val, dst, dst_off + a);
+        indices[indices_off + a] = buf[a].idx;
+    }
+}
+
+template <cpu_isa_t isa>
+status_t jit_uni_topk_t<isa>::execute(const exec_ctx_t &ctx) const {
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    auto indices = CTX_OUT_MEM(int32_t *, DNNL_ARG_DST_1);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const dim_t dt_size = src_d.data_type_size();
+    const dim_t inner_size = pd()->inner_size();
+    const dim_t rows = pd()->outer_size() * inner_size;
+    const dim_t L = pd()->axis_size();
+    const dim_t k = pd()->k();
+    const dim_t nparts = pd()->nparts_;
+    const dim_t chunk = pd()->chunk_;
+    const dim_t buf_size = pd()->buf_size_;
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto cand = scratchpad.template get<entry_t>(
+            memory_tracking::names::key_topk_candidates);
+
+    auto src_row = [&](dim_t row) {
+        const dim_t l_off
+                = (row / inner_size) * L * inner_size + row % inner_size;
+        return src + src_d.off_l(l_off) * dt_size;
+    };
+
+    if (nparts == 1) {
+        parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+            dim_t start = 0, end = 0;
+            balance211(rows, nthr, ithr, start, end);
+            entry_t *buf = cand + ithr * buf_size;
+            for (dim_t r = start; r < end; r++) {
+                const dim_t n = select_chunk(src_row(r), 0, L, buf);
+                store_row(r, buf, n, dst, indices);
+            }
+        });
+        return status::success;
+    }
+
+    // Long axes are split between threads and the selections of the chunks
+    // are merged afterwards. Unused entries of a chunk selection are marked
+    // with a negative index.
+    auto partial = scratchpad.template get<entry_t>(
+            memory_tracking::names::key_topk_partial);
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(rows * nparts, nthr, ithr, start, end);
+        entry_t *buf = cand + ithr * buf_size;
+        for (dim_t w = start; w < end; w++) {
+            const dim_t r = w / nparts;
+            const dim_t a_start = (w % nparts) * chunk;
+            const dim_t len = nstl::min(chunk, L - a_start);
+            const dim_t n = select_chunk(src_row(r), a_start, len, buf);
+            entry_t *part = partial + w * k;
+            for (dim_t i = 0; i < k; i++) {
+                if (i < n)
+                    part[i] = buf[i];
+                else
+                    part[i].idx = -1;
+            }
+        }
+    });
+
+    parallel(pd()->nthr_, [&](const int ithr, const int nthr) {
+        dim_t start = 0, end = 0;
+        balance211(rows, nthr, ithr, start, end);
+        entry_t *buf = cand + ithr * buf_size;
+        for (dim_t r = start; r < end; r++) {
+            const entry_t *part = partial + r * nparts * k;
+            dim_t n = 0;
+            for (dim_t i = 0; i < nparts * k; i++)
+                if (part[i].idx >= 0) buf[n++] = part[i];
+            store_row(r, buf, n, dst, indices);
+        }
+    });
+
+    return status::success;
+}
+
+template struct jit_uni_topk_kernel_t<avx512_core>;
+template struct jit_uni_topk_kernel_t<avx2>;
+template struct jit_uni_topk_t<avx512_core>;
+template struct jit_uni_topk_t<avx2>;
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
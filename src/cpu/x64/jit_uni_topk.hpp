@@ -0,0 +1,147 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_JIT_UNI_TOPK_HPP
+#define CPU_X64_JIT_UNI_TOPK_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/cpu_topk_pd.hpp"
+#include "cpu/platform.hpp"
+#include "cpu/topk_utils.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+
+// Scans a range of the axis and appends the values that pass the threshold
+// of the current selection, together with their positions, to a list of
+// candidates. Vectors without candidates cost a load and a compare, so once
+// the threshold settles most of the axis is skipped at the memory bandwidth.
+template <cpu_isa_t isa>
+struct jit_uni_topk_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_topk_kernel_t)
+
+    struct call_params_t {
+        // keep all sizes at 8 bytes -- jit code expects this
+        const void *src;
+        topk_utils::entry_t *cand;
+        size_t *ncand; // output: the number of appended candidates
+        size_t nvec; // the number of full vectors to scan
+        size_t base_idx; // the axis position of the first element
+        float thr;
+    };
+
+    jit_uni_topk_kernel_t(data_type_t data_type, bool is_max);
+
+    void operator()(const call_params_t *p) const {
+        jit_generator::operator()(p);
+    }
+
+    static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    static constexpr int unroll = 4;
+
+    void generate() override;
+    void load(const Vmm &vmm, const Xbyak::Address &addr);
+    void compare(int i);
+    void process(int nregs);
+    void append_candidates(int i);
+
+    const data_type_t data_type_;
+    const size_t dt_size_;
+    const bool is_max_;
+
+    Vmm vmm_src(int i) const { return Vmm(i); }
+    Vmm vmm_cmp(int i) const { return Vmm(unroll + i); }
+    const Vmm vmm_any = Vmm(2 * unroll);
+    const Vmm vmm_thr = Vmm(2 * unroll + 1);
+    Xbyak::Opmask k_cmp(int i) const { return Xbyak::Opmask(1 + i); }
+
+    const Xbyak::Reg64 reg_param = abi_param1;
+    const Xbyak::Reg64 reg_tmp = rax;
+    const Xbyak::Reg64 reg_src = rbx;
+    const Xbyak::Reg64 reg_cand = rdx;
+    const Xbyak::Reg64 reg_nvec = rsi;
+    const Xbyak::Reg64 reg_idx = r8;
+    const Xbyak::Reg64 reg_cnt = r9;
+    const Xbyak::Reg64 reg_mask = r10;
+    const Xbyak::Reg64 reg_bit = r11;
+};
+
+template <cpu_isa_t isa>
+struct jit_uni_topk_t : public primitive_t {
+    struct pd_t : public cpu_topk_pd_t {
+        using cpu_topk_pd_t::cpu_topk_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit:", isa, ""),
+                jit_uni_topk_t);
+
+        status_t init(engine_t *engine);
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+        // The axis is split into nparts_ chunks of chunk_ elements when
+        // there are not enough rows to occupy all threads. Each chunk is
+        // scanned in blocks of block_ elements between threshold updates.
+        dim_t nparts_ = 1;
+        dim_t chunk_ = 0;
+        dim_t block_ = 0;
+        // The capacity of a per-thread candidate buffer.
+        dim_t buf_size_ = 0;
+
+    private:
+        bool axis_is_dense(const memory_desc_t *md) const;
+        void init_conf();
+        void init_scratchpad();
+    };
+
+    jit_uni_topk_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Selects the best k entries of src[start:start + len) to the head of
+    // buf and returns their number.
+    dim_t select_chunk(const char *src, dim_t start, dim_t len,
+            topk_utils::entry_t *buf) const;
+    void store_row(dim_t row, topk_utils::entry_t *buf, dim_t n, void *dst,
+            int32_t *indices) const;
+
+    std::unique_ptr<jit_uni_topk_kernel_t<isa>> kernel_;
+};
+
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
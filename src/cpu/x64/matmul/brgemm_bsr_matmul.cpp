@@ -0,0 +1,232 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cstring>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_bsr_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+bool brgemm_bsr_matmul_t<isa>::pd_t::formats_ok() const {
+    for (auto md : {src_md(0), dst_md(0)}) {
+        const memory_desc_wrapper mdw(md);
+        if (!mdw.is_blocking_desc() || mdw.blocking_desc().inner_nblks != 0)
+            return false;
+        if (mdw.dims()[1] != 1 && mdw.blocking_desc().strides[1] != 1)
+            return false;
+    }
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &bcp = bcp_;
+
+    for (bool m_tail : {false, true}) {
+        const dim_t M = m_tail ? bcp.m_tail : bcp.m_blk;
+        if (M == 0) continue;
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = static_cast<int>(bcp.nb_k);
+
+        brgemm_t &brg = brg_descs_[m_tail];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.0f, 0.0f, bcp.lda, bcp.n_blk, bcp.ldc, M,
+                bcp.n_blk, bcp.k_blk));
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_bsr_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &bcp = bcp_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    // Compressed sparse column view of the weights blocks: for every block
+    // column, pairs of (block row, stored block index).
+    scratchpad.template book<int32_t>(key_matmul_sparse_col_ptr, bcp.nb_n + 1);
+    scratchpad.template book<int32_t>(
+            key_matmul_sparse_col_idx, 2 * bcp.nnz_blocks);
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, bcp.nthr * bcp.nb_k);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper wei_d(weights_md(0));
+
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(wei_d.is_sparse_desc()
+                    && wei_d.encoding() == sparse_encoding::bsr
+                    && everyone_is(s32, wei_d.metadata_type(0),
+                            wei_d.metadata_type(1)),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!memory_desc_wrapper(src_md()).is_sparse_desc()
+                    && !memory_desc_wrapper(dst_md()).is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(f32, src_md()->data_type,
+                             weights_md()->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    auto &bcp = bcp_;
+    bcp.M = M();
+    bcp.N = N();
+    bcp.K = K();
+    bcp.k_blk = wei_d.block_dims()[0];
+    bcp.n_blk = wei_d.block_dims()[1];
+    bcp.nb_k = bcp.K / bcp.k_blk;
+    bcp.nb_n = bcp.N / bcp.n_blk;
+    bcp.m_blk = nstl::min<dim_t>(bcp.M, 64);
+    bcp.nb_m = div_up(bcp.M, bcp.m_blk);
+    bcp.m_tail = bcp.M % bcp.m_blk;
+    bcp.lda = src_md(0)->format_desc.blocking.strides[0];
+    bcp.ldc = dst_md(0)->format_desc.blocking.strides[0];
+    bcp.nnz_blocks = wei_d.nnz_blocks();
+    bcp.nthr = dnnl_get_max_threads();
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::init(engine_t *engine) {
+    for (bool m_tail : {false, true}) {
+        const dim_t M = m_tail ? pd()->bcp().m_tail : pd()->bcp().m_blk;
+        if (M == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(m_tail)));
+        CHECK(safe_ptr_assign(brg_kernels_[m_tail], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_bsr_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &bcp = pd()->bcp();
+
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei_values = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS, 0);
+    const auto *wei_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 1);
+    const auto *wei_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_WEIGHTS, 2);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    src += memory_desc_wrapper(pd()->src_md()).offset0();
+    dst += memory_desc_wrapper(pd()->dst_md()).offset0();
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *col_ptr = scratchpad.template get<int32_t>(key_matmul_sparse_col_ptr);
+    auto *col_idx = scratchpad.template get<int32_t>(key_matmul_sparse_col_idx);
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // Transpose the block structure, so that the blocks contributing to the
+    // same dst block column are adjacent. The number of blocks is small
+    // compared to the amount of compute, so this is done sequentially.
+    for (dim_t j = 0; j <= bcp.nb_n; j++)
+        col_ptr[j] = 0;
+    const dim_t nnz_blocks = wei_pointers[bcp.nb_k];
+    if (nnz_blocks > bcp.nnz_blocks) return status::invalid_arguments;
+    for (dim_t b = 0; b < nnz_blocks; b++)
+        col_ptr[wei_indices[b] + 1]++;
+    for (dim_t j = 0; j < bcp.nb_n; j++)
+        col_ptr[j + 1] += col_ptr[j];
+    for (dim_t kb = 0; kb < bcp.nb_k; kb++) {
+        for (dim_t b = wei_pointers[kb]; b < wei_pointers[kb + 1]; b++) {
+            const int32_t pos = col_ptr[wei_indices[b]]++;
+            col_idx[2 * pos + 0] = static_cast<int32_t>(kb);
+            col_idx[2 * pos + 1] = static_cast<int32_t>(b);
+        }
+    }
+    // Every entry was used as a cursor and now points to the next column.
+    for (dim_t j = bcp.nb_n; j > 0; j--)
+        col_ptr[j] = col_ptr[j - 1];
+    col_ptr[0] = 0;
+
+    const dim_t block_size = bcp.k_blk * bcp.n_blk;
+    // Neighbouring work items share the same weights block column.
+    const dim_t work_amount = bcp.nb_n * bcp.nb_m;
+
+    parallel(bcp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        brgemm_batch_element_t *batch = batch_base + ithr * bcp.nb_k;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            const dim_t nb = iwork / bcp.nb_m;
+            const dim_t mb = iwork % bcp.nb_m;
+            const dim_t m = mb * bcp.m_blk;
+            const bool m_tail = m + bcp.m_blk > bcp.M;
+            const dim_t cur_m = m_tail ? bcp.m_tail : bcp.m_blk;
+            float *dst_ptr = dst + m * bcp.ldc + nb * bcp.n_blk;
+
+            const int bs = col_ptr[nb + 1] - col_ptr[nb];
+            if (bs == 0) {
+                for (dim_t i = 0; i < cur_m; i++)
+                    std::memset(dst_ptr + i * bcp.ldc, 0,
+                            bcp.n_blk * sizeof(float));
+                continue;
+            }
+
+            for (int i = 0; i < bs; i++) {
+                const int32_t *idx = col_idx + 2 * (col_ptr[nb] + i);
+                batch[i].ptr.A = src + m * bcp.lda + idx[0] * bcp.k_blk;
+                batch[i].ptr.B = wei_values + idx[1] * block_size;
+            }
+            brgemm_kernel_execute(
+                    brg_kernels_[m_tail].get(), bs, batch, dst_ptr);
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_bsr_matmul_t<avx512_core>;
+template struct brgemm_bsr_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
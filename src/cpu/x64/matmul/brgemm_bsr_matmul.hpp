@@ -0,0 +1,96 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_BSR_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct brgemm_bsr_matmul_conf_t {
+    dim_t M, N, K;
+    // Weights block dimensions.
+    dim_t k_blk, n_blk;
+    dim_t nb_k, nb_n;
+    dim_t m_blk, nb_m, m_tail;
+    dim_t lda, ldc;
+    dim_t nnz_blocks;
+    int nthr;
+};
+
+// Matmul with dense src and dst and block-sparse weights in the BSR
+// encoding. The dst is computed by (m_blk x n_blk) tiles. For every tile the
+// non-zero weights blocks of the corresponding block column are passed as a
+// batch to a batch-reduce gemm kernel, so zero blocks are neither loaded nor
+// multiplied.
+template <cpu_isa_t isa>
+struct brgemm_bsr_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_bsr:", isa, ""),
+                brgemm_bsr_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const brgemm_bsr_matmul_conf_t &bcp() const { return bcp_; }
+        const brgemm_t &brg_desc(bool m_tail) const {
+            return brg_descs_[m_tail];
+        }
+
+    private:
+        bool formats_ok() const;
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_bsr_matmul_conf_t bcp_
+                = utils::zero<brgemm_bsr_matmul_conf_t>();
+        brgemm_t brg_descs_[2];
+    };
+
+    brgemm_bsr_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[2];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
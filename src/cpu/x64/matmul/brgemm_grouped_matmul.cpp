@@ -0,0 +1,218 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/brgemm_grouped_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace dnnl::impl::format_tag;
+using namespace dnnl::impl::memory_tracking::names;
+using namespace dnnl::impl::utils;
+
+template <cpu_isa_t isa>
+constexpr dim_t brgemm_grouped_matmul_t<isa>::m_kernel_sizes[];
+
+template <cpu_isa_t isa>
+bool brgemm_grouped_matmul_t<isa>::pd_t::formats_ok() const {
+    return memory_desc_wrapper(weights_md(0)).matches_one_of_tag(abc)
+            && memory_desc_wrapper(dst_md(0)).matches_one_of_tag(ab);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init_brgemm_descs() {
+    const auto &bgp = bgp_;
+
+    for_(int m_ker = 0; m_ker < n_m_kernels; m_ker++)
+    for (bool n_tail : {false, true}) {
+        const dim_t M = m_kernel_sizes[m_ker];
+        const dim_t N = n_tail ? bgp.n_tail : bgp.n_blk;
+        if (N == 0) continue;
+
+        brgemm_attr_t brgattr;
+        brgattr.max_bs = 1;
+
+        brgemm_t &brg = brg_descs_[m_ker][n_tail];
+        CHECK(brgemm_desc_init(&brg, isa, brgemm_addr, f32, f32, false, false,
+                brgemm_row_major, 1.0f, 0.0f, bgp.lda, bgp.ldb, bgp.ldc, M, N,
+                bgp.K));
+        CHECK(brgemm_desc_set_attr(&brg, brgattr));
+    }
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_grouped_matmul_t<isa>::pd_t::init_scratchpad() {
+    const auto &bgp = bgp_;
+    auto scratchpad = scratchpad_registry().registrar();
+
+    // Index of the first dst tile of every group.
+    scratchpad.template book<dim_t>(
+            key_matmul_grouped_tile_ptr, bgp.ngroups + 1);
+    scratchpad.template book<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch, bgp.nthr);
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    const memory_desc_wrapper src_d(src_md(0));
+
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(src_d.is_sparse_desc()
+                    && src_d.encoding() == sparse_encoding::grouped
+                    && src_d.metadata_type(0) == s32,
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(!memory_desc_wrapper(weights_md()).is_sparse_desc()
+                    && !memory_desc_wrapper(dst_md()).is_sparse_desc(),
+            VERBOSE_UNSUPPORTED_SPARSE_CFG);
+    VDISPATCH_MATMUL(everyone_is(f32, src_md()->data_type,
+                             weights_md()->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(!with_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(ndims() == 2, VERBOSE_BAD_NDIMS, "dst", ndims());
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    auto &bgp = bgp_;
+    bgp.M = M();
+    bgp.N = N();
+    bgp.K = K();
+    bgp.ngroups = src_d.ngroups();
+    bgp.n_blk = nstl::min<dim_t>(bgp.N, 64);
+    bgp.nb_n = div_up(bgp.N, bgp.n_blk);
+    bgp.n_tail = bgp.N % bgp.n_blk;
+    // The grouped encoding stores the values as a dense row-major matrix.
+    bgp.lda = bgp.K;
+    bgp.ldb = bgp.N;
+    bgp.ldc = bgp.N;
+    bgp.nthr = dnnl_get_max_threads();
+
+    CHECK(init_brgemm_descs());
+    init_scratchpad();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::init(engine_t *engine) {
+    for_(int m_ker = 0; m_ker < n_m_kernels; m_ker++)
+    for (bool n_tail : {false, true}) {
+        if (n_tail && pd()->bgp().n_tail == 0) continue;
+
+        brgemm_kernel_t *ker = nullptr;
+        CHECK(brgemm_kernel_create(&ker, pd()->brg_desc(m_ker, n_tail)));
+        CHECK(safe_ptr_assign(brg_kernels_[m_ker][n_tail], ker));
+    }
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_grouped_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto &bgp = pd()->bgp();
+
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
+    const auto *src_offsets = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    wei += memory_desc_wrapper(pd()->weights_md()).offset0();
+    dst += memory_desc_wrapper(pd()->dst_md()).offset0();
+
+    const auto &scratchpad = ctx.get_scratchpad_grantor();
+    auto *tile_ptr = scratchpad.template get<dim_t>(key_matmul_grouped_tile_ptr);
+    auto *batch_base = scratchpad.template get<brgemm_batch_element_t>(
+            key_brgemm_primitive_batch);
+
+    // Enumerate the dst tiles of all the groups. The number of groups is
+    // small compared to the amount of compute, so this is done sequentially.
+    const dim_t m_blk = m_kernel_sizes[0];
+    if (src_offsets[0] != 0 || src_offsets[bgp.ngroups] != bgp.M)
+        return status::invalid_arguments;
+    tile_ptr[0] = 0;
+    for (dim_t g = 0; g < bgp.ngroups; g++) {
+        const dim_t group_m = src_offsets[g + 1] - src_offsets[g];
+        if (group_m < 0) return status::invalid_arguments;
+        tile_ptr[g + 1] = tile_ptr[g] + div_up(group_m, m_blk) * bgp.nb_n;
+    }
+    const dim_t work_amount = tile_ptr[bgp.ngroups];
+
+    parallel(bgp.nthr, [&](const int ithr, const int nthr) {
+        dim_t start {0}, end {0};
+        balance211(work_amount, nthr, ithr, start, end);
+        if (start >= end) return;
+        brgemm_batch_element_t *batch = batch_base + ithr;
+
+        // Find the group of the first tile, the next ones are found by
+        // advancing from it.
+        dim_t g = std::upper_bound(tile_ptr, tile_ptr + bgp.ngroups + 1, start)
+                - tile_ptr - 1;
+
+        for (dim_t iwork = start; iwork < end; iwork++) {
+            while (iwork >= tile_ptr[g + 1])
+                g++;
+            const dim_t m_start = src_offsets[g];
+            const dim_t m_end = src_offsets[g + 1];
+            const dim_t nb_m = div_up(m_end - m_start, m_blk);
+            // Neighbouring work items share the same weights block column.
+            const dim_t nb = (iwork - tile_ptr[g]) / nb_m;
+            const dim_t mb = (iwork - tile_ptr[g]) % nb_m;
+            const dim_t n = nb * bgp.n_blk;
+            const bool n_tail = n + bgp.n_blk > bgp.N;
+            const float *wei_ptr = wei + g * bgp.K * bgp.ldb + n;
+
+            dim_t m = m_start + mb * m_blk;
+            const dim_t m_blk_end = nstl::min(m + m_blk, m_end);
+            for (int m_ker = 0; m < m_blk_end; m_ker++) {
+                const dim_t ker_m = m_kernel_sizes[m_ker];
+                for (; m + ker_m <= m_blk_end; m += ker_m) {
+                    batch[0].ptr.A = src + m * bgp.lda;
+                    batch[0].ptr.B = wei_ptr;
+                    brgemm_kernel_execute(brg_kernels_[m_ker][n_tail].get(), 1,
+                            batch, dst + m * bgp.ldc + n);
+                }
+            }
+        }
+    });
+
+    return status::success;
+}
+
+template struct brgemm_grouped_matmul_t<avx512_core>;
+template struct brgemm_grouped_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
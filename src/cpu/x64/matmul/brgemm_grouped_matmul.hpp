@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+#define CPU_X64_MATMUL_BRGEMM_GROUPED_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/brgemm/brgemm.hpp"
+#include "cpu/x64/cpu_isa_traits.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+struct brgemm_grouped_matmul_conf_t {
+    dim_t M, N, K;
+    dim_t ngroups;
+    dim_t n_blk, nb_n, n_tail;
+    dim_t lda, ldb, ldc;
+    int nthr;
+};
+
+// Matmul with a src in the grouped encoding, where every group of rows is
+// multiplied by its own weights matrix (as in mixture-of-experts layers).
+// Group sizes are known only at execution time, so the dst tiles of all the
+// groups are enumerated then and distributed over the threads at once. This
+// keeps the threads busy even when the groups are small or unbalanced.
+template <cpu_isa_t isa>
+struct brgemm_grouped_matmul_t : public primitive_t {
+    // Row sizes of the kernels. The first one is the row block size, the rows
+    // of a group that do not fill a block are computed by the smaller ones.
+    static constexpr int n_m_kernels = 6;
+    static constexpr dim_t m_kernel_sizes[n_m_kernels] = {32, 16, 8, 4, 2, 1};
+
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("brg_grouped:", isa, ""),
+                brgemm_grouped_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const brgemm_grouped_matmul_conf_t &bgp() const { return bgp_; }
+        const brgemm_t &brg_desc(int m_ker, bool n_tail) const {
+            return brg_descs_[m_ker][n_tail];
+        }
+
+    private:
+        bool formats_ok() const;
+        status_t init_brgemm_descs();
+        void init_scratchpad();
+
+        brgemm_grouped_matmul_conf_t bgp_
+                = utils::zero<brgemm_grouped_matmul_conf_t>();
+        brgemm_t brg_descs_[n_m_kernels][2];
+    };
+
+    brgemm_grouped_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    std::unique_ptr<brgemm_kernel_t> brg_kernels_[n_m_kernels][2];
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
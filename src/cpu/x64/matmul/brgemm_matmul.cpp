@@ -22,6 +22,8 @@
 #include "common/utils.hpp"
 
 #include "cpu/cpu_primitive.hpp"
+#include "cpu/matmul/gemm_bf16_matmul.hpp"
+#include "cpu/matmul/gemm_x8s8s32x_matmul.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
 #include "cpu/scale_utils.hpp"
 
@@ -44,6 +46,39 @@ using namespace nstl;
 
 using namespace data_type;
 
+// A matmul with M or N equal to 1 is a memory bound gemv. The gemm-based
+// implementations dispatch int8 and bf16 gemv to the threaded gemv drivers,
+// which split the reduction between threads as well and read the weights in
+// a plain layout, so they are preferred whenever they accept the problem.
+template <cpu_isa_t isa>
+bool brgemm_matmul_t<isa>::pd_t::gemv_is_preferred(engine_t *engine) const {
+    const auto src_dt = src_md_.data_type;
+    const auto wei_dt = weights_md_.data_type;
+    const auto dst_dt = dst_md_.data_type;
+    const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8;
+    const bool is_bf16 = everyone_is(bf16, src_dt, wei_dt);
+
+    if (!(is_int8 || is_bf16) || !mayiuse(avx512_core)) return false;
+    if (has_runtime_dims_or_strides() || batch() != 1) return false;
+    if (!one_of(1, M(), N())) return false;
+    // The int8 gemv kernels do not support zero points.
+    if (!attr()->zero_points_.has_default_values()) return false;
+
+    primitive_desc_t *gemm_pd = nullptr;
+    status_t status = status::unimplemented;
+    if (is_int8)
+        status = primitive_desc_t::create<gemm_x8s8s32x_matmul_t::pd_t>(
+                &gemm_pd, op_desc(), attr(), engine, nullptr);
+    else if (dst_dt == f32)
+        status = primitive_desc_t::create<gemm_bf16_matmul_t<f32>::pd_t>(
+                &gemm_pd, op_desc(), attr(), engine, nullptr);
+    else if (dst_dt == bf16)
+        status = primitive_desc_t::create<gemm_bf16_matmul_t<bf16>::pd_t>(
+                &gemm_pd, op_desc(), attr(), engine, nullptr);
+    delete gemm_pd;
+    return status == status::success;
+}
+
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto src_dt = src_md_.data_type;
@@ -112,6 +147,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     VDISPATCH_MATMUL(check_attr_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
     VDISPATCH_MATMUL(check_attr_zero_points(), VERBOSE_UNSUPPORTED_ZP_CFG);
     VDISPATCH_MATMUL(check_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(!gemv_is_preferred(engine), VERBOSE_GEMV_SHAPES);
 
     CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
             dst_md_, bias_md_, attr_));
@@ -258,6 +294,8 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const int M_chunks = brgmm_ctx.get_M_chunks();
     const int M_chunk_size = brgmm_ctx.get_M_chunk_size();
     const int M_chunk_tail = brgmm_ctx.get_M_chunk_tail();
+    const int N_chunks = brgmm_ctx.get_N_chunks();
+    const int N_chunk_size = brgmm_ctx.get_N_chunk_size();
     parallel(num_threads, [&](const int ithr, const int nthr) {
         const int ithr_bmn = brgmm_ctx.get_thread_idx_for_bmn(ithr);
         const int ithr_k = brgmm_ctx.get_thread_idx_for_k(ithr);
@@ -276,7 +314,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
         int b {0}, mc {0}, nc {0};
         nd_iterator_init(
-                start, b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+                start, b, bgmmc.batch, mc, M_chunks, nc, N_chunks);
         int mc_prev = -1;
         int nc_prev = -1;
         int b_prev = -1;
@@ -284,9 +322,9 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             auto m_start = mc * M_chunk_size;
             const bool m_chunk_tail = mc == M_chunks - 1 && M_chunk_tail > 0;
             auto m_end = m_start + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
-            auto n_start = nc * bgmmc.N_chunk_size;
+            auto n_start = nc * N_chunk_size;
             auto n_end = nstl::min(
-                    (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
+                    (nc + 1) * N_chunk_size, bgmmc.num_N_blocks);
             int kc_prev = -1;
             for_(int kc = kc_start; kc < kc_end; kc++)
             for (int nb = n_start; nb < n_end; nb++) {
@@ -312,7 +350,7 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
             nc_prev = nc;
             b_prev = b;
             ++start;
-            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, N_chunks);
         }
         if (is_amx) { amx_tile_release(); }
     });
@@ -503,17 +541,19 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
         const int M_chunks = brgmm_ctx.get_M_chunks();
         const int M_chunk_size = brgmm_ctx.get_M_chunk_size();
         const int M_chunk_tail = brgmm_ctx.get_M_chunk_tail();
+        const int N_chunks = brgmm_ctx.get_N_chunks();
+        const int N_chunk_size = brgmm_ctx.get_N_chunk_size();
         assert(bgmmc.batch == 1);
         nd_iterator_init(bmn_start + start, b, bgmmc.batch, mc, M_chunks, nc,
-                bgmmc.N_chunks);
+                N_chunks);
         while (start < end) {
             auto mb_start = mc * M_chunk_size;
             const bool m_chunk_tail = mc == M_chunks - 1 && M_chunk_tail > 0;
             auto mb_end
                     = mb_start + (m_chunk_tail ? M_chunk_tail : M_chunk_size);
-            auto nb_start = nc * bgmmc.N_chunk_size;
+            auto nb_start = nc * N_chunk_size;
             auto nb_end = nstl::min(
-                    (nc + 1) * bgmmc.N_chunk_size, bgmmc.num_N_blocks);
+                    (nc + 1) * N_chunk_size, bgmmc.num_N_blocks);
             for (int mb = mb_start; mb < mb_end; mb++) {
                 const int curr_M_blk = brgmm_ctx.get_M_kernel_size(mb);
                 const int m_ker_idx = brgmm_ctx.get_M_kernel_idx(mb);
@@ -597,7 +637,7 @@ void brgemm_matmul_t<isa>::maybe_reduce_partial_results_and_apply_postops(
                 }
             }
             ++start;
-            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, bgmmc.N_chunks);
+            nd_iterator_step(b, bgmmc.batch, mc, M_chunks, nc, N_chunks);
         }
     });
 }
@@ -825,10 +865,20 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         copy_A_src_stride_ = bgmmc.copy_A_src_stride;
         if (bgmmc.is_runtime_M) {
             M_ = helper.M();
-            M_chunks_ = M_ / bgmmc.M_chunk_elems;
+            // Use the chunks precomputed for the bucket of the actual M.
             M_chunk_size_ = bgmmc.M_chunk_size;
+            N_chunk_size_ = bgmmc.N_chunk_size;
+            for (int i = 0; i < bgmmc.num_runtime_M_buckets; i++) {
+                if (M_ > bgmmc.runtime_M_bucket_max[i]) continue;
+                M_chunk_size_ = bgmmc.runtime_M_chunk_size[i];
+                N_chunk_size_ = bgmmc.runtime_N_chunk_size[i];
+                break;
+            }
+            N_chunks_ = div_up(bgmmc.num_N_blocks, N_chunk_size_);
+            const dim_t M_chunk_elems = bgmmc.M_blk * M_chunk_size_;
+            M_chunks_ = M_ / M_chunk_elems;
             num_M_blocks_ = M_chunks_ * M_chunk_size_;
-            M_chunk_tail_elements_ = M_ % bgmmc.M_chunk_elems;
+            M_chunk_tail_elements_ = M_ % M_chunk_elems;
             int tail = M_chunk_tail_elements_;
             dim_t m_idx = M_ - tail;
             int tail_idx = 0;
@@ -877,6 +927,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             num_M_blocks_ = bgmmc.num_M_blocks;
             M_chunk_size_ = bgmmc.M_chunk_size;
             M_chunk_tail_ = num_M_blocks_ % M_chunk_size_;
+            N_chunks_ = bgmmc.N_chunks;
+            N_chunk_size_ = bgmmc.N_chunk_size;
             M_chunk_tail_elements_ = M_ % bgmmc.M_chunk_elems;
             M_tail_block_start_ = num_M_blocks_ - (bgmmc.M_tail > 0);
             for (int dim_idx = 0; dim_idx < 3; dim_idx++)
@@ -884,7 +936,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             A_ptr_shift_b_ = bgmmc.A_ptr_shift_b;
         }
         // parallelization
-        parallel_work_amount_ = bgmmc.batch * M_chunks_ * bgmmc.N_chunks;
+        parallel_work_amount_ = bgmmc.batch * M_chunks_ * N_chunks_;
 
         // The number of threads available during primitive execution may
         // increase (ex. Eigen threadpool implementation) or decrease
@@ -1058,7 +1110,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             return get_buf_C_par_reduction_ptr(ithr_k, m_blk_idx, n_blk_idx);
         }
 
-        const int n_blk_local = n_blk_idx % bgmmc_.N_chunk_size;
+        const int n_blk_local = n_blk_idx % N_chunk_size_;
         if (is_runtime_M_tail_chunk(m_blk_idx)) {
             const int tail_idx = get_M_tail_block_idx(m_blk_idx);
             const int curr_m_block_size
@@ -1066,12 +1118,12 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             const dim_t curr_m_buf_shift
                     = m_tail_processing_[tail_idx].buf_dim_idx;
             const dim_t offset = bgmmc_.acc_dt_sz * bgmmc_.LDC
-                    * (curr_m_buf_shift * bgmmc_.N_chunk_size
+                    * (curr_m_buf_shift * N_chunk_size_
                             + n_blk_local * curr_m_block_size);
             return buf_C_ptr_ + ithr * bgmmc_.buffer_c_per_thread_sz + offset;
         }
         const int m_blk_local = m_blk_idx % M_chunk_size_;
-        const int buf_idx = bgmmc_.N_chunk_size * m_blk_local + n_blk_local;
+        const int buf_idx = N_chunk_size_ * m_blk_local + n_blk_local;
 
         return buf_C_ptr_ + ithr * bgmmc_.buffer_c_per_thread_sz
                 + buf_idx * bgmmc_.buffer_c_chunk_sz;
@@ -1183,7 +1235,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         if (!bgmmc_.s8s8_compensation_required) return nullptr;
 
         const int n_blk_local = bgmmc_.use_buffer_b
-                ? n_blk_idx % bgmmc_.N_chunk_size
+                ? n_blk_idx % N_chunk_size_
                 : n_blk_idx;
         return s8s8_compensation_ptr_ + ithr * bgmmc_.s8s8_comp_ithr_str
                 + get_bb_idx(b, bgmmc_.bcast_B_desc) * bgmmc_.s8s8_comp_b_str
@@ -1214,7 +1266,7 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
             int ithr, int b_idx, int n_blk_idx) const {
         if (!bgmmc_.has_zero_point_a) return nullptr;
 
-        const int n_blk_local = n_blk_idx % bgmmc_.N_chunk_size;
+        const int n_blk_local = n_blk_idx % N_chunk_size_;
         int32_t *zp_comp = zero_point_a_compensations_ptr_
                 + ithr * bgmmc_.zp_a_comp_elems_per_thr
                 + n_blk_local * bgmmc_.zp_a_comp_shift_n;
@@ -1311,6 +1363,8 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
     int get_M_chunks() const { return M_chunks_; }
     int get_num_M_blocks() const { return num_M_blocks_; }
     int get_M_chunk_size() const { return M_chunk_size_; }
+    int get_N_chunks() const { return N_chunks_; }
+    int get_N_chunk_size() const { return N_chunk_size_; }
     int get_M_chunk_tail() const { return M_chunk_tail_; }
     int get_M_tail_block_idx(int m_block_idx) const {
         return m_block_idx - M_tail_block_start_;
@@ -1470,6 +1524,8 @@ private:
     int M_chunks_;
     int num_M_blocks_;
     int M_chunk_size_;
+    int N_chunks_;
+    int N_chunk_size_;
     int M_chunk_tail_;
     int M_chunk_tail_elements_;
     int M_tail_block_start_;
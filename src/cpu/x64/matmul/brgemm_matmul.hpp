@@ -37,7 +37,7 @@ namespace x64 {
 namespace matmul {
 
 namespace {
-constexpr int dynamic_m_tails[] = {32, 16, 8, 1};
+constexpr int dynamic_m_tails[] = {32, 16, 8, 4, 2, 1};
 constexpr int max_num_dynamic_m_tails
         = sizeof(dynamic_m_tails) / sizeof(dynamic_m_tails[0]);
 constexpr int max_num_brg_kernels_matmul
@@ -96,6 +96,8 @@ struct brgemm_matmul_t : public primitive_t {
         }
 
     private:
+        bool gemv_is_preferred(engine_t *engine) const;
+
         brgemm_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
     };
@@ -1223,6 +1223,43 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     return status::success;
 }
 
+void init_runtime_M_buckets(brgemm_matmul_conf_t &bgmmc) {
+    // The chunk sizes chosen for an unknown M are too coarse to occupy all
+    // the threads when the actual M is small. For every bucket the chunks
+    // are shrunk until there is a work item per thread, as long as a chunk
+    // still has enough work to amortize the copies and the threading.
+    const dim_t bucket_max[brgemm_matmul_conf_t::num_runtime_M_buckets]
+            = {1, 8, 64};
+    const dim_t min_chunk_work = 1 << 15; // in multiply-adds
+    const dim_t nb_n = bgmmc.num_N_blocks;
+
+    for (int i = 0; i < brgemm_matmul_conf_t::num_runtime_M_buckets; i++) {
+        const dim_t M = bucket_max[i];
+        const dim_t nb_m = div_up(M, bgmmc.M_blk);
+        const auto chunk_work = [&](int m_chunk, int n_chunk) {
+            return nstl::min(M, m_chunk * bgmmc.M_blk) * bgmmc.K * bgmmc.N_blk
+                    * n_chunk;
+        };
+
+        int m_chunk = bgmmc.M_chunk_size;
+        int n_chunk = bgmmc.N_chunk_size;
+        while (div_up(nb_m, m_chunk) * div_up(nb_n, n_chunk) < bgmmc.nthr) {
+            if (n_chunk > 1
+                    && chunk_work(m_chunk, n_chunk - 1) >= min_chunk_work)
+                n_chunk--;
+            else if (m_chunk > 1
+                    && chunk_work(m_chunk - 1, n_chunk) >= min_chunk_work)
+                m_chunk--;
+            else
+                break;
+        }
+
+        bgmmc.runtime_M_bucket_max[i] = M;
+        bgmmc.runtime_M_chunk_size[i] = m_chunk;
+        bgmmc.runtime_N_chunk_size[i] = n_chunk;
+    }
+}
+
 void init_aux_values(brgemm_matmul_conf_t &bgmmc,
         const memory_desc_wrapper &src_d, const memory_desc_wrapper &wei_d,
         const memory_desc_wrapper &dst_d) {
@@ -1235,6 +1272,7 @@ void init_aux_values(brgemm_matmul_conf_t &bgmmc,
     bgmmc.K_chunks = div_up(bgmmc.K, bgmmc.K_chunk_elems);
     bgmmc.num_M_blocks = div_up(bgmmc.M, bgmmc.M_blk);
     bgmmc.num_N_blocks = div_up(bgmmc.N, bgmmc.N_blk);
+    if (bgmmc.is_runtime_M) init_runtime_M_buckets(bgmmc);
     const int last_chunck_batch_size
             = (nstl::max(bgmmc.K, bgmmc.K_blk)
                       - (bgmmc.K_chunks - 1) * bgmmc.K_chunk_elems)
@@ -184,6 +184,12 @@ struct brgemm_matmul_conf_t {
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
+    // Runtime M only: chunk sizes precomputed for the buckets of M up to the
+    // corresponding bound. Larger M uses M_chunk_size and N_chunk_size.
+    static constexpr int num_runtime_M_buckets = 3;
+    dim_t runtime_M_bucket_max[num_runtime_M_buckets];
+    int runtime_M_chunk_size[num_runtime_M_buckets];
+    int runtime_N_chunk_size[num_runtime_M_buckets];
     inline bool lda_big_pow2() const {
         const dim_t big_K_threshold = 4096;
         return !transposed_A && math::is_pow2(K) && K >= big_K_threshold;
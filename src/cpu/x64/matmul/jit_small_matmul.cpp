@@ -0,0 +1,402 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <limits>
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/nstl.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/x64/matmul/jit_small_matmul.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+using namespace dnnl::impl::data_type;
+using namespace Xbyak;
+
+namespace {
+
+struct small_matmul_key_t : public kernel_cache::key_impl_t {
+    small_matmul_key_t(cpu_isa_t isa, const jit_small_matmul_conf_t &jcp)
+        : isa_(isa), jcp_(jcp) {}
+
+    bool compare(const kernel_cache::key_impl_t *key_impl) const override {
+        auto *o = dynamic_cast<const small_matmul_key_t *>(key_impl);
+        if (o == nullptr) return false;
+        return isa_ == o->isa_ && jcp_.M == o->jcp_.M && jcp_.N == o->jcp_.N
+                && jcp_.K == o->jcp_.K && jcp_.lda == o->jcp_.lda
+                && jcp_.ldb == o->jcp_.ldb && jcp_.ldc == o->jcp_.ldc
+                && jcp_.with_bias == o->jcp_.with_bias;
+    }
+
+    size_t hash() const override {
+        size_t seed = 0;
+        seed = hash_combine(seed, static_cast<size_t>(isa_));
+        seed = hash_combine(seed, jcp_.M);
+        seed = hash_combine(seed, jcp_.N);
+        seed = hash_combine(seed, jcp_.K);
+        seed = hash_combine(seed, jcp_.lda);
+        seed = hash_combine(seed, jcp_.ldb);
+        seed = hash_combine(seed, jcp_.ldc);
+        seed = hash_combine(seed, jcp_.with_bias);
+        return seed;
+    }
+
+private:
+    cpu_isa_t isa_;
+    jit_small_matmul_conf_t jcp_;
+};
+
+struct small_matmul_kernel_value_t : public kernel_cache::value_impl_t {
+    small_matmul_kernel_value_t(std::unique_ptr<jit_generator> &&kernel)
+        : kernel(std::move(kernel)) {}
+
+    std::unique_ptr<jit_generator> kernel;
+};
+
+// Returns the offset of the matrix that contributes to the dst matrix with
+// the linear batch index `b`. Batch dimensions of size one are broadcast.
+dim_t batch_offset(
+        const memory_desc_wrapper &mdw, const dims_t dst_dims, dim_t b) {
+    dim_t off = mdw.offset0();
+    for (int d = mdw.ndims() - 3; d >= 0; --d) {
+        const dim_t idx = b % dst_dims[d];
+        b /= dst_dims[d];
+        if (mdw.dims()[d] != 1) off += idx * mdw.blocking_desc().strides[d];
+    }
+    return off;
+}
+
+} // namespace
+
+// The kernel computes dst = src * wei (+ bias) for a single matrix. The M
+// dimension is split into blocks of m_blk rows. For each block, all
+// m_blk x N dst values live in vector registers while the K loop is fully
+// unrolled: a row of weights is loaded once and multiplied by m_blk
+// broadcast src values.
+template <cpu_isa_t isa>
+struct jit_small_matmul_kernel_t : public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_small_matmul_kernel_t)
+
+    using Vmm = typename cpu_isa_traits<isa>::Vmm;
+
+    jit_small_matmul_kernel_t(const jit_small_matmul_conf_t &jcp)
+        : jit_generator(jit_name()), jcp_(jcp) {
+        n_vecs_ = static_cast<int>(utils::div_up(jcp_.N, simd_w_));
+        tail_size_ = static_cast<int>(jcp_.N % simd_w_);
+        // On avx2 one register holds the broadcast src value and one more the
+        // tail mask.
+        const int n_aux_vregs = isa == avx512_core ? 0 : 2;
+        const int n_acc_rows
+                = (isa_num_vregs(isa) - n_aux_vregs - n_vecs_) / n_vecs_;
+        m_blk_ = nstl::min(static_cast<int>(jcp_.M), n_acc_rows);
+    }
+
+    void generate() override;
+
+private:
+    static constexpr int simd_w_ = cpu_isa_traits<isa>::vlen / sizeof(float);
+    static constexpr int typesize_ = sizeof(float);
+
+    const jit_small_matmul_conf_t jcp_;
+    int n_vecs_ = 0;
+    int tail_size_ = 0;
+    int m_blk_ = 0;
+
+    const Reg64 reg_param = abi_param1;
+    const Reg64 reg_src = r8;
+    const Reg64 reg_wei = r9;
+    const Reg64 reg_bias = r10;
+    const Reg64 reg_dst = r11;
+    const Reg64 reg_tmp = rax;
+
+    const Opmask tail_opmask = Opmask(1);
+
+    Vmm vreg_acc(int m, int n) const { return Vmm(m * n_vecs_ + n); }
+    Vmm vreg_wei(int n) const { return Vmm(m_blk_ * n_vecs_ + n); }
+    Vmm vreg_src_bcast() const { return Vmm(isa_num_vregs(isa) - 2); }
+    Vmm tail_vmask() const { return Vmm(isa_num_vregs(isa) - 1); }
+
+    bool is_tail(int n) const { return tail_size_ > 0 && n == n_vecs_ - 1; }
+
+    Address src_ptr(dim_t m, dim_t k) const {
+        return ptr[reg_src + (m * jcp_.lda + k) * typesize_];
+    }
+    Address src_bcast_ptr(dim_t m, dim_t k) const {
+        return ptr_b[reg_src + (m * jcp_.lda + k) * typesize_];
+    }
+    Address wei_ptr(dim_t k, int n) const {
+        return ptr[reg_wei + (k * jcp_.ldb + n * simd_w_) * typesize_];
+    }
+    Address bias_ptr(int n) const {
+        return ptr[reg_bias + n * simd_w_ * typesize_];
+    }
+    Address dst_ptr(dim_t m, int n) const {
+        return ptr[reg_dst + (m * jcp_.ldc + n * simd_w_) * typesize_];
+    }
+
+    void load_tail(const Zmm &dst, const Address &src) {
+        uni_vmovups_tail(dst, tail_opmask, src);
+    }
+    void load_tail(const Ymm &dst, const Address &src) {
+        uni_vmovups_tail(dst, tail_vmask(), src);
+    }
+    void store_tail(const Address &dst, const Zmm &src) {
+        uni_vmovups_tail(dst, tail_opmask, src);
+    }
+    void store_tail(const Address &dst, const Ymm &src) {
+        uni_vmovups_tail(dst, tail_vmask(), src);
+    }
+
+    void load(const Vmm &dst, const Address &src, bool tail) {
+        if (tail)
+            load_tail(dst, src);
+        else
+            uni_vmovups(dst, src);
+    }
+    void store(const Address &dst, const Vmm &src, bool tail) {
+        if (tail)
+            store_tail(dst, src);
+        else
+            uni_vmovups(dst, src);
+    }
+
+    void prepare_tail_mask();
+    void compute_m_block(dim_t m_start, int mb);
+};
+
+template <cpu_isa_t isa>
+void jit_small_matmul_kernel_t<isa>::compute_m_block(dim_t m_start, int mb) {
+    for (dim_t k = 0; k < jcp_.K; k++) {
+        for (int n = 0; n < n_vecs_; n++)
+            load(vreg_wei(n), wei_ptr(k, n), is_tail(n));
+
+        for (int m = 0; m < mb; m++) {
+            // The first product initializes the accumulators, which saves
+            // zeroing them.
+            if (isa == avx512_core) {
+                const auto src = src_bcast_ptr(m_start + m, k);
+                for (int n = 0; n < n_vecs_; n++) {
+                    if (k == 0)
+                        vmulps(vreg_acc(m, n), vreg_wei(n), src);
+                    else
+                        vfmadd231ps(vreg_acc(m, n), vreg_wei(n), src);
+                }
+            } else {
+                vbroadcastss(vreg_src_bcast(), src_ptr(m_start + m, k));
+                for (int n = 0; n < n_vecs_; n++) {
+                    if (k == 0)
+                        vmulps(vreg_acc(m, n), vreg_wei(n), vreg_src_bcast());
+                    else
+                        vfmadd231ps(
+                                vreg_acc(m, n), vreg_wei(n), vreg_src_bcast());
+                }
+            }
+        }
+    }
+
+    if (jcp_.with_bias) {
+        for (int n = 0; n < n_vecs_; n++)
+            load(vreg_wei(n), bias_ptr(n), is_tail(n));
+        for (int m = 0; m < mb; m++)
+            for (int n = 0; n < n_vecs_; n++)
+                vaddps(vreg_acc(m, n), vreg_acc(m, n), vreg_wei(n));
+    }
+
+    for (int m = 0; m < mb; m++)
+        for (int n = 0; n < n_vecs_; n++)
+            store(dst_ptr(m_start + m, n), vreg_acc(m, n), is_tail(n));
+}
+
+template <cpu_isa_t isa>
+void jit_small_matmul_kernel_t<isa>::generate() {
+    preamble();
+
+#define PARAM_OFF(x) offsetof(jit_small_matmul_call_params_t, x)
+    mov(reg_src, ptr[reg_param + PARAM_OFF(src)]);
+    mov(reg_wei, ptr[reg_param + PARAM_OFF(wei)]);
+    if (jcp_.with_bias) mov(reg_bias, ptr[reg_param + PARAM_OFF(bias)]);
+    mov(reg_dst, ptr[reg_param + PARAM_OFF(dst)]);
+#undef PARAM_OFF
+
+    prepare_tail_mask();
+
+    for (dim_t m = 0; m < jcp_.M; m += m_blk_)
+        compute_m_block(m, nstl::min(m_blk_, static_cast<int>(jcp_.M - m)));
+
+    postamble();
+}
+
+template <>
+void jit_small_matmul_kernel_t<avx512_core>::prepare_tail_mask() {
+    if (tail_size_ == 0) return;
+
+    const int mask_f32 = (1 << tail_size_) - 1;
+
+    Reg32 regw_tmp = reg_tmp.cvt32();
+    mov(regw_tmp, mask_f32);
+    kmovw(tail_opmask, regw_tmp);
+}
+
+template <>
+void jit_small_matmul_kernel_t<avx2>::prepare_tail_mask() {
+    if (tail_size_ == 0) return;
+
+    static const uint32_t mask_f32[]
+            = {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+                    0xffffffff, 0xffffffff, 0, 0, 0, 0, 0, 0, 0};
+
+    mov(reg_tmp, reinterpret_cast<size_t>(&mask_f32[7 - tail_size_]));
+    vmovups(tail_vmask(), ptr[reg_tmp]);
+}
+
+template <cpu_isa_t isa>
+bool jit_small_matmul_t<isa>::pd_t::formats_ok() const {
+    // Displacements into every matrix are encoded as 32-bit immediates.
+    const dim_t max_ld = std::numeric_limits<int32_t>::max()
+            / (max_dim * static_cast<dim_t>(sizeof(float)));
+
+    for (auto md : {src_md(0), weights_md(0), dst_md(0)}) {
+        const memory_desc_wrapper mdw(md);
+        if (!mdw.is_blocking_desc() || mdw.blocking_desc().inner_nblks != 0)
+            return false;
+        const int nd = mdw.ndims();
+        const auto &strides = mdw.blocking_desc().strides;
+        if (mdw.dims()[nd - 1] != 1 && strides[nd - 1] != 1) return false;
+        if (strides[nd - 2] > max_ld) return false;
+    }
+
+    if (with_bias()) {
+        const memory_desc_wrapper bia_d(weights_md(1));
+        if (!bia_d.is_blocking_desc() || bia_d.blocking_desc().inner_nblks != 0)
+            return false;
+        if (N() != 1 && bia_d.blocking_desc().strides[ndims() - 1] != 1)
+            return false;
+    }
+
+    return true;
+}
+
+template <cpu_isa_t isa>
+status_t jit_small_matmul_t<isa>::pd_t::init(engine_t *engine) {
+    VDISPATCH_MATMUL(mayiuse(isa), VERBOSE_UNSUPPORTED_ISA);
+    VDISPATCH_MATMUL(is_dense_data(), VERBOSE_NONTRIVIAL_STRIDE);
+    VDISPATCH_MATMUL(utils::everyone_is(f32, src_md()->data_type,
+                             weights_md()->data_type, dst_md()->data_type),
+            VERBOSE_UNSUPPORTED_DT);
+    VDISPATCH_MATMUL(IMPLICATION(with_bias(),
+                             weights_md(1)->data_type == f32
+                                     && is_bias_1xN()),
+            VERBOSE_UNSUPPORTED_BIAS_CFG);
+    VDISPATCH_MATMUL(attr()->has_default_values(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(
+            !has_runtime_dims_or_strides(), VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VDISPATCH_MATMUL(!has_zero_dim_memory(), VERBOSE_EMPTY_TENSOR, "");
+    VDISPATCH_MATMUL(M() <= max_dim && N() <= max_dim && K() <= max_dim,
+            VERBOSE_LARGE_SHAPES);
+    VDISPATCH_MATMUL(set_default_formats(), VERBOSE_UNSUPPORTED_TAG);
+    VDISPATCH_MATMUL(formats_ok(), VERBOSE_UNSUPPORTED_TAG);
+
+    const int nd = ndims();
+    jcp_.M = M();
+    jcp_.N = N();
+    jcp_.K = K();
+    jcp_.lda = src_md(0)->format_desc.blocking.strides[nd - 2];
+    jcp_.ldb = weights_md(0)->format_desc.blocking.strides[nd - 2];
+    jcp_.ldc = dst_md(0)->format_desc.blocking.strides[nd - 2];
+    jcp_.with_bias = with_bias();
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_small_matmul_t<isa>::init(engine_t *engine) {
+    using result_t = kernel_cache::iface_t::result_t;
+
+    kernel_cache::iface_t::create_func_ptr_t create
+            = [](void *context) -> result_t {
+        const auto &jcp
+                = *static_cast<const jit_small_matmul_conf_t *>(context);
+        std::unique_ptr<jit_generator> kernel(
+                new jit_small_matmul_kernel_t<isa>(jcp));
+        const status_t status = kernel->create_kernel();
+        if (status != status::success) return result_t {nullptr, status};
+        std::shared_ptr<kernel_cache::value_impl_t> value
+                = std::make_shared<small_matmul_kernel_value_t>(
+                        std::move(kernel));
+        return result_t {kernel_cache::value_t(value), status};
+    };
+
+    jit_small_matmul_conf_t jcp = pd()->jcp();
+    kernel_cache::key_t key(std::make_shared<small_matmul_key_t>(isa, jcp));
+    auto result = kernel_cache::get().get_or_create(key, *create, &jcp);
+    CHECK(result.status);
+
+    kernel_value_ = result.value.release();
+    kernel_ = std::static_pointer_cast<small_matmul_kernel_value_t>(
+            kernel_value_)
+                      ->kernel.get();
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+status_t jit_small_matmul_t<isa>::execute(const exec_ctx_t &ctx) const {
+    const auto *src = CTX_IN_MEM(const float *, DNNL_ARG_SRC);
+    const auto *wei = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
+    const auto *bias = CTX_IN_MEM(const float *, DNNL_ARG_BIAS);
+    auto *dst = CTX_OUT_MEM(float *, DNNL_ARG_DST);
+
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper wei_d(pd()->weights_md(0));
+    const memory_desc_wrapper bia_d(pd()->weights_md(1));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+
+    const auto &dst_dims = dst_d.dims();
+    const float *bias_ptr = bias ? bias + bia_d.offset0() : nullptr;
+
+    auto ker = [&](dim_t b) {
+        jit_small_matmul_call_params_t p;
+        p.src = src + batch_offset(src_d, dst_dims, b);
+        p.wei = wei + batch_offset(wei_d, dst_dims, b);
+        p.bias = bias_ptr;
+        p.dst = dst + batch_offset(dst_d, dst_dims, b);
+        (*kernel_)(&p);
+    };
+
+    // A single problem is too small to benefit from threading.
+    const dim_t batch = pd()->batch();
+    if (batch == 1)
+        ker(0);
+    else
+        parallel_nd(batch, ker);
+
+    return status::success;
+}
+
+template struct jit_small_matmul_t<avx512_core>;
+template struct jit_small_matmul_t<avx2>;
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
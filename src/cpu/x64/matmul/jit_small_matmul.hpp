@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_X64_MATMUL_JIT_SMALL_MATMUL_HPP
+#define CPU_X64_MATMUL_JIT_SMALL_MATMUL_HPP
+
+#include <memory>
+
+#include "common/c_types_map.hpp"
+#include "common/kernel_cache.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+#include "cpu/matmul/cpu_matmul_pd.hpp"
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu/x64/jit_generator.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+namespace x64 {
+namespace matmul {
+
+// Problem parameters a small matmul kernel is specialized for. Every field is
+// baked into the generated code, so kernels are shared between primitives
+// only when all of them match.
+struct jit_small_matmul_conf_t {
+    dim_t M, N, K;
+    dim_t lda, ldb, ldc;
+    bool with_bias;
+};
+
+struct jit_small_matmul_call_params_t {
+    const float *src, *wei, *bias;
+    float *dst;
+};
+
+// An f32 matmul for tiny shapes (M, N, K <= max_dim). Each (M, N, K) matrix
+// product is computed by a single call to a fully unrolled kernel that keeps
+// the whole dst block in vector registers. No scratchpad is used and a single
+// problem runs on the calling thread; batched problems are split over the
+// batch. Generated kernels are kept in the global kernel cache keyed by the
+// problem shape, so primitives of the same shape reuse one kernel.
+template <cpu_isa_t isa>
+struct jit_small_matmul_t : public primitive_t {
+    struct pd_t : public dnnl::impl::cpu::matmul::cpu_matmul_pd_t {
+        using cpu_matmul_pd_t::cpu_matmul_pd_t;
+
+        DECLARE_COMMON_PD_T(JIT_IMPL_NAME_HELPER("jit_small:", isa, ""),
+                jit_small_matmul_t);
+
+        status_t init(engine_t *engine);
+
+        const jit_small_matmul_conf_t &jcp() const { return jcp_; }
+
+    private:
+        bool formats_ok() const;
+
+        jit_small_matmul_conf_t jcp_ = utils::zero<jit_small_matmul_conf_t>();
+    };
+
+    static constexpr dim_t max_dim = 32;
+
+    jit_small_matmul_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t init(engine_t *engine) override;
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+
+    // Keeps the cached kernel alive for the lifetime of the primitive.
+    std::shared_ptr<kernel_cache::value_impl_t> kernel_value_;
+    const jit_generator *kernel_ = nullptr;
+};
+
+} // namespace matmul
+} // namespace x64
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
 #include <cassert>
 
 #include "common/c_types_map.hpp"
@@ -343,27 +344,46 @@ jit_uni_sparse_matmul_t::jit_uni_sparse_matmul_t(const pd_t *apd)
 jit_uni_sparse_matmul_t::~jit_uni_sparse_matmul_t() = default;
 
 status_t jit_uni_sparse_matmul_t::execute(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const bool is_coo = src_d.encoding() == sparse_encoding::coo;
+
     const auto *weights = CTX_IN_MEM(const float *, DNNL_ARG_WEIGHTS);
     const auto *src_values = CTX_IN_MEM(const float *, DNNL_ARG_SRC, 0);
-    const auto *src_indices = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
-    const auto *src_pointers = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    // For COO the 1st buffer holds row indices and the 2nd one holds column
+    // indices, for CSR these are column indices and row pointers.
+    const auto *src_buf1 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 1);
+    const auto *src_buf2 = CTX_IN_MEM(const int32_t *, DNNL_ARG_SRC, 2);
+    const auto *src_indices = is_coo ? src_buf2 : src_buf1;
 
     status_t status = status::success;
     auto dst = CTX_OUT_CLEAN_MEM(float *, DNNL_ARG_DST, status);
     CHECK(status);
 
-    const memory_desc_wrapper src_d(pd()->src_md());
-    const memory_desc_wrapper dst_d(pd()->dst_md());
-
     const dim_t M = dst_d.dims()[0];
     const dim_t N = dst_d.dims()[1];
+    const dim_t src_nnz = src_d.nnz();
 
     // TODO: Implement a load balancing mechanism that would distribute
     // rows between threads based on the number of non-zero elements in those
     // rows.
     parallel_nd(M, [&](dim_t m) {
-        const int row_begin = src_pointers[m];
-        const int row_end = src_pointers[m + 1];
+        int row_begin = 0, row_end = 0;
+        if (is_coo) {
+            // COO entries are sorted by rows, so every row is a contiguous
+            // range of entries.
+            const int32_t *rows = src_buf1;
+            const int32_t row = static_cast<int32_t>(m);
+            row_begin = static_cast<int>(
+                    std::lower_bound(rows, rows + src_nnz, row) - rows);
+            row_end = static_cast<int>(
+                    std::upper_bound(rows + row_begin, rows + src_nnz, row)
+                    - rows);
+        } else {
+            const int32_t *pointers = src_buf2;
+            row_begin = pointers[m];
+            row_end = pointers[m + 1];
+        }
         const int nnz = row_end - row_begin;
 
         sparse_matmul_kernel_t::call_params_t p;
@@ -53,8 +53,11 @@ struct jit_uni_sparse_matmul_t : public primitive_t {
             const bool ok
                     = utils::everyone_is(f32, src_type, wei_type, dst_type)
                     && src_d.is_sparse_desc() && !wei_d.is_sparse_desc()
-                    && utils::everyone_is(
-                            s32, src_d.metadata_type(0), src_d.metadata_type(1))
+                    && utils::one_of(src_d.encoding(), sparse_encoding::csr,
+                            sparse_encoding::coo)
+                    && src_d.metadata_type(0) == s32
+                    && IMPLICATION(src_d.encoding() == sparse_encoding::csr,
+                            src_d.metadata_type(1) == s32)
                     && !with_bias() && attr()->has_default_values()
                     && mayiuse(avx2) && set_default_formats() && formats_ok();
             return ok ? status::success : status::unimplemented;
@@ -107,15 +107,19 @@ template <typename src_t, typename weights_t, typename scratch_t,
         typename gemm_acc_t>
 void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::execute()
         const {
-    if (is_fused_layer_iter_brgemm_) {
-        parallel(max_nthr_, [this](const int ithr, const int nthr) {
-            this->kernel_fused_iter_layer(ithr, nthr);
-        });
-    } else {
-        parallel(max_nthr_, [this](const int ithr, const int nthr) {
-            this->kernel(ithr, nthr);
-        });
-    }
+    parallel(max_nthr_, [this](const int ithr, const int nthr) {
+        this->execute(ithr, nthr);
+    });
+}
+
+template <typename src_t, typename weights_t, typename scratch_t,
+        typename gemm_acc_t>
+void brgemm_dst_layer_iter_t<src_t, weights_t, scratch_t, gemm_acc_t>::execute(
+        const int ithr, const int nthr) const {
+    if (is_fused_layer_iter_brgemm_)
+        kernel_fused_iter_layer(ithr, nthr);
+    else
+        kernel(ithr, nthr);
 }
 
 template <typename src_t, typename weights_t, typename scratch_t,
@@ -42,6 +42,9 @@ public:
             x64::brgemm_batch_element_t *addr_batch_global,
             const postgemm_fused_t &fused_postgemm);
     void execute() const;
+    // Computes the part of the work of thread ithr out of nthr, for calls
+    // from an already running parallel region.
+    void execute(const int ithr, const int nthr) const;
 
 private:
     void kernel(const int ithr, const int nthr) const;
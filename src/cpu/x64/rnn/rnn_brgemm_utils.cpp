@@ -17,6 +17,7 @@
 #include <utility>
 #include "common/dnnl_thread.hpp"
 #include "cpu/rnn/rnn_utils.hpp"
+#include "cpu/x64/cpu_barrier.hpp"
 #include "cpu/x64/rnn/rnn_brgemm_utils.hpp"
 
 namespace dnnl {
@@ -316,6 +317,9 @@ void rnn_brgemm_base_t::init_scratchpad(const cpu::rnn_utils::rnn_conf_t &rnn,
             * (rnn.brgemm_fwd_iter_layer_fuse_possible ? 2 : 1);
     scratchpad.template book<x64::brgemm_batch_element_t>(
             key_brgemm_primitive_batch, max_K_Block * rnn.nthr);
+
+    if (rnn.brgemm_fwd_persistent)
+        scratchpad.template book<simple_barrier::ctx_t>(key_rnn_bctx, 1);
 }
 
 status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
@@ -525,6 +529,25 @@ status_t rnn_brgemm_t<prop_kind::forward>::configure_brgemm(
                 ? brgemm_rnn_execute_loop_order_t::mblk_nblk
                 : brgemm_rnn_execute_loop_order_t::nblk_mblk;
     }
+
+    // Small batch inference is bound by reading the weights at every
+    // iteration. Keeping the cells of a layer in one parallel region with a
+    // static split of the gates lets every thread reuse its weights slice
+    // from L2. The post-gemm has to be fused so that each thread produces the
+    // part of the hidden state that matches its slice.
+    const dim_t persistent_mb_max_threshold = 8;
+    const dim_t nb_per_thr = utils::div_up(rnn.N_blocks, rnn.nthr);
+    const dim_t wei_slice_size = src_layer_type_size * nb_per_thr
+            * rnn.n_block * rnn.n_gates
+            * ((rnn.merge_gemm_layer ? 0 : rnn.K1padded) + rnn.K2padded);
+    rnn.brgemm_fwd_persistent = dnnl_thr_syncable() && !rnn.is_training
+            && utils::one_of(
+                    cell_kind, alg_kind::vanilla_rnn, alg_kind::vanilla_lstm)
+            && !rnn.is_lstm_projection && !rnn.unfused_post_gemm
+            && rnn.M_blocks == 1 && rnn.mb <= persistent_mb_max_threshold
+            && rnn.n_iter > 1 && rnn.nthr > 1
+            && wei_slice_size <= l2_cache_size / 2;
+
     return status::success;
 }
 
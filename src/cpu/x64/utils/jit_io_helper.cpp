@@ -17,6 +17,10 @@
 #include <cassert>
 #include <type_traits>
 
+#include "common/utils.hpp"
+
+#include "cpu/platform.hpp"
+
 #include "cpu/x64/jit_avx512_core_bf16cvt.hpp"
 #include "cpu/x64/utils/jit_io_helper.hpp"
 
@@ -26,6 +30,17 @@ namespace cpu {
 namespace x64 {
 namespace io {
 
+bool nt_stores_beneficial(size_t data_size) {
+    // 0 disables non-temporal stores, any other value enables them regardless
+    // of the data size.
+    static const int nt_stores = getenv_int_user("JIT_NT_STORES", -1);
+    if (nt_stores >= 0) return nt_stores != 0;
+
+    const size_t llc_size = static_cast<size_t>(platform::get_num_cores())
+            * platform::get_per_core_cache_size(3);
+    return llc_size > 0 && data_size > 2 * llc_size;
+}
+
 io_conf_t::io_conf_t(const bool nt_stores_enabled)
     : nt_stores_enabled_(nt_stores_enabled) {}
 
@@ -654,8 +669,6 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
         const Xbyak::Address &dst_raw_addr, const bool tail) {
     assert(IMPLICATION(tail, tail_conf_.has_value())
             && "Config for tail processing is not set.");
-    assert(!(tail && io_conf_.nt_stores_enabled_)
-            && "Usage of non-temporal stores with tail leads to a general-protection exception.");
 
     const bool is_avx512 = is_superset(isa_, avx512_core);
 
@@ -685,10 +698,10 @@ void jit_io_helper_t<Vmm>::store(const Vmm &src_raw_vmm,
         switch (data_type_) {
             case data_type::f32:
             case data_type::s32: store_f32(src_vmm, dst_addr, tail); break;
-            case data_type::bf16: store_bf16(src_vmm, dst_addr); break;
-            case data_type::f16: store_f16(src_vmm, dst_addr); break;
+            case data_type::bf16: store_bf16(src_vmm, dst_addr, tail); break;
+            case data_type::f16: store_f16(src_vmm, dst_addr, tail); break;
             case data_type::s8:
-            case data_type::u8: store_i8(src_vmm, dst_raw_addr); break;
+            case data_type::u8: store_i8(src_vmm, dst_raw_addr, tail); break;
             default: assert(!"Unsupported data type.");
         }
     }
@@ -725,7 +738,9 @@ void jit_io_helper_t<Vmm>::store_byte_by_byte(const Vmm &src_vmm,
 template <typename Vmm>
 void jit_io_helper_t<Vmm>::store_f32(
         const Vmm &src_vmm, const Xbyak::Address &dst_addr, const bool tail) {
-    if (io_conf_.nt_stores_enabled_)
+    // Non-temporal stores of a masked vector lead to a general-protection
+    // exception, so tails are stored with regular stores.
+    if (io_conf_.nt_stores_enabled_ && !tail)
         host_->uni_vmovntps(dst_addr, src_vmm);
     else if (!is_superset(isa_, avx512_core) && tail)
         host_->vmaskmovps(
@@ -735,8 +750,8 @@ void jit_io_helper_t<Vmm>::store_f32(
 }
 
 template <typename Vmm>
-void jit_io_helper_t<Vmm>::store_bf16(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+void jit_io_helper_t<Vmm>::store_bf16(const Vmm &src_vmm,
+        const Xbyak::Address &dst_addr, const bool tail) {
     assert(bf16_supported_ && "Unsupported data type.");
     assert((src_vmm.isZMM() || src_vmm.isYMM())
             && "Store operation for bf16 is not supported for Xmms.");
@@ -751,15 +766,15 @@ void jit_io_helper_t<Vmm>::store_bf16(
                 mayiuse(avx512_core) ? Xbyak::EvexEncoding
                                      : Xbyak::VexEncoding);
 
-    if (io_conf_.nt_stores_enabled_)
+    if (io_conf_.nt_stores_enabled_ && !tail)
         host_->uni_vmovntps(dst_addr, cvt_lower_vmm);
     else
         host_->uni_vmovdqu16(dst_addr, cvt_lower_vmm);
 }
 
 template <typename Vmm>
-void jit_io_helper_t<Vmm>::store_f16(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+void jit_io_helper_t<Vmm>::store_f16(const Vmm &src_vmm,
+        const Xbyak::Address &dst_addr, const bool tail) {
     assert(f16_supported_ && "Unsupported data type.");
     assert((src_vmm.isZMM() || src_vmm.isYMM())
             && "Store operation for f16 is not supported for Xmms.");
@@ -769,15 +784,15 @@ void jit_io_helper_t<Vmm>::store_f16(
 
     host_->uni_vcvtps2phx(cvt_lower_vmm, src_vmm);
 
-    if (io_conf_.nt_stores_enabled_)
+    if (io_conf_.nt_stores_enabled_ && !tail)
         host_->uni_vmovntps(dst_addr, cvt_lower_vmm);
     else
         host_->uni_vmovdqu16(dst_addr, cvt_lower_vmm);
 }
 
 template <typename Vmm>
-void jit_io_helper_t<Vmm>::store_i8(
-        const Vmm &src_vmm, const Xbyak::Address &dst_addr) {
+void jit_io_helper_t<Vmm>::store_i8(const Vmm &src_vmm,
+        const Xbyak::Address &dst_addr, const bool tail) {
     if (!is_superset(isa_, avx512_core)) {
         static constexpr bool is_ymm = std::is_same<Vmm, Xbyak::Ymm>::value;
 
@@ -794,7 +809,7 @@ void jit_io_helper_t<Vmm>::store_i8(
                 ? std::bind(&jit_generator::vpmovsdb, host_, _1, _2)
                 : std::bind(&jit_generator::vpmovusdb, host_, _1, _2);
 
-        if (io_conf_.nt_stores_enabled_ && is_zmm) {
+        if (io_conf_.nt_stores_enabled_ && !tail && is_zmm) {
             Xbyak::Xmm src_xmm(src_vmm.getIdx());
             store_i8_fn(src_xmm, src_vmm);
             host_->uni_vmovntps(dst_addr, src_xmm);
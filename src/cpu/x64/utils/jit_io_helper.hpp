@@ -35,6 +35,12 @@ struct bf16_emulation_t;
 
 namespace io {
 
+// Returns true if non-temporal stores are expected to pay off for a primitive
+// moving `data_size` bytes, i.e. when the data does not fit in the last level
+// cache and regular stores would only evict the lines needed next. The
+// decision can be forced with the ONEDNN_JIT_NT_STORES environment variable.
+bool nt_stores_beneficial(size_t data_size);
+
 class io_conf_t {
 public:
     io_conf_t() = default;
@@ -43,6 +49,9 @@ public:
 
     io_conf_t &operator=(const io_conf_t &other) = default;
 
+    // Full vectors are stored with non-temporal stores, which requires the
+    // destination addresses to be aligned to the size of the stored vector.
+    // Tails are always stored with regular stores.
     bool nt_stores_enabled_ = false;
 };
 
@@ -196,9 +205,12 @@ private:
             const int store_size);
     void store_f32(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
             const bool tail);
-    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
-    void store_i8(const Vmm &src_vmm, const Xbyak::Address &dst_addr);
+    void store_bf16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool tail);
+    void store_f16(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool tail);
+    void store_i8(const Vmm &src_vmm, const Xbyak::Address &dst_addr,
+            const bool tail);
     void convert_to_f32(const Vmm &dst_vmm, const Xbyak::Xmm &src_vmm,
             const data_type_t src_data_type);
 
@@ -43,6 +43,7 @@ struct miopen_binary_t : public primitive_t {
             using namespace data_type;
 
             bool ok = (set_default_params() == status::success)
+                    && !is_select()
                     && check_data_types() && check_no_blocking()
                     && check_broadcast()
                     && attr()->has_default_values(
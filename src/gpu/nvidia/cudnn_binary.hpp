@@ -44,6 +44,7 @@ struct cudnn_binary_t : public primitive_t {
             using namespace data_type;
 
             bool ok = (set_default_params() == status::success)
+                    && !is_select()
                     && check_data_types(engine) && check_no_blocking()
                     && check_broadcast()
                     && attr()->has_default_values(
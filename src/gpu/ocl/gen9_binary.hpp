@@ -48,7 +48,7 @@ struct gen9_binary_t : public gpu_primitive_t {
                     = utils::downcast<compute::compute_engine_t *>(engine);
 
             const auto attr_skip_mask = sm::post_ops | sm::scales_runtime;
-            bool ok = set_default_params() == status::success
+            bool ok = set_default_params() == status::success && !is_select()
                     && !memory_desc_ndims_ok(src_md(0), src_md(1), dst_md())
                     && ((utils::everyone_is(bf16, src_md(0)->data_type,
                                  src_md(1)->data_type)
@@ -45,7 +45,7 @@ struct ref_binary_t : public gpu_primitive_t {
 
             const auto attr_skip_mask = sm::post_ops | sm::scales_runtime;
 
-            bool ok = set_default_params() == status::success
+            bool ok = set_default_params() == status::success && !is_select()
                     && ((utils::everyone_is(bf16, src_md(0)->data_type,
                                  src_md(1)->data_type)
                                 && utils::one_of(
@@ -56,8 +56,8 @@ struct vectorized_lnorm_fwd_t : public gpu_primitive_t {
                                     compute::device_ext_t::khr_fp16))
                     && !memory_desc_ndims_ok(src_md(), dst_md(), stat_md())
                     && stat_md()->data_type == f32
-                    && check_scale_shift_data_type()
-                    && attr()->has_default_values()
+                    && check_scale_shift_data_type() && !skip_mean()
+                    && !fuse_residual_add() && attr()->has_default_values()
                     && set_default_formats_common();
             if (!ok) return status::unimplemented;
 
@@ -122,7 +122,7 @@ struct vectorized_lnorm_bwd_t : public gpu_primitive_t {
                             compute_engine->mayiuse(
                                     compute::device_ext_t::khr_fp16))
                     && stat_md()->data_type == f32
-                    && check_scale_shift_data_type()
+                    && check_scale_shift_data_type() && !skip_mean()
                     && attr()->has_default_values()
                     && set_default_formats_common();
             if (!ok) return status::unimplemented;
@@ -1211,6 +1211,9 @@ inline bool post_ops_with_binary_ok(const primitive_attr_t *attr,
                 && (is_eltwise(po_idx) || is_sum(po_idx) || is_binary(po_idx)
                         || is_prelu(po_idx));
         if (is_binary(po_idx)) {
+            // Ternary binary post-ops are not supported.
+            if (p.entry_[po_idx].binary.alg == alg_kind::binary_select)
+                return false;
             const auto &bin_desc = p.entry_[po_idx].binary.src1_desc;
             if (bin_desc.ndims > max_ndims_supported) {
                 // accept descriptor if unsupported dims are equal to 1.
@@ -48,6 +48,7 @@ struct ref_binary_t : public sycl_gpu_primitive_t {
             const memory_desc_wrapper dst_d(dst_md());
 
             const bool ok = set_default_params() == status::success
+                    && !is_select()
                     && check_data_types(src0_d, src1_d, dst_d)
                     && check_formats(src0_d, src1_d, dst_d) && is_tensor_op()
                     && attr()->has_default_values(
@@ -881,6 +881,8 @@ DNNL_GRAPH_OP_SCHEMA(dnnl_concat, 1,
                 .set_attr(op_attr::axis, true, attribute_kind::i)
                 // New added attributes
                 .SET_ATTR_IS_CONSTANT // used for constant prop and cache
+                // indices of the inputs which are views of the output
+                .set_attr(op_attr::srcs_in_dst, false, attribute_kind::is)
                 // Analysis rules
                 .set_shape_inference_function(infer_concat_output_shape)
                 .SET_LAYOUT_PROPAGATOR(layout_propagator_for_concat)
@@ -61,6 +61,7 @@ const op_attr_t p = 0x10300;
 const op_attr_t dst_zps = 0x10400;
 const op_attr_t src_zps = 0x10401;
 const op_attr_t permutation = 0x10402;
+const op_attr_t srcs_in_dst = 0x10403;
 
 static inline std::string internal_attr2str(op_attr_t attr) {
 #define CASE(a) \
@@ -90,6 +91,7 @@ static inline std::string internal_attr2str(op_attr_t attr) {
         CASE(dst_zps);
         CASE(src_zps);
         CASE(permutation);
+        CASE(srcs_in_dst);
         default: return "undefined_attr";
     }
 #undef CASE
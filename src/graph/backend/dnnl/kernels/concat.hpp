@@ -88,6 +88,7 @@ public:
 
         pipeline.reset_visualize_arg(true, false);
         BACKEND_DNNL_ADD_PASS(pipeline, layout_propagation);
+        BACKEND_DNNL_ADD_PASS(pipeline, inplace_concat_inputs);
 
         auto memory_plan = [&](std::shared_ptr<subgraph_t> &sg) {
             return memory_planner_.run(sg);
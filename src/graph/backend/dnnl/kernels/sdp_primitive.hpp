@@ -0,0 +1,298 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef GRAPH_BACKEND_DNNL_KERNELS_SDP_PRIMITIVE_HPP
+#define GRAPH_BACKEND_DNNL_KERNELS_SDP_PRIMITIVE_HPP
+
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "common/primitive_iface.hpp"
+#include "common/sdpa_utils.hpp"
+
+#include "graph/interface/backend.hpp"
+#include "graph/interface/graph.hpp"
+
+#include "graph/backend/dnnl/common.hpp"
+#include "graph/backend/dnnl/dnnl_partition_impl.hpp"
+#include "graph/backend/dnnl/kernels/large_partition.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace graph {
+namespace dnnl_impl {
+
+// Executes a floating-point scaled dot-product attention partition with the
+// fused sdpa primitive, so that the attention scores are never materialized
+// in memory. Partitions that the primitive cannot handle (non-CPU engines,
+// non-plain layouts, unsupported data types or shapes) are passed to the
+// generic large partition kernel.
+class sdp_primitive_kernel_t : public kernel_base_t {
+private:
+    // Partition input indices of the sdpa arguments.
+    size_t q_idx_ = 0, k_idx_ = 0, v_idx_ = 0, scale_idx_ = 0, mask_idx_ = 0;
+
+    dnnl::memory::desc q_md_, k_md_, v_md_, mask_md_, dst_md_, scale_md_;
+    dnnl::primitive sdpa_prim_;
+
+    std::shared_ptr<kernel_base_t> fallback_;
+
+    // Finds the partition input that corresponds to a given op input.
+    static bool find_input(const std::vector<logical_tensor_t> &inputs,
+            const op_t *op, size_t offset, size_t &idx) {
+        const auto id = op->get_input_value(offset)->get_logical_tensor().id;
+        for (size_t i = 0; i < inputs.size(); i++) {
+            if (inputs[i].id != id) continue;
+            if (!logical_tensor_wrapper_t(inputs[i]).is_strided()) return false;
+            idx = i;
+            return true;
+        }
+        return false;
+    }
+
+    static op_t *get_single_consumer(const op_t *op) {
+        const auto &consumers = op->get_output_value(0)->get_consumers();
+        return consumers.size() == 1 ? &consumers[0].get_op() : nullptr;
+    }
+
+    status_t init_sdpa(const dnnl_partition_impl_t *part,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) {
+        if (p_engine_.get_kind() != dnnl::engine::kind::cpu)
+            return status::unimplemented;
+        if (outputs.size() != 1) return status::unimplemented;
+
+        // Walk the partition starting from the softmax: mm_qk -> scale ->
+        // mask -> softmax -> mm_v -> transpose -> reshape or reorder.
+        op_t *softmax = nullptr;
+        for (const auto &op : part->get_ops())
+            if (op->get_kind() == graph::op_kind::SoftMax) softmax = op.get();
+        if (!softmax) return status::unimplemented;
+
+        op_t *add = softmax->get_input_value(0)->has_producer()
+                ? &softmax->get_input_value(0)->get_producer()
+                : nullptr;
+        op_t *scale = add && add->get_input_value(0)->has_producer()
+                ? &add->get_input_value(0)->get_producer()
+                : nullptr;
+        op_t *mm_qk = scale && scale->get_input_value(0)->has_producer()
+                ? &scale->get_input_value(0)->get_producer()
+                : nullptr;
+        op_t *mm_v = get_single_consumer(softmax);
+        op_t *transpose = mm_v ? get_single_consumer(mm_v) : nullptr;
+        op_t *post_transpose
+                = transpose ? get_single_consumer(transpose) : nullptr;
+        if (!mm_qk || !post_transpose) return status::unimplemented;
+
+        const auto get_bool_attr = [](const op_t *op, op_attr_t name) {
+            return op->has_attr(name) && op->get_attr<bool>(name);
+        };
+        if (get_bool_attr(mm_qk, op_attr::transpose_a)
+                || get_bool_attr(mm_v, op_attr::transpose_a)
+                || get_bool_attr(mm_v, op_attr::transpose_b))
+            return status::unimplemented;
+        const auto &p_in = mm_v->get_input_value(0);
+        if (!p_in->has_producer() || &p_in->get_producer() != softmax)
+            return status::unimplemented;
+
+        if (!find_input(inputs, mm_qk, 0, q_idx_)
+                || !find_input(inputs, mm_qk, 1, k_idx_)
+                || !find_input(inputs, mm_v, 1, v_idx_)
+                || !find_input(inputs, scale, 1, scale_idx_)
+                || !find_input(inputs, add, 1, mask_idx_))
+            return status::unimplemented;
+
+        const int ndims = logical_tensor_wrapper_t(inputs[q_idx_]).ndims();
+        if (ndims < 3) return status::unimplemented;
+        const int64_t axis = softmax->get_attr<int64_t>(op_attr::axis);
+        if (axis != -1 && axis != ndims - 1) return status::unimplemented;
+
+        // The scale must be a single value.
+        if (logical_tensor_wrapper_t(inputs[scale_idx_]).nelems() != 1)
+            return status::unimplemented;
+        scale_md_ = make_dnnl_memory_desc(inputs[scale_idx_]);
+
+        q_md_ = make_dnnl_memory_desc(inputs[q_idx_]);
+        k_md_ = make_dnnl_memory_desc(inputs[k_idx_]);
+        v_md_ = make_dnnl_memory_desc(inputs[v_idx_]);
+        mask_md_ = make_dnnl_memory_desc(inputs[mask_idx_]);
+        if (k_md_.get_ndims() != ndims || v_md_.get_ndims() != ndims
+                || mask_md_.get_ndims() > ndims)
+            return status::unimplemented;
+        if (get_bool_attr(mm_qk, op_attr::transpose_b)) {
+            std::vector<int> perm(ndims);
+            for (int i = 0; i < ndims; i++)
+                perm[i] = i;
+            std::swap(perm[ndims - 2], perm[ndims - 1]);
+            k_md_ = k_md_.permute_axes(perm);
+        }
+        mask_md_ = expand(mask_md_, ndims);
+
+        // The destination of the sdpa primitive is a view of the partition
+        // output in the [..., queries, values] order of the second matmul.
+        const auto &order = transpose->get_attr<std::vector<int64_t>>(
+                op_attr::order);
+        if ((int)order.size() != ndims) return status::unimplemented;
+        std::vector<int> perm(ndims);
+        for (int i = 0; i < ndims; i++)
+            perm[i] = (int)(order[i] < 0 ? order[i] + ndims : order[i]);
+
+        // The user may leave the output shape or layout undecided, in which
+        // case the inferred shape with a dense layout is reported back.
+        logical_tensor_t out_lt = outputs[0];
+        if (logical_tensor_wrapper_t(out_lt).is_shape_unknown()) {
+            const auto &inferred = post_transpose->get_output_value(0)
+                                           ->get_logical_tensor();
+            if (logical_tensor_wrapper_t(inferred).is_shape_unknown())
+                return status::unimplemented;
+            out_lt.ndims = inferred.ndims;
+            std::copy(inferred.dims, inferred.dims + inferred.ndims,
+                    out_lt.dims);
+        }
+        if (out_lt.layout_type == graph::layout_type::any
+                || (out_lt.layout_type == graph::layout_type::strided
+                        && logical_tensor_wrapper_t(out_lt)
+                                   .is_stride_unknown())) {
+            const auto out_dims = logical_tensor_wrapper_t(out_lt).vdims();
+            const auto strides = get_dense_strides(out_dims);
+            out_lt.layout_type = graph::layout_type::strided;
+            std::copy(strides.begin(), strides.end(), out_lt.layout.strides);
+        }
+        const logical_tensor_wrapper_t out_ltw(out_lt);
+        if (!out_ltw.is_strided()) return status::unimplemented;
+        dnnl::memory::dims v_dims = v_md_.get_dims();
+        dnnl::memory::dims o_dims = q_md_.get_dims();
+        o_dims[ndims - 1] = v_dims[ndims - 1];
+        dnnl::memory::dims t_dims(ndims);
+        for (int i = 0; i < ndims; i++)
+            t_dims[i] = o_dims[perm[i]];
+
+        dnnl::memory::desc t_md;
+        if (post_transpose->get_kind() == graph::op_kind::StaticReshape) {
+            // A reshape keeps the element order, so the output must be dense.
+            const auto out_dims = out_ltw.vdims();
+            const auto out_strides = out_ltw.vstrides();
+            dim_t stride = 1;
+            for (int i = out_ltw.ndims() - 1; i >= 0; i--) {
+                if (out_dims[i] != 1 && out_strides[i] != stride)
+                    return status::unimplemented;
+                stride *= out_dims[i];
+            }
+            dnnl::memory::dims t_strides(ndims);
+            stride = 1;
+            for (int i = ndims - 1; i >= 0; i--) {
+                t_strides[i] = stride;
+                stride *= t_dims[i];
+            }
+            t_md = dnnl::memory::desc(t_dims,
+                    static_cast<dnnl::memory::data_type>(
+                            out_ltw.data_type()),
+                    t_strides);
+        } else {
+            if (out_ltw.ndims() != ndims || out_ltw.vdims() != t_dims)
+                return status::unimplemented;
+            t_md = make_dnnl_memory_desc(out_lt);
+        }
+        dst_md_ = t_md.permute_axes(perm);
+
+        const bool invert_scale
+                = scale->get_kind() == graph::op_kind::Divide;
+        std::shared_ptr<primitive_desc_t> sdpa_pd;
+        engine_t *engine = p_engine_.get();
+        CHECK(create_sdpa_pd(sdpa_pd, engine, q_md_.get(), k_md_.get(),
+                v_md_.get(), dst_md_.get(), mask_md_.get(),
+                static_cast<data_type_t>(scale_md_.get_data_type()),
+                invert_scale, nullptr));
+
+        std::shared_ptr<primitive_t> prim;
+        CHECK(sdpa_pd->create_primitive(prim, engine));
+        primitive_iface_t *prim_iface = nullptr;
+        CHECK(safe_ptr_assign(prim_iface, new primitive_iface_t(prim, engine)));
+        const status_t st = prim_iface->init();
+        if (st != status::success) {
+            prim_iface->release();
+            return st;
+        }
+        sdpa_prim_ = dnnl::primitive(prim_iface);
+
+        const_cast<logical_tensor_t &>(outputs[0]) = out_lt;
+
+        return status::success;
+    }
+
+public:
+    status_t compile_impl(const dnnl_partition_impl_t *part,
+            const engine_t *g_engine,
+            const std::vector<logical_tensor_t> &inputs,
+            const std::vector<logical_tensor_t> &outputs) override {
+        p_engine_ = make_dnnl_engine(*g_engine);
+
+        if (init_sdpa(part, inputs, outputs) == status::success)
+            return status::success;
+
+        fallback_ = std::make_shared<larger_partition_kernel_t>();
+        return fallback_->compile(part, g_engine, inputs, outputs);
+    }
+
+    status_t prepare_inplace_pairs_impl() override {
+        if (fallback_) inplace_pairs_ = fallback_->inplace_pairs_;
+        return status::success;
+    }
+
+    status_t execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs) override {
+        if (fallback_) return fallback_->execute(g_stream, inputs, outputs);
+
+        dnnl::stream p_stream = make_dnnl_stream(p_engine_, *g_stream);
+
+        const auto mem = [&](const dnnl::memory::desc &md, const tensor_t &t) {
+            return make_dnnl_memory(md, p_engine_, t.get_data_handle());
+        };
+        std::unordered_map<int, dnnl::memory> args;
+        args[DNNL_ARG_QUERIES] = mem(q_md_, inputs[q_idx_]);
+        args[DNNL_ARG_KEYS] = mem(k_md_, inputs[k_idx_]);
+        args[DNNL_ARG_VALUES] = mem(v_md_, inputs[v_idx_]);
+        args[DNNL_ARG_SCALE] = mem(scale_md_, inputs[scale_idx_]);
+        args[DNNL_ARG_ATTN_MASK] = mem(mask_md_, inputs[mask_idx_]);
+        args[DNNL_ARG_DST] = mem(dst_md_, outputs[0]);
+
+        sdpa_prim_.execute(p_stream, args);
+        return status::success;
+    }
+
+#ifdef DNNL_WITH_SYCL
+    status_t sycl_execute_impl(const stream_t *g_stream,
+            const std::vector<tensor_t> &inputs,
+            const std::vector<tensor_t> &outputs,
+            const std::vector<::sycl::event> &sycl_deps,
+            ::sycl::event *sycl_event) override {
+        if (fallback_)
+            return fallback_->execute_sycl(
+                    g_stream, inputs, outputs, sycl_deps, sycl_event);
+        return status::unimplemented;
+    }
+#endif
+};
+
+} // namespace dnnl_impl
+} // namespace graph
+} // namespace impl
+} // namespace dnnl
+
+#endif
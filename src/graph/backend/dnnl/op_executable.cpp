@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <string>
@@ -1082,11 +1083,22 @@ concat_executable_t::desc_t concat_executable_t::create_desc(
     }
     prm_attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
 
+    // The inputs which are written in place into the output are views of it
+    // and keep their layout.
+    std::vector<int64_t> srcs_in_dst;
+    if (op->has_attr(op_attr::srcs_in_dst))
+        srcs_in_dst = op->get_attr<std::vector<int64_t>>(op_attr::srcs_in_dst);
+
     std::vector<memory::desc> src_mds;
     src_mds.reserve(op->num_inputs());
-    for (const auto &in_val : op->get_input_values()) {
-        const auto tmp_desc
-                = make_dnnl_memory_desc(in_val->get_logical_tensor());
+    for (size_t i = 0; i < op->num_inputs(); ++i) {
+        const auto tmp_desc = make_dnnl_memory_desc(
+                op->get_input_value(i)->get_logical_tensor());
+        if (std::count(srcs_in_dst.begin(), srcs_in_dst.end(),
+                    static_cast<int64_t>(i))) {
+            src_mds.emplace_back(tmp_desc);
+            continue;
+        }
         src_mds.emplace_back(
                 memory::desc {tmp_desc.get_dims(), tmp_desc.get_data_type(),
                         get_forced_format_tag(tmp_desc.get_dims())});
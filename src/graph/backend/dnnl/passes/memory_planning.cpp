@@ -390,6 +390,20 @@ status_t memory_planner_t::assign_external_outputs_buffer(
                             continue;
                         q.push(in_val.get());
                     }
+
+                    // push the concat inputs which are views of its output,
+                    // they are written into the same buffer
+                    if (producer.get_kind() == op_kind::dnnl_concat
+                            && producer.has_attr(op_attr::srcs_in_dst)) {
+                        const auto &srcs_in_dst
+                                = producer.get_attr<std::vector<int64_t>>(
+                                        op_attr::srcs_in_dst);
+                        for (auto idx : srcs_in_dst) {
+                            auto in_val = producer.get_input_value(
+                                    static_cast<size_t>(idx));
+                            q.push(in_val.get());
+                        }
+                    }
                 }
             }
         }
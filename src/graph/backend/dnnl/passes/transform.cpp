@@ -33,6 +33,7 @@
 #include "graph/interface/shape_infer.hpp"
 #include "graph/utils/utils.hpp"
 
+#include "graph/backend/dnnl/dnnl_backend.hpp"
 #include "graph/backend/dnnl/fusion_info.hpp"
 #include "graph/backend/dnnl/internal_attrs.hpp"
 #include "graph/backend/dnnl/op_executable.hpp"
@@ -3635,6 +3636,95 @@ impl::status_t fold_post_mul_scale_into_bn(std::shared_ptr<subgraph_t> &sg) {
     return infer_shape(sg);
 }
 
+status_t inplace_concat_inputs(std::shared_ptr<subgraph_t> &sg) {
+    auto &mgr = sg->fusion_info_mgr_;
+    auto &p_engine = *(sg->p_engine_);
+    auto &pd_cache = sg->pd_cache_;
+
+    const auto is_subgraph_output = [&sg](const value_ptr &val) {
+        const size_t id = val->get_logical_tensor().id;
+        return std::any_of(sg->outs_.begin(), sg->outs_.end(),
+                [id](const logical_tensor_t &lt) { return lt.id == id; });
+    };
+
+    for (auto cur_op : sg->get_ops()) {
+        if (cur_op->get_kind() != op_kind::dnnl_concat) continue;
+
+        // The views point to the user buffer of the concat output, whose
+        // layout must be the one the concat primitive is created with.
+        auto dst_val = cur_op->get_output_value(0);
+        if (!is_subgraph_output(dst_val)) continue;
+        const auto dst_md
+                = make_dnnl_memory_desc(dst_val->get_logical_tensor());
+        const auto concat_pd = concat_executable_t::create_desc(
+                cur_op, p_engine, mgr, pd_cache);
+        if (!is_plain(dst_md) || concat_pd.dst_desc() != dst_md) continue;
+
+        std::vector<int64_t> srcs_in_dst;
+        std::vector<std::pair<value_ptr, logical_tensor_t>> orig_lts;
+        for (size_t i = 0; i < cur_op->num_inputs(); ++i) {
+            auto in_val = cur_op->get_input_value(i);
+            if (!in_val->has_producer() || in_val->get_consumers().size() != 1
+                    || is_subgraph_output(in_val))
+                continue;
+
+            auto reorder_op = in_val->get_producer().shared_from_this();
+            if (reorder_op->get_kind() != op_kind::dnnl_reorder
+                    || (reorder_op->has_attr(op_attr::is_constant)
+                            && reorder_op->get_attr<bool>(
+                                    op_attr::is_constant)))
+                continue;
+
+            const auto view_md = concat_pd.src_view_desc(static_cast<int>(i));
+            const auto in_lt = in_val->get_logical_tensor();
+            if (view_md.get_data_type()
+                    != make_dnnl_memory_desc(in_lt).get_data_type())
+                continue;
+
+            const memory::desc scratchpad_desc
+                    = reorder_executable_t::create_desc(
+                            reorder_op, p_engine, mgr, pd_cache)
+                              .scratchpad_desc();
+
+            // Strided layout can't describe the offset of the view in the
+            // concat output, so opaque layout is used.
+            const auto layout_id
+                    = dnnl_backend::get_singleton().set_mem_desc(view_md);
+            in_val->set_layout_id(layout_id.value());
+            pd_cache.erase(reorder_op.get());
+            const auto &pd = reorder_executable_t::create_desc(
+                    reorder_op, p_engine, mgr, pd_cache);
+            if (pd.scratchpad_desc() != scratchpad_desc) {
+                in_val->set_logical_tensor(in_lt);
+                pd_cache.erase(reorder_op.get());
+                continue;
+            }
+
+            srcs_in_dst.emplace_back(static_cast<int64_t>(i));
+            orig_lts.emplace_back(in_val, in_lt);
+        }
+        if (srcs_in_dst.empty()) continue;
+
+        cur_op->set_attr<std::vector<int64_t>>(
+                op_attr::srcs_in_dst, srcs_in_dst);
+        pd_cache.erase(cur_op.get());
+        const auto &pd = concat_executable_t::create_desc(
+                cur_op, p_engine, mgr, pd_cache);
+        if (pd.scratchpad_desc() == concat_pd.scratchpad_desc()) continue;
+
+        // Restore the original layouts since the scratchpad of the concat has
+        // been already allocated.
+        for (auto &val_lt : orig_lts) {
+            val_lt.first->set_logical_tensor(val_lt.second);
+            pd_cache.erase(&val_lt.first->get_producer());
+        }
+        cur_op->set_attr<std::vector<int64_t>>(op_attr::srcs_in_dst, {});
+        pd_cache.erase(cur_op.get());
+    }
+
+    return status::success;
+}
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
@@ -249,6 +249,17 @@ impl::status_t fold_pre_mul_scale_into_bn(std::shared_ptr<subgraph_t> &sg);
 ///  ==> dst = (new_gamma * (src - mean) / sqrt(variance + epsilon)) + new_beta
 impl::status_t fold_post_mul_scale_into_bn(std::shared_ptr<subgraph_t> &sg);
 
+/// This pass will let the reorders producing the inputs of a concat write
+/// their results directly into the concat output, so that the concat doesn't
+/// need to copy those inputs. It's applied only when the concat output is a
+/// partition output with plain layout.
+///
+///   reorder  reorder           reorder  reorder
+///        \    /        -->          \    /  (views of the concat output)
+///        concat                     concat  (no-op for those inputs)
+///          |                          |
+status_t inplace_concat_inputs(std::shared_ptr<subgraph_t> &sg);
+
 } // namespace dnnl_impl
 } // namespace graph
 } // namespace impl
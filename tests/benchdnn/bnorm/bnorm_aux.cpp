@@ -70,6 +70,8 @@ std::string flags2str(flags_t flags) {
     if (flags & USE_SHIFT) str += "H";
     if (flags & FUSE_NORM_RELU) str += "R";
     if (flags & FUSE_NORM_ADD_RELU) str += "A";
+    if (flags & RMS_NORM) str += "M";
+    if (flags & FUSE_RESIDUAL_ADD) str += "S";
     return str;
 }
 
@@ -48,12 +48,14 @@ void check_correctness(
     for_(const auto &i_tag : s.tag)
     for_(const auto &i_stat_tag : s.stat_tag)
     for_(const auto &i_flags : s.flags)
+    for_(const auto &i_post_ops : s.post_ops)
     for_(const auto &i_scales : s.scales)
     for_(const auto &i_scratchpad_mode : s.scratchpad_mode)
     for_(const auto &i_ctx_init : s.ctx_init)
     for_(const auto &i_ctx_exe : s.ctx_exe)
     for (auto i_inplace : s.inplace) {
-        auto attr = settings_t::get_attr(i_scales, i_scratchpad_mode);
+        auto attr = settings_t::get_attr(
+                i_post_ops, i_scales, i_scratchpad_mode);
 
         const prb_t prb(s.prb_dims, i_tag, i_stat_tag, i_dir, i_dt, i_flags,
                 attr, i_ctx_init, i_ctx_exe, i_inplace, s.check_alg);
@@ -91,7 +93,8 @@ int verify_input(const settings_t &s) {
 static const std::string help_flags
         = "FLAGS    (Default: not specified)\n    Specifies normalization "
           "flags. `FLAGS` values are:\n    * `G` for global_stats.\n    * `C` "
-          "for scale.\n    * `H` for shift.\n";
+          "for scale.\n    * `H` for shift.\n    * `M` for RMS normalization."
+          "\n    * `S` for residual add fusion.\n";
 
 int bench(int argc, char **argv) {
     driver_name = "lnorm";
@@ -109,6 +112,7 @@ int bench(int argc, char **argv) {
                 || parse_vector_option(s.flags, def.flags, str2flags, argv[0],
                         "flags", help_flags)
                 || parse_inplace(s.inplace, def.inplace, argv[0])
+                || parse_attr_post_ops(s.post_ops, argv[0])
                 || parse_attr_scales(s.scales, argv[0])
                 || parse_attr_scratchpad_mode(
                         s.scratchpad_mode, def.scratchpad_mode, argv[0])
@@ -30,6 +30,7 @@
 #include "dnnl_common.hpp"
 #include "dnnl_memory.hpp"
 
+#include "binary/binary.hpp"
 #include "bnorm/bnorm.hpp"
 #include "lnorm/lnorm.hpp"
 
@@ -76,9 +77,14 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
     const int64_t min_flex_bits = 3;
     const int64_t want_flex_bits = MIN2(6, exact_bits / 2);
 
+    // RMS normalization has no mean, sums of squares are exact for ALG_0
+    // only, which keeps src values around zero.
     check_alg_t alg = prb->check_alg;
     if (alg == ALG_AUTO) /* choose appropriate checking algorithm */
-        alg = (exact_bits - logL) / 2 - 1 >= min_flex_bits ? ALG_1 : ALG_0;
+        alg = !prb->skip_mean()
+                        && (exact_bits - logL) / 2 - 1 >= min_flex_bits
+                ? ALG_1
+                : ALG_0;
 
     const int64_t flex_bits = alg == ALG_0
             ? want_flex_bits
@@ -104,6 +110,7 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
 
         benchdnn_parallel_nd(prb->n, [&](int64_t n) {
             const float m = alg == ALG_0 ? 0.f : 0.25f * (1 << (n % 7));
+            const float sm = prb->skip_mean() ? 0.f : m; /* stat mean */
             float v = 0; /* current variance */
 
             float *s = (float *)src + n * prb->c;
@@ -121,9 +128,9 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
 
                 src.set_elem(n * prb->c + c, alg == ALG_0 ? f : m * (1.f + f));
                 if (L % 2 && (c == L - 1)) { s[c] = m; }
-                v += (s[c] - m) * (s[c] - m);
+                v += (s[c] - sm) * (s[c] - sm);
             }
-            mean.set_elem(n, m);
+            mean.set_elem(n, sm);
             var.set_elem(n, v / prb->c);
         });
     } else {
@@ -144,6 +151,7 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
             std::uniform_int_distribution<> int_dist(0 + distr_shift, 6);
             std::bernoulli_distribution b_dist(0.5f);
             const float m = val_coeff * 0.25f * (1 << int_dist(int_seed));
+            const float sm = prb->skip_mean() ? 0.f : m; /* stat mean */
             float v = 0; /* current variance */
 
             const int64_t c_shift = n * prb->c;
@@ -165,14 +173,15 @@ static int prepare_fwd(const prb_t *prb, const dnn_mem_t &src,
                 }
                 src.set_elem(idx, val);
 
-                v += (s[c] - m) * (s[c] - m);
+                v += (s[c] - sm) * (s[c] - sm);
             }
             // Update last element with s[c] = m.
             if (prb->c % 2 == 1) {
-                v -= (s[prb->c - 1] - m) * (s[prb->c - 1] - m);
+                v -= (s[prb->c - 1] - sm) * (s[prb->c - 1] - sm);
                 s[prb->c - 1] = m;
+                v += (m - sm) * (m - sm);
             }
-            mean.set_elem(n, m);
+            mean.set_elem(n, sm);
             var.set_elem(n, v / prb->c);
         });
     }
@@ -201,6 +210,21 @@ int prepare_fwd(const prb_t *prb, dnn_mem_map_t &mem_map,
     SAFE(prepare_fwd(prb, ref_src, ref_mean, ref_var, ref_sc, ref_sh, res),
             WARN);
 
+    if (prb->fuse_add()) {
+        // The prepared values are the ones being normalized. Split them into
+        // source and residual so that the sum is exact in any data type.
+        const auto &ref_src_1 = ref_mem_map[DNNL_ARG_SRC_1];
+        benchdnn_parallel_nd(ref_src.nelems(), [&](int64_t i) {
+            const float s = ref_src.get_elem(i);
+            const float r = i % 3 == 0 ? 0.f : i % 3 == 1 ? s : -s;
+            ref_src_1.set_elem(i, r);
+            ref_src.set_elem(i, s - r);
+        });
+
+        auto &src_1 = mem_map[DNNL_ARG_SRC_1];
+        SAFE(src_1.reorder(ref_src_1), WARN);
+    }
+
     auto &src = mem_map[DNNL_ARG_SRC];
     SAFE(src.reorder(ref_src), WARN);
 
@@ -249,8 +273,9 @@ static int prepare_bwd(const prb_t *prb, const dnn_mem_t &src,
         std::uniform_int_distribution<> data_dist(0, 6);
         std::bernoulli_distribution half_dist(0.5f);
 
-        // mean = {-0.5f, 0.f, 0.5f}
-        const float m = 0.5f * (stat_dist(int_seed) - 1);
+        // mean = {-0.5f, 0.f, 0.5f}, always 0.f for RMS normalization
+        const float m_gen = 0.5f * (stat_dist(int_seed) - 1);
+        const float m = prb->skip_mean() ? 0.f : m_gen;
         mean.set_elem(n, m);
 
         // final variance = {0.25f, 1.f, 4.f}
@@ -320,8 +345,10 @@ dnnl_status_t init_pd(init_pd_args_t<prb_t> &init_pd_args) {
                 prb->ndims - 1, prb->dims.data(), dnnl_f32, prb->stat_tag);
     }
 
+    attr_args_t attr_args;
+    attr_args.prepare_post_ops_mds(prb->attr, prb->ndims, prb->dims.data());
     auto dnnl_attr = make_benchdnn_dnnl_wrapper(
-            create_dnnl_attr(prb->attr, attr_args_t()));
+            create_dnnl_attr(prb->attr, attr_args));
 
     auto flags = (dnnl_normalization_flags_t)prb->flags;
     if (prb->dir & FLAG_FWD) {
@@ -354,10 +381,16 @@ void skip_unimplemented_prb(const prb_t *prb, res_t *res) {
             prb->attr, res, dnnl_layer_normalization, prb->dt[0]);
     skip_unimplemented_prelu_po(prb->attr, res, dnnl_layer_normalization);
 
+    if (prb->attr.post_ops.find(attr_t::post_ops_t::kind_t::SUM) != -1) {
+        res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
+        return;
+    }
+
     if (is_gpu()) {
         const bool dt_ok = prb->dt[0] == prb->dt[1]
                 && !is_integral_dt(prb->dt[0]) && !is_integral_dt(prb->dt[1]);
-        if (!dt_ok) {
+        if (!dt_ok || prb->skip_mean() || prb->fuse_add()
+                || !prb->attr.post_ops.is_def()) {
             res->state = SKIPPED, res->reason = CASE_NOT_SUPPORTED;
             return;
         }
@@ -429,11 +462,13 @@ void setup_cmp(compare::compare_t &cmp, const prb_t *prb, data_kind_t kind,
 std::vector<int> supported_exec_args(dir_t dir) {
     static const std::vector<int> exec_fwd_args = {
             DNNL_ARG_SRC,
+            DNNL_ARG_SRC_1,
             DNNL_ARG_MEAN,
             DNNL_ARG_VARIANCE,
             DNNL_ARG_SCALE,
             DNNL_ARG_SHIFT,
             DNNL_ARG_DST,
+            DNNL_ARG_DST_1,
     };
     static const std::vector<int> exec_bwd_args = {
             DNNL_ARG_SRC,
@@ -485,6 +520,12 @@ int init_ref_memory_args(dnn_mem_map_t &ref_mem_map, dnn_mem_map_t &mem_map,
                     SAFE(fill_scales(prb->attr, exec_src_arg, mem, ref_mem),
                             WARN);
                 }
+                int post_ops_range = DNNL_ARG_ATTR_MULTIPLE_POST_OP(31)
+                        - DNNL_ARG_ATTR_MULTIPLE_POST_OP(0);
+                bool is_post_ops_arg = (exec_arg & post_ops_range);
+                if (is_post_ops_arg) {
+                    SAFE(binary::fill_mem(exec_arg, mem, ref_mem), WARN);
+                }
             } break;
         }
     }
@@ -506,7 +547,7 @@ std::vector<data_kind_t> get_kinds_to_check(const prb_t *prb) {
     if (prb->dir & FLAG_FWD) {
         check_kinds = {DST};
         if (!(prb->flags & GLOB_STATS) && !(prb->dir & FLAG_INF)) {
-            check_kinds.push_back(MEAN);
+            if (!prb->skip_mean()) check_kinds.push_back(MEAN);
             check_kinds.push_back(VAR);
         }
     } else {
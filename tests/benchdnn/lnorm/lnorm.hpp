@@ -41,6 +41,8 @@ const flags_t NONE = bnorm::NONE;
 const flags_t GLOB_STATS = bnorm::GLOB_STATS;
 const flags_t USE_SCALE = bnorm::USE_SCALE;
 const flags_t USE_SHIFT = bnorm::USE_SHIFT;
+const flags_t RMS_NORM = bnorm::RMS_NORM;
+const flags_t FUSE_RESIDUAL_ADD = bnorm::FUSE_RESIDUAL_ADD;
 const auto flags2str = bnorm::flags2str;
 flags_t str2flags(const char *str);
 
@@ -132,6 +134,8 @@ struct prb_t : public prb_dims_t {
     bool use_stats() const { return flags & GLOB_STATS; }
     bool use_sc() const { return flags & USE_SCALE; }
     bool use_sh() const { return flags & USE_SHIFT; }
+    bool skip_mean() const { return flags & RMS_NORM; }
+    bool fuse_add() const { return flags & FUSE_RESIDUAL_ADD; }
 
     // Used to construct memory desc when dimensions are runtime since such mds
     // can't be used directly from query and memory objects can't be constructed.
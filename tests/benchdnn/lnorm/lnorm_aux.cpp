@@ -31,6 +31,10 @@ flags_t str2flags(const char *str) {
             flags |= USE_SCALE;
         } else if (*str == 'H') {
             flags |= USE_SHIFT;
+        } else if (*str == 'M') {
+            flags |= RMS_NORM;
+        } else if (*str == 'S') {
+            flags |= FUSE_RESIDUAL_ADD;
         } else {
             BENCHDNN_PRINT(0, "%s \'%c\'\n",
                     "Error: --flags option doesn't support value", *str);
@@ -22,11 +22,13 @@ namespace lnorm {
 
 void compute_ref_fwd(const prb_t *prb, const args_t &args) {
     const dnn_mem_t &src = args.find(DNNL_ARG_SRC);
+    const dnn_mem_t &src_1 = args.find(DNNL_ARG_SRC_1);
     const dnn_mem_t &mean = args.find(DNNL_ARG_MEAN);
     const dnn_mem_t &var = args.find(DNNL_ARG_VARIANCE);
     const dnn_mem_t &sc = args.find(DNNL_ARG_SCALE);
     const dnn_mem_t &sh = args.find(DNNL_ARG_SHIFT);
     const dnn_mem_t &dst = args.find(DNNL_ARG_DST);
+    const dnn_mem_t &dst_1 = args.find(DNNL_ARG_DST_1);
     const dnn_mem_t &src_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC);
     const dnn_mem_t &dst_scale = args.find(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST);
 
@@ -42,19 +44,35 @@ void compute_ref_fwd(const prb_t *prb, const args_t &args) {
 
     const float src_scale_val = has_src_scale ? src_scale.get_elem(0) : 1.f;
     const float dst_scale_val = has_dst_scale ? dst_scale.get_elem(0) : 1.f;
-    const float output_scale = src_scale_val / dst_scale_val;
+    const float r_dst_scale_val = 1.0f / dst_scale_val;
+
+    // With the residual fusion the sum is the tensor being normalized.
+    const dnn_mem_t &norm_src = prb->fuse_add() ? dst_1 : src;
+
+    auto v_po_masks = prb->attr.post_ops.get_po_masks();
 
     benchdnn_parallel_nd(prb->n, [&](int64_t n) {
         float smean = mean.get_elem(n);
         float svar = var.get_elem(n);
         float sqrt_var = sqrtf(svar + prb->eps);
 
+        if (prb->fuse_add()) {
+            for (int64_t c = 0; c < prb->c; ++c) {
+                auto off = n * prb->c + c;
+                dst_1.set_elem(off, src.get_elem(off) + src_1.get_elem(off));
+            }
+        }
+
         for (int64_t c = 0; c < prb->c; ++c) {
             float gamma = (use_sc ? sc.get_elem(c) : 1.0f) / sqrt_var;
             float beta = use_sh ? sh.get_elem(c) : 0;
             auto off = n * prb->c + c;
-            float res = gamma * (src.get_elem(off) - smean) + beta;
-            dst_ptr[off] = res * output_scale;
+            float res = gamma * (norm_src.get_elem(off) - smean) + beta;
+
+            const auto v_po_vals = prepare_po_vals(dst, args, v_po_masks, off);
+            res *= src_scale_val;
+            maybe_post_ops(prb->attr, res, 0.f, v_po_vals);
+            dst_ptr[off] = res * r_dst_scale_val;
         }
     });
 }
@@ -114,7 +132,9 @@ void compute_ref_bwd(const prb_t *prb, const args_t &args) {
             float ds = d_dst.get_elem(off) * gamma;
             if (!(prb->flags & GLOB_STATS)) {
                 const float x = src.get_elem(off) - smean;
-                ds -= (dd_gamma + x * dd_gamma_x * rcp_denom) / prb->c;
+                // RMS normalization has no gradient through the mean.
+                const float dd_mean = prb->skip_mean() ? 0.f : dd_gamma;
+                ds -= (dd_mean + x * dd_gamma_x * rcp_denom) / prb->c;
             }
 
             d_src.set_elem(off, rcp_denom * ds);
@@ -14,8 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cmath>
 #include <functional>
 #include <random>
+#include <unordered_map>
 
 #include "gtest/gtest.h"
 
@@ -612,6 +614,113 @@ TEST(Execute, F32Mha) {
     }
 }
 
+TEST(Execute, F32MhaRandomData) {
+    graph::engine_t *eng = get_engine();
+    graph::stream_t *strm = get_stream();
+
+    // A sequence length which is not a multiple of the kernel blocking.
+    const int mb = 2, seq_len = 37, num_head = 2, head_dim = 64;
+    const int size_per_head = head_dim / num_head;
+
+    graph::graph_t g(eng->kind());
+    utils::construct_dnnl_float_MHA(
+            &g, graph::data_type::f32, mb, seq_len, num_head, head_dim);
+    g.finalize();
+
+    graph::pass::pass_base_ptr apass = get_pass("float_sdp_fusion");
+    apass->run(g);
+    ASSERT_EQ(g.get_num_partitions(), 1U);
+    auto part = g.get_partitions()[0];
+
+    graph::partition_t p;
+    p.init(part);
+
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    ASSERT_EQ(partition_inputs.size(), 5U);
+    ASSERT_EQ(partition_outputs.size(), 1U);
+
+    std::vector<const graph::logical_tensor_t *> inputs, outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.emplace_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        lt = utils::logical_tensor_init(
+                lt.id, lt.data_type, graph::layout_type::strided);
+        outputs.emplace_back(&lt);
+    }
+
+    graph::compiled_partition_t cp(p);
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, eng), graph::status::success);
+
+    using ltw = graph::logical_tensor_wrapper_t;
+
+    // Logical tensor ids assigned by construct_dnnl_float_MHA().
+    const size_t mask_id = 0, query_id = 1, key_id = 2, scale_id = 4,
+                 value_id = 8;
+
+    std::default_random_engine generator(7);
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::unordered_map<size_t, test::vector<float>> data;
+    std::vector<graph::tensor_t> inputs_ts, outputs_ts;
+    for (auto &lt : inputs) {
+        auto &buf = data[lt->id];
+        buf.resize(utils::product(ltw(lt).vdims()));
+        std::generate(buf.begin(), buf.end(),
+                [&]() { return distribution(generator); });
+        if (lt->id == scale_id) buf[0] = std::sqrt((float)size_per_head);
+        if (lt->id == mask_id)
+            for (size_t i = 0; i < buf.size(); i += 3)
+                buf[i] = -10000.f;
+        inputs_ts.emplace_back(*lt, eng, buf.data());
+    }
+
+    graph::logical_tensor_t compiled_output;
+    cp.query_logical_tensor(outputs[0]->id, &compiled_output);
+    test::vector<float> dst(utils::product(ltw(compiled_output).vdims()));
+    ASSERT_EQ(dst.size(), (size_t)mb * seq_len * head_dim);
+    outputs_ts.emplace_back(compiled_output, eng, dst.data());
+
+    ASSERT_EQ(cp.execute(strm, inputs_ts, outputs_ts), graph::status::success);
+    strm->wait();
+
+    // Reference: q, v are [mb, num_head, seq_len, size_per_head], k is
+    // [mb, num_head, size_per_head, seq_len], the mask is [mb, 1, 1, seq_len]
+    // and the output is [mb, seq_len, num_head * size_per_head].
+    const auto &q = data[query_id], &k = data[key_id], &v = data[value_id];
+    const auto &mask = data[mask_id];
+    const float scale = data[scale_id][0];
+    std::vector<float> scores(seq_len);
+    for (int n = 0; n < mb; n++)
+        for (int h = 0; h < num_head; h++)
+            for (int i = 0; i < seq_len; i++) {
+                const size_t qv_off = (size_t)(n * num_head + h) * seq_len;
+                const size_t k_off = ((size_t)n * num_head + h) * size_per_head;
+                float max = -INFINITY;
+                for (int j = 0; j < seq_len; j++) {
+                    float s = 0.f;
+                    for (int d = 0; d < size_per_head; d++)
+                        s += q[(qv_off + i) * size_per_head + d]
+                                * k[(k_off + d) * seq_len + j];
+                    scores[j] = s / scale + mask[n * seq_len + j];
+                    max = std::max(max, scores[j]);
+                }
+                float sum = 0.f;
+                for (int j = 0; j < seq_len; j++) {
+                    scores[j] = std::exp(scores[j] - max);
+                    sum += scores[j];
+                }
+                for (int d = 0; d < size_per_head; d++) {
+                    float acc = 0.f;
+                    for (int j = 0; j < seq_len; j++)
+                        acc += scores[j] * v[(qv_off + j) * size_per_head + d];
+                    const size_t dst_off = ((size_t)n * seq_len + i) * head_dim
+                            + h * size_per_head + d;
+                    ASSERT_NEAR(dst[dst_off], acc / sum, 1e-4);
+                }
+            }
+}
+
 namespace {
 union bit32_t {
     float f32;
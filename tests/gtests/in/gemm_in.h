@@ -95,7 +95,11 @@ CPU_INST_TEST_CASE(TestGEMV,
         test_params {'n', 't', 1, 3000, 2000, 1.0f, 1.0f, 2000, 2000, 3000},
         test_params {'t', 't', 2000, 1, 1000, 1.0f, 1.0f, 2000, 1000, 1},
         test_params {'t', 't', 200, 1, 8000, 1.0f, 1.0f, 200, 8000, 1},
-        test_params {'t', 't', 1, 3000, 4000, 1.0f, 1.0f, 1, 4000, 3000});
+        test_params {'t', 't', 1, 3000, 4000, 1.0f, 1.0f, 1, 4000, 3000},
+
+        // Few outputs and a long reduction, split between threads.
+        test_params {'n', 'n', 1, 40, 30000, 1.0f, 0.0f, 30000, 40, 40},
+        test_params {'t', 'n', 40, 1, 30000, 1.0f, 1.0f, 40, 1, 1});
 
 /**
  * These cases are used to test the small-N avx-512 sgemm TN kernels.
@@ -127,7 +131,7 @@ CPU_INST_TEST_CASE(TestGEMM_stkmem,
         test_params {'n', 'n', 2, 16, 251, 1.0f, 0.0f, 251, 16, 16},
         test_params {'n', 'n', 2, 16, 256, 1.0f, 0.0f, 256, 16, 16});
 
-#if defined(FP32) || defined(BF16BF16F32)
+#if defined(FP32) || defined(BF16BF16F32) || defined(F16F16F32)
 #if !BUILD_GEMM_KERNELS_NONE
 INST_TEST_CASE(TestGEMM_packed,
         test_params {'t', 'n', 3, 2, 1, 1.0, 0.0, 2, 5, 8, {}, {false, true},
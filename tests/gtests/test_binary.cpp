@@ -279,6 +279,62 @@ INSTANTIATE_TEST_SUITE_P(BinaryTensorDims, binary_attr_test_t,
                         memory::dims {1, 1024, 1, 1},
                         memory::format_tag::abcd)));
 
+class binary_select_test_t : public ::testing::Test {};
+
+HANDLE_EXCEPTIONS_FOR_TEST(binary_select_test_t, TestSelect) {
+    auto eng = get_test_engine();
+    SKIP_IF(eng.get_kind() != engine::kind::cpu,
+            "Binary select is supported only on CPU");
+    auto strm = make_stream(eng);
+
+    const memory::dims dims {2, 19, 3, 5};
+    const memory::desc src0_md {dims, data_type::f32, tag::nchw};
+    const memory::desc src1_md {dims, data_type::f32, tag::nchw};
+    const memory::desc cond_md {dims, data_type::s8, tag::nchw};
+    const memory::desc dst_md {dims, data_type::f32, tag::nchw};
+
+    // The condition is mandatory for the select algorithm.
+    EXPECT_ANY_THROW(binary::primitive_desc(
+            eng, algorithm::binary_select, src0_md, src1_md, dst_md));
+    // The condition is limited to s8.
+    EXPECT_ANY_THROW(binary::primitive_desc(eng, algorithm::binary_select,
+            src0_md, src1_md, src0_md, dst_md));
+
+    auto pd = binary::primitive_desc(
+            eng, algorithm::binary_select, src0_md, src1_md, cond_md, dst_md);
+    ASSERT_TRUE(pd.src2_desc() == cond_md);
+    ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_2) == cond_md);
+
+    auto mem_A = test::make_memory(pd.src0_desc(), eng);
+    auto mem_B = test::make_memory(pd.src1_desc(), eng);
+    auto mem_C = test::make_memory(pd.src2_desc(), eng);
+    auto mem_D = test::make_memory(pd.dst_desc(), eng);
+
+    const memory::dim nelems = 2 * 19 * 3 * 5;
+    {
+        auto a = map_memory<float>(mem_A);
+        auto b = map_memory<float>(mem_B);
+        auto c = map_memory<int8_t>(mem_C);
+        for (memory::dim i = 0; i < nelems; i++) {
+            a[i] = static_cast<float>(i);
+            b[i] = static_cast<float>(-i);
+            c[i] = static_cast<int8_t>(i % 3 == 0 ? 0 : i % 5);
+        }
+    }
+
+    binary(pd).execute(strm,
+            {{DNNL_ARG_SRC_0, mem_A}, {DNNL_ARG_SRC_1, mem_B},
+                    {DNNL_ARG_SRC_2, mem_C}, {DNNL_ARG_DST, mem_D}});
+    strm.wait();
+
+    auto c = map_memory<int8_t>(mem_C);
+    auto d = map_memory<float>(mem_D);
+    for (memory::dim i = 0; i < nelems; i++) {
+        const float expected = static_cast<float>(c[i] != 0 ? i : -i);
+        ASSERT_EQ(d[i], expected) << "at index " << i;
+    }
+}
+
 static auto expected_failures = []() {
     return ::testing::Values(
             // test tag::any support
@@ -444,4 +444,48 @@ GPU_INSTANTIATE_TEST_SUITE_P(TestConcat, concat_test_float, cases_concat_gpu());
 GPU_INSTANTIATE_TEST_SUITE_P(
         TestConcat, concat_test_float16, cases_concat_gpu());
 
+TEST(concat_view_test_t, TestSrcViewDesc) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+    const auto dt = memory::data_type::f32;
+
+    const int axis = 1;
+    const std::vector<memory::dims> srcs_dims = {{2, 8, 3, 4}, {2, 5, 3, 4}};
+    const memory::desc dst_md({2, 13, 3, 4}, dt, fmt::nchw);
+
+    std::vector<memory::desc> srcs_md;
+    std::vector<memory> srcs;
+    for (const auto &dims : srcs_dims) {
+        srcs_md.emplace_back(dims, dt, fmt::nchw);
+        srcs.emplace_back(srcs_md.back(), eng);
+        fill_data<float>(srcs_md.back().get_size() / sizeof(float),
+                srcs.back());
+    }
+
+    // Reference: the sources are copied by the concat.
+    auto ref_pd = concat::primitive_desc(eng, dst_md, axis, srcs_md);
+    ASSERT_EQ(ref_pd.get_axis(), axis);
+    memory ref_dst(ref_pd.dst_desc(), eng);
+    std::unordered_map<int, memory> ref_args = {{DNNL_ARG_DST, ref_dst}};
+    for (size_t i = 0; i < srcs.size(); i++)
+        ref_args.insert({DNNL_ARG_MULTIPLE_SRC + (int)i, srcs[i]});
+    concat(ref_pd).execute(strm, ref_args);
+
+    // The producers (reorders here) write directly into the destination.
+    memory dst(ref_pd.dst_desc(), eng);
+    std::vector<memory::desc> views_md;
+    std::unordered_map<int, memory> args = {{DNNL_ARG_DST, dst}};
+    for (size_t i = 0; i < srcs.size(); i++) {
+        views_md.emplace_back(ref_pd.src_view_desc((int)i));
+        memory view(views_md.back(), eng, dst.get_data_handle());
+        reorder(srcs[i], view).execute(strm, srcs[i], view);
+        args.insert({DNNL_ARG_MULTIPLE_SRC + (int)i, view});
+    }
+    auto pd = concat::primitive_desc(eng, dst_md, axis, views_md);
+    concat(pd).execute(strm, args);
+    strm.wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
 } // namespace dnnl
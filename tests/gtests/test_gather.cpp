@@ -0,0 +1,275 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct gather_test_params_t {
+    algorithm aalgorithm;
+    memory::dims src_dims;
+    memory::dim n_indices;
+    memory::dim n_bags;
+    // -1 stands for no scales.
+    int scales_mask;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class gather_test_t : public ::testing::TestWithParam<gather_test_params_t> {
+private:
+    gather_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<gather_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    bool with_bags() const { return p.aalgorithm != algorithm::gather_rows; }
+
+    void check(const memory &src, const memory &indices,
+            const memory &offsets, const memory &scales, const memory &dst) {
+        auto src_ptr = map_memory<data_t>(src);
+        auto idx_ptr = map_memory<int32_t>(indices);
+        auto dst_ptr = map_memory<float>(dst);
+
+        const memory::dim rows = p.src_dims[0];
+        const memory::dim row_size = p.src_dims[1];
+        const memory::dim dst_rows = with_bags() ? p.n_bags : p.n_indices;
+
+        std::vector<int32_t> off(dst_rows + 1);
+        if (with_bags()) {
+            auto off_ptr = map_memory<int32_t>(offsets);
+            for (memory::dim b = 0; b < dst_rows; b++)
+                off[b] = off_ptr[b];
+        } else {
+            for (memory::dim b = 0; b < dst_rows; b++)
+                off[b] = static_cast<int32_t>(b);
+        }
+        off[dst_rows] = static_cast<int32_t>(p.n_indices);
+
+        std::vector<float> sc(rows, 1.f);
+        if (p.scales_mask >= 0) {
+            auto sc_ptr = map_memory<float>(scales);
+            for (memory::dim r = 0; r < rows; r++)
+                sc[r] = sc_ptr[p.scales_mask == 0 ? 0 : r];
+        }
+
+        for (memory::dim b = 0; b < dst_rows; b++) {
+            for (memory::dim c = 0; c < row_size; c++) {
+                float exp = 0.f;
+                for (int32_t i = off[b]; i < off[b + 1]; i++) {
+                    const int32_t r = idx_ptr[i];
+                    exp += sc[r]
+                            * static_cast<float>(src_ptr[r * row_size + c]);
+                }
+                if (p.aalgorithm == algorithm::gather_bag_mean
+                        && off[b + 1] > off[b])
+                    exp /= static_cast<float>(off[b + 1] - off[b]);
+
+                const float got = dst_ptr[b * row_size + c];
+                ASSERT_NEAR(got, exp, 1e-5f * std::max(1.f, std::fabs(exp)));
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = gather::primitive_desc;
+        allows_attr_t allowed_attributes {false};
+        allowed_attributes.scales = true;
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const memory::dim dst_rows = with_bags() ? p.n_bags : p.n_indices;
+        auto desc_src = memory::desc(p.src_dims, data_dt,
+                p.src_dims.size() == 2 ? memory::format_tag::ab
+                                       : memory::format_tag::abc);
+        auto desc_idx = memory::desc({p.n_indices}, memory::data_type::s32,
+                memory::format_tag::a);
+        auto desc_off = memory::desc({p.n_bags}, memory::data_type::s32,
+                memory::format_tag::a);
+        auto desc_dst = memory::desc({dst_rows, p.src_dims[1]},
+                memory::data_type::f32, memory::format_tag::any);
+
+        primitive_attr attr;
+        if (p.scales_mask >= 0)
+            attr.set_scales_mask(DNNL_ARG_SRC, p.scales_mask);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        if (with_bags()) {
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_idx, desc_off,
+                    desc_dst, attr);
+            // test all pd ctors
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, desc_idx, desc_off, desc_dst);
+        } else {
+            pd = pd_t(eng, p.aalgorithm, desc_src, desc_idx, desc_dst, attr);
+            // test all pd ctors
+            test_fwd_pd_constructors<pd_t>(pd, allowed_attributes,
+                    p.aalgorithm, desc_src, desc_idx, desc_dst);
+        }
+
+        EXPECT_ANY_THROW(gather(pd, {}));
+        // default primitive ctor
+        auto prim = gather();
+        // regular primitive ctor
+        prim = gather(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto idx_desc = pd.indices_desc();
+        const auto off_desc = pd.offsets_desc();
+        const auto dst_desc = pd.dst_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1) == idx_desc);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_2) == off_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_EQ(off_desc.is_zero(), !with_bags());
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_idx = memory(idx_desc, test_engine);
+        auto mem_off = memory(desc_off, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_sc = memory(
+                {{p.scales_mask == 1 ? p.src_dims[0] : 1},
+                        memory::data_type::f32, memory::format_tag::a},
+                test_engine);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), mem_src);
+        {
+            auto idx_ptr = map_memory<int32_t>(mem_idx);
+            for (memory::dim i = 0; i < p.n_indices; i++)
+                idx_ptr[i] = static_cast<int32_t>((i * 7 + 3) % p.src_dims[0]);
+
+            // Bags get uneven sizes, and every fourth bag is empty.
+            auto off_ptr = map_memory<int32_t>(mem_off);
+            memory::dim o = 0;
+            for (memory::dim b = 0; b < p.n_bags; b++) {
+                off_ptr[b] = static_cast<int32_t>(o);
+                if (b % 4 != 3) o = std::min(o + 1 + b % 5, p.n_indices);
+            }
+
+            auto sc_ptr = map_memory<float>(mem_sc);
+            const memory::dim n_sc = mem_sc.get_desc().get_dims()[0];
+            for (memory::dim r = 0; r < n_sc; r++)
+                sc_ptr[r] = 0.25f * static_cast<float>(1 + r % 5);
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, mem_src},
+                {DNNL_ARG_SRC_1, mem_idx}, {DNNL_ARG_DST, mem_dst}};
+        if (with_bags()) args.insert({DNNL_ARG_SRC_2, mem_off});
+        if (p.scales_mask >= 0)
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_SRC, mem_sc});
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        check(mem_src, mem_idx, mem_off, mem_sc, mem_dst);
+    }
+};
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // table is not two-dimensional
+            gather_test_params_t {algorithm::gather_bag_sum, {10, 8, 2}, 6,
+                    3, -1, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            gather_test_params_t {algorithm::reduction_sum, {10, 8}, 6, 0,
+                    -1, true, dnnl_invalid_arguments},
+            // not supported scales mask
+            gather_test_params_t {algorithm::gather_rows, {10, 8}, 6, 0, 2,
+                    true, dnnl_unimplemented});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(
+            gather_test_params_t {algorithm::gather_rows, {10, 8}, 0, 0, -1},
+            gather_test_params_t {
+                    algorithm::gather_bag_sum, {10, 0}, 6, 3, -1});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(
+            gather_test_params_t {algorithm::gather_rows, {10, 16}, 7, 0, -1},
+            gather_test_params_t {algorithm::gather_rows, {13, 21}, 30, 0, 1},
+            gather_test_params_t {
+                    algorithm::gather_bag_sum, {10, 16}, 20, 6, -1},
+            gather_test_params_t {
+                    algorithm::gather_bag_sum, {31, 40}, 50, 11, 0},
+            gather_test_params_t {
+                    algorithm::gather_bag_mean, {17, 64}, 45, 13, 1},
+            gather_test_params_t {
+                    algorithm::gather_bag_mean, {9, 3}, 12, 8, -1});
+};
+
+// Long rows are reduced in several column blocks, and many bags are split
+// between threads.
+static auto large_cases = []() {
+    return ::testing::Values(
+            gather_test_params_t {
+                    algorithm::gather_bag_sum, {1000, 520}, 4000, 777, 1},
+            gather_test_params_t {
+                    algorithm::gather_bag_mean, {5000, 136}, 9000, 1500, 0},
+            gather_test_params_t {
+                    algorithm::gather_rows, {3000, 1031}, 2000, 0, -1});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsGather) {} \
+    INSTANTIATE_TEST_SUITE_P(TestGatherEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestGatherZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestGatherSimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestGatherLarge, test, large_cases());
+
+using gather_test_f32 = gather_test_t<float>;
+using gather_test_bf16 = gather_test_t<bfloat16_t>;
+using gather_test_s8 = gather_test_t<int8_t>;
+using gather_test_u8 = gather_test_t<uint8_t>;
+
+INST_TEST_CASE(gather_test_f32)
+INST_TEST_CASE(gather_test_bf16)
+INST_TEST_CASE(gather_test_s8)
+INST_TEST_CASE(gather_test_u8)
+
+} // namespace dnnl
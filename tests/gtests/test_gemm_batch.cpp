@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+// Every problem of a batch must produce exactly what a standalone call with
+// the same arguments produces.
+class gemm_batch_test_t : public ::testing::Test {};
+
+namespace {
+const memory::dim M = 5, N = 7, K = 9, batch = 6;
+} // namespace
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestSgemmBatch) {
+    const float alpha = 1.5f, beta = 0.5f;
+
+    std::vector<std::vector<float>> a(batch), b(batch), c(batch), c_ref(batch);
+    std::vector<const float *> a_ptrs(batch), b_ptrs(batch);
+    std::vector<float *> c_ptrs(batch);
+    std::vector<memory::dim> lda(batch), ldb(batch), ldc(batch);
+
+    for (memory::dim i = 0; i < batch; i++) {
+        // Leading dimensions differ between the problems on purpose.
+        lda[i] = K + i;
+        ldb[i] = N + 2 * i;
+        ldc[i] = N + i % 3;
+        a[i].resize(M * lda[i]);
+        b[i].resize(K * ldb[i]);
+        c[i].resize(M * ldc[i]);
+        for (size_t e = 0; e < a[i].size(); e++)
+            a[i][e] = float((e * 7 + i) % 11) - 5.f;
+        for (size_t e = 0; e < b[i].size(); e++)
+            b[i][e] = float((e * 5 + i) % 13) - 6.f;
+        for (size_t e = 0; e < c[i].size(); e++)
+            c[i][e] = float((e + i) % 3);
+        c_ref[i] = c[i];
+        a_ptrs[i] = a[i].data();
+        b_ptrs[i] = b[i].data();
+        c_ptrs[i] = c[i].data();
+
+        ASSERT_EQ(sgemm('N', 'N', M, N, K, alpha, a[i].data(), lda[i],
+                          b[i].data(), ldb[i], beta, c_ref[i].data(), ldc[i]),
+                status::success);
+    }
+
+    ASSERT_EQ(sgemm_batch('N', 'N', M, N, K, alpha, a_ptrs.data(), lda.data(),
+                      b_ptrs.data(), ldb.data(), beta, c_ptrs.data(),
+                      ldc.data(), batch),
+            status::success);
+
+    for (memory::dim i = 0; i < batch; i++)
+        for (size_t e = 0; e < c[i].size(); e++)
+            ASSERT_NEAR(c[i][e], c_ref[i][e], 1e-4f * std::fabs(c_ref[i][e]));
+
+    // A negative batch size and missing arrays are reported as errors.
+    EXPECT_EQ(sgemm_batch('N', 'N', M, N, K, alpha, a_ptrs.data(), lda.data(),
+                      b_ptrs.data(), ldb.data(), beta, c_ptrs.data(),
+                      ldc.data(), -1),
+            status::invalid_arguments);
+    EXPECT_EQ(sgemm_batch('N', 'N', M, N, K, alpha, a_ptrs.data(), nullptr,
+                      b_ptrs.data(), ldb.data(), beta, c_ptrs.data(),
+                      ldc.data(), batch),
+            status::invalid_arguments);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestSgemmBatchStrided) {
+    const float alpha = 1.f, beta = 0.f;
+    // Matrices A are transposed and padded, matrices B are shared.
+    const memory::dim lda = M + 3, ldb = N, ldc = N + 1;
+    const memory::dim stride_a = K * lda, stride_c = M * ldc + 4;
+
+    std::vector<float> a(batch * stride_a), b(K * ldb);
+    std::vector<float> c(batch * stride_c, 0.f), c_ref(batch * stride_c, 0.f);
+    for (size_t e = 0; e < a.size(); e++)
+        a[e] = float(e % 17) - 8.f;
+    for (size_t e = 0; e < b.size(); e++)
+        b[e] = float(e % 7) - 3.f;
+
+    for (memory::dim i = 0; i < batch; i++)
+        ASSERT_EQ(sgemm('T', 'N', M, N, K, alpha, a.data() + i * stride_a, lda,
+                          b.data(), ldb, beta, c_ref.data() + i * stride_c,
+                          ldc),
+                status::success);
+
+    ASSERT_EQ(sgemm_batch_strided('T', 'N', M, N, K, alpha, a.data(), lda,
+                      stride_a, b.data(), ldb, 0, beta, c.data(), ldc,
+                      stride_c, batch),
+            status::success);
+
+    for (size_t e = 0; e < c.size(); e++)
+        ASSERT_NEAR(c[e], c_ref[e], 1e-4f * std::fabs(c_ref[e]));
+
+    // Overlapping matrices C would be written concurrently.
+    EXPECT_EQ(sgemm_batch_strided('T', 'N', M, N, K, alpha, a.data(), lda,
+                      stride_a, b.data(), ldb, 0, beta, c.data(), ldc, 0,
+                      batch),
+            status::invalid_arguments);
+    EXPECT_EQ(sgemm_batch_strided('T', 'N', M, N, K, alpha, a.data(), lda,
+                      stride_a, b.data(), ldb, 0, beta, c.data(), ldc,
+                      (M - 1) * ldc + N - 1, batch),
+            status::invalid_arguments);
+    // A single problem may use any stride.
+    EXPECT_EQ(sgemm_batch_strided('T', 'N', M, N, K, alpha, a.data(), lda,
+                      stride_a, b.data(), ldb, 0, beta, c.data(), ldc, 0, 1),
+            status::success);
+}
+
+HANDLE_EXCEPTIONS_FOR_TEST(gemm_batch_test_t, TestGemmS8s8s32BatchStrided) {
+    const memory::dim lda = K, ldb = N, ldc = N;
+    const memory::dim stride_a = M * lda, stride_b = K * ldb,
+                      stride_c = M * ldc;
+    const int32_t co = 3;
+
+    std::vector<int8_t> a(batch * stride_a), b(batch * stride_b);
+    std::vector<int32_t> c(batch * stride_c), c_ref(batch * stride_c);
+    for (size_t e = 0; e < a.size(); e++)
+        a[e] = int8_t(e % 9) - 4;
+    for (size_t e = 0; e < b.size(); e++)
+        b[e] = int8_t(e % 5) - 2;
+
+    for (memory::dim i = 0; i < batch; i++)
+        ASSERT_EQ(gemm_s8s8s32('N', 'N', 'F', M, N, K, 1.f,
+                          a.data() + i * stride_a, lda, 0,
+                          b.data() + i * stride_b, ldb, 0, 0.f,
+                          c_ref.data() + i * stride_c, ldc, &co),
+                status::success);
+
+    ASSERT_EQ(gemm_s8s8s32_batch_strided('N', 'N', 'F', M, N, K, 1.f, a.data(),
+                      lda, stride_a, 0, b.data(), ldb, stride_b, 0, 0.f,
+                      c.data(), ldc, stride_c, &co, batch),
+            status::success);
+
+    for (size_t e = 0; e < c.size(); e++)
+        ASSERT_EQ(c[e], c_ref[e]);
+}
+
+} // namespace dnnl
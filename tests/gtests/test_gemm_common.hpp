@@ -63,14 +63,6 @@
     CPU_INST_TEST_CASE_( \
             CONCAT_WITH_UNDERSCORE(str, TEST_CASE_NAME_PREFIX), __VA_ARGS__)
 
-// Declare bfloat16 GEMM interfaces for testing
-extern "C" {
-dnnl_status_t dnnl_gemm_bf16bf16f32(char transa, char transb, dnnl_dim_t M,
-        dnnl_dim_t N, dnnl_dim_t K, float alpha, const bfloat16_t *A,
-        dnnl_dim_t lda, const bfloat16_t *B, dnnl_dim_t ldb, float beta,
-        float *C, dnnl_dim_t ldc);
-}
-
 // Declare packed GEMM interfaces for testing
 #include "src/cpu/gemm/gemm_pack.hpp"
 
@@ -458,10 +450,72 @@ struct dnnl_gemm<uint8_t, int8_t, int32_t> {
 
 template <>
 struct dnnl_gemm<float16_t, float16_t, float> {
+    static dnnl_status_t call_packed(const test_params &p,
+            const test_memory &a_mem, const test_memory &b_mem,
+            const test_memory &c_mem) {
+        /* Unlike the other packed tests, this one goes through the public
+         * row-major API, so no conversion to Fortran notation is needed */
+        assert(p.alpha == 1.f);
+
+        std::vector<uint8_t> a_pack_buf, b_pack_buf;
+        auto A = map_memory<float16_t>(a_mem);
+        auto B = map_memory<float16_t>(b_mem);
+        auto C = map_memory<float>(c_mem);
+        const void *a_eff = static_cast<float16_t *>(A);
+        const void *b_eff = static_cast<float16_t *>(B);
+
+        char trans_a = p.transA, trans_b = p.transB;
+        dnnl_status_t status = dnnl_success;
+
+        if (p.pack_params.pack_a) {
+            size_t a_sz;
+            status = dnnl_gemm_f16f16f32_pack_get_size('A', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, &a_sz);
+            if (status != dnnl_success) return status;
+
+            a_pack_buf.resize(a_sz);
+            status = dnnl_gemm_f16f16f32_pack('A', p.transA, p.transB, p.M,
+                    p.N, p.K, p.lda, p.ldb, (const uint16_t *)a_eff,
+                    a_pack_buf.data());
+            if (status != dnnl_success) return status;
+
+            a_eff = a_pack_buf.data();
+            trans_a = 'P';
+        }
+
+        if (p.pack_params.pack_b) {
+            size_t b_sz;
+            status = dnnl_gemm_f16f16f32_pack_get_size('B', p.transA, p.transB,
+                    p.M, p.N, p.K, p.lda, p.ldb, &b_sz);
+            if (status != dnnl_success) return status;
+
+            b_pack_buf.resize(b_sz);
+            status = dnnl_gemm_f16f16f32_pack('B', p.transA, p.transB, p.M,
+                    p.N, p.K, p.lda, p.ldb, (const uint16_t *)b_eff,
+                    b_pack_buf.data());
+            if (status != dnnl_success) return status;
+
+            b_eff = b_pack_buf.data();
+            trans_b = 'P';
+        }
+
+        return dnnl_gemm_f16f16f32_compute(trans_a, trans_b, p.M, p.N, p.K,
+                a_eff, p.lda, b_eff, p.ldb, p.beta, C, p.ldc);
+    }
+
     static dnnl_status_t call(const test_params &p, const test_memory &a_mem,
             const test_memory &b_mem, const test_memory &c_mem,
             const test_memory &) {
-        return dnnl_unimplemented;
+        if (p.pack_params.pack_a || p.pack_params.pack_b)
+            return call_packed(p, a_mem, b_mem, c_mem);
+
+        auto A = map_memory<float16_t>(a_mem);
+        auto B = map_memory<float16_t>(b_mem);
+        auto C = map_memory<float>(c_mem);
+        return dnnl_gemm_f16f16f32(p.transA, p.transB, p.M, p.N, p.K, p.alpha,
+                (const uint16_t *)static_cast<float16_t *>(A), p.lda,
+                (const uint16_t *)static_cast<float16_t *>(B), p.ldb, p.beta,
+                C, p.ldc);
     }
 };
 
@@ -545,7 +599,9 @@ struct dnnl_gemm<bfloat16_t, bfloat16_t, float> {
         auto B = map_memory<bfloat16_t>(b_mem);
         auto C = map_memory<float>(c_mem);
         return dnnl_gemm_bf16bf16f32(p.transA, p.transB, p.M, p.N, p.K, p.alpha,
-                A, p.lda, B, p.ldb, p.beta, C, p.ldc);
+                (const uint16_t *)static_cast<bfloat16_t *>(A), p.lda,
+                (const uint16_t *)static_cast<bfloat16_t *>(B), p.ldb, p.beta,
+                C, p.ldc);
     }
 };
 
@@ -605,10 +661,17 @@ protected:
         SKIP_IF(!zero_off && get_test_engine_kind() == engine::kind::cpu,
                 "CPU does not support non-zero offsets.");
 
-        SKIP_IF(unsupported_data_type(data_traits<a_dt>::data_type),
+        // The CPU computes f16f16f32 gemm by converting the inputs to f32,
+        // so it runs without native f16 support.
+        const bool is_cpu_f16f16f32
+                = get_test_engine_kind() == engine::kind::cpu
+                && data_traits<a_dt>::data_type == memory::data_type::f16
+                && data_traits<c_dt>::data_type == memory::data_type::f32;
+        SKIP_IF(!is_cpu_f16f16f32
+                        && unsupported_data_type(data_traits<a_dt>::data_type),
                 "Engine does not support this data type.");
 
-        bool is_f16 = (data_traits<a_dt>::data_type == memory::data_type::f16);
+        bool is_f16 = (data_traits<c_dt>::data_type == memory::data_type::f16);
         SKIP_IF(is_f16 && get_test_engine_kind() == engine::kind::cpu,
                 "CPU does not support f16 data type.");
 
@@ -114,6 +114,49 @@ TEST_F(runtime_dim_test_t, TestConv) {
             {1, 1}, {1, 1}, fwd_hint));
 }
 
+CPU_TEST_F(runtime_dim_test_t, TestConvRuntimeMB) {
+    // A runtime minibatch is supported by the brgemm based implementation
+    // for channels-last activations.
+    SKIP_IF(get_effective_cpu_isa() < cpu_isa::avx2, "Unsupported ISA.");
+
+    const memory::dims strides {1, 1}, padding {1, 1};
+    memory::desc src_md {
+            {DNNL_RUNTIME_DIM_VAL, 16, 7, 7}, data_type::f32, tag::acdb};
+    memory::desc wei_md {{32, 16, 3, 3}, data_type::f32, tag::any};
+    memory::desc dst_md {
+            {DNNL_RUNTIME_DIM_VAL, 32, 7, 7}, data_type::f32, tag::acdb};
+    convolution_forward::primitive_desc pd;
+    CHECK_OK(pd = convolution_forward::primitive_desc(eng,
+                     prop_kind::forward_inference,
+                     algorithm::convolution_direct, src_md, wei_md, dst_md,
+                     strides, padding, padding));
+    convolution_forward conv(pd);
+
+    memory wei(pd.weights_desc(), eng);
+    fill_data<float>(pd.weights_desc().get_size() / sizeof(float), wei);
+
+    stream strm(eng);
+    for (memory::dim mb : {1, 5}) {
+        memory::desc src_d {{mb, 16, 7, 7}, data_type::f32, tag::acdb};
+        memory::desc dst_d {{mb, 32, 7, 7}, data_type::f32, tag::acdb};
+        convolution_forward ref_conv({eng, prop_kind::forward_inference,
+                algorithm::convolution_direct, src_d, pd.weights_desc(), dst_d,
+                strides, padding, padding});
+
+        memory src(src_d, eng), dst(dst_d, eng), ref_dst(dst_d, eng);
+        fill_data<float>(src_d.get_size() / sizeof(float), src);
+
+        conv.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, dst}});
+        ref_conv.execute(strm,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, ref_dst}});
+        strm.wait();
+        compare_data<float>(ref_dst, dst);
+    }
+}
+
 TEST_F(runtime_dim_test_t, TestDeconv) {
     memory::desc src_md {
             {DNNL_RUNTIME_DIM_VAL, 16, 7, 7}, data_type::f32, tag::abcd};
@@ -14,6 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -31,6 +35,22 @@ TEST(iface_sparse_test_t, TestSparseMDCreation) {
     // CSR.
     ASSERT_NO_THROW(
             md = memory::desc::csr({64, 128}, dt::f32, nnz, dt::s32, dt::s32));
+    // BSR.
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz * 16,
+                                 {4, 4}, dt::s32, dt::s32));
+    // Dimensions are not divisible by the block dimensions.
+    ASSERT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz * 16,
+                                  {3, 4}, dt::s32, dt::s32));
+    // nnz is not a multiple of the block size.
+    ASSERT_ANY_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                                  {4, 4}, dt::s32, dt::s32));
+    // COO.
+    ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
+    ASSERT_ANY_THROW(md = memory::desc::coo({64, 128}, dt::f32, -1, dt::s32));
+    // Grouped.
+    ASSERT_NO_THROW(md = memory::desc::grouped({64, 128}, dt::f32, 4, dt::s32));
+    ASSERT_ANY_THROW(
+            md = memory::desc::grouped({64, 128}, dt::f32, 0, dt::s32));
 }
 
 TEST(iface_sparse_test_t, TestSparseMDComparison) {
@@ -58,6 +78,20 @@ TEST(iface_sparse_test_t, TestSparseMDComparison) {
     ASSERT_NO_THROW(md2
             = memory::desc::csr({64, 128}, dt::f32, nnz + 1, dt::s32, dt::s32));
     ASSERT_NE(md1, md2);
+
+    // Different encodings.
+    ASSERT_NO_THROW(md1 = memory::desc::csr(
+                            {64, 128}, dt::f32, nnz * 16, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz * 16,
+                                  {4, 4}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
+
+    // Different block dimensions.
+    ASSERT_NO_THROW(md1 = memory::desc::bsr({64, 128}, dt::f32, nnz * 16,
+                                  {4, 4}, dt::s32, dt::s32));
+    ASSERT_NO_THROW(md2 = memory::desc::bsr({64, 128}, dt::f32, nnz * 16,
+                                  {2, 8}, dt::s32, dt::s32));
+    ASSERT_NE(md1, md2);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDQueries) {
@@ -80,6 +114,14 @@ TEST(iface_sparse_test_t, TestSparseMDQueries) {
     ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::csr);
     ASSERT_EQ(md.get_data_type(1), indices_dt);
     ASSERT_EQ(md.get_data_type(2), pointers_dt);
+
+    ASSERT_NO_THROW(md = memory::desc::bsr(dims, data_type, nnz * 16, {4, 4},
+                            indices_dt, pointers_dt));
+    ASSERT_EQ(md.get_dims(), dims);
+    ASSERT_EQ(md.get_nnz(), nnz * 16);
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::bsr);
+    ASSERT_EQ(md.get_data_type(1), indices_dt);
+    ASSERT_EQ(md.get_data_type(2), pointers_dt);
 }
 
 TEST(iface_sparse_test_t, TestSparseMDSize) {
@@ -106,6 +148,71 @@ TEST(iface_sparse_test_t, TestSparseMDSize) {
     ASSERT_EQ(md.get_size(2), exp_pointers_size);
 }
 
+TEST(iface_sparse_test_t, TestSparseMDSizeBSR) {
+    const int nnz_blocks = 12;
+    const memory::dims block_dims = {4, 8};
+    const int nnz = nnz_blocks * 4 * 8;
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::bsr({64, 128}, dt::f32, nnz,
+                                 block_dims, dt::s32, dt::s32));
+    // Size of values: all elements of the stored blocks.
+    const size_t exp_values_size
+            = nnz * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Size of indices: one block column index per stored block.
+    const size_t exp_indices_size
+            = nnz_blocks * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+
+    // Size of pointers: one per block row plus one.
+    const size_t exp_pointers_size = (md.get_dims()[0] / block_dims[0] + 1)
+            * memory::data_type_size(md.get_data_type(2));
+    ASSERT_EQ(md.get_size(2), exp_pointers_size);
+}
+
+TEST(iface_sparse_test_t, TestSparseMDSizeCOO) {
+    const int nnz = 12;
+    memory::desc md;
+    ASSERT_NO_THROW(md = memory::desc::coo({64, 128}, dt::f32, nnz, dt::s32));
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::coo);
+    ASSERT_EQ(md.get_data_type(1), dt::s32);
+
+    const size_t exp_values_size
+            = nnz * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(), exp_values_size);
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Row and column indices.
+    const size_t exp_indices_size
+            = nnz * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_indices_size);
+    ASSERT_EQ(md.get_size(2), exp_indices_size);
+}
+
+TEST(iface_sparse_test_t, TestSparseMDSizeGrouped) {
+    const int ngroups = 5;
+    memory::desc md;
+    ASSERT_NO_THROW(
+            md = memory::desc::grouped({64, 128}, dt::f32, ngroups, dt::s32));
+    ASSERT_EQ(md.get_sparse_encoding(), memory::sparse_encoding::grouped);
+    ASSERT_EQ(md.get_data_type(1), dt::s32);
+
+    // All the values are stored.
+    const size_t exp_values_size
+            = 64 * 128 * memory::data_type_size(md.get_data_type());
+    ASSERT_EQ(md.get_size(0), exp_values_size);
+
+    // Offsets: one per group plus one.
+    const size_t exp_offsets_size
+            = (ngroups + 1) * memory::data_type_size(md.get_data_type(1));
+    ASSERT_EQ(md.get_size(1), exp_offsets_size);
+
+    // The number of groups takes part in the comparison.
+    ASSERT_NE(md, memory::desc::grouped({64, 128}, dt::f32, 4, dt::s32));
+}
+
 TEST(iface_sparse_test_t, TestSparseMemoryCreation) {
     engine eng = get_test_engine();
 
@@ -219,4 +326,249 @@ TEST(iface_sparse_test_t, TestSparseMemoryMapUnmap) {
     ASSERT_NO_THROW(mem.unmap_data(mapped_pointers, 2));
 }
 
+TEST(iface_sparse_test_t, TestBSRReorderAndMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // M is not a multiple of the M blocking of the optimized implementation.
+    const memory::dim M = 70, K = 32, N = 48;
+    const memory::dim k_blk = 8, n_blk = 16;
+    const memory::dim nb_k = K / k_blk, nb_n = N / n_blk;
+
+    // Block column 1 is empty and block (2, 0) is zero as well.
+    const auto is_zero_block = [&](memory::dim kb, memory::dim nb) {
+        return nb == 1 || (kb == 2 && nb == 0);
+    };
+    const int nnz_blocks = (int)(nb_k * (nb_n - 1) - 1);
+
+    std::vector<float> src(M * K), wei(K * N), dst(M * N), dst_ref(M * N);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = float((i * 7) % 13) - 6.f;
+    for (memory::dim k = 0; k < K; k++)
+        for (memory::dim n = 0; n < N; n++)
+            wei[k * N + n] = is_zero_block(k / k_blk, n / n_blk)
+                    ? 0.f
+                    : float((k * 5 + n * 3) % 11) - 5.f;
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                acc += src[m * K + k] * wei[k * N + n];
+            dst_ref[m * N + n] = acc;
+        }
+
+    const memory::desc src_md({M, K}, dt::f32, memory::format_tag::ab);
+    const memory::desc dense_wei_md({K, N}, dt::f32, memory::format_tag::ab);
+    const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    memory src_mem(src_md, eng, src.data());
+    memory dense_wei_mem(dense_wei_md, eng, wei.data());
+    memory dst_mem(dst_md, eng, dst.data());
+    stream strm(eng);
+
+    // The destination nnz is a capacity, the actual number of blocks is
+    // returned in the last pointer.
+    const memory::dim capacity = nb_k * nb_n * k_blk * n_blk;
+    const auto wei_md = memory::desc::bsr(
+            {K, N}, dt::f32, capacity, {k_blk, n_blk}, dt::s32, dt::s32);
+    memory wei_mem(wei_md, eng);
+    reorder(dense_wei_mem, wei_mem).execute(strm, dense_wei_mem, wei_mem);
+    strm.wait();
+    {
+        int *pointers = wei_mem.map_data<int>(2);
+        ASSERT_EQ(pointers[nb_k], nnz_blocks);
+        wei_mem.unmap_data(pointers, 2);
+    }
+
+    // Run every implementation available for the problem.
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    do {
+        std::fill(dst.begin(), dst.end(), -1.f);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(dst[i], dst_ref[i], 1e-4f * std::fabs(dst_ref[i]))
+                    << "impl: " << pd.impl_info_str() << ", index: " << i;
+    } while (pd.next_impl());
+
+    // Too small capacity is reported as an error.
+    const auto small_wei_md = memory::desc::bsr({K, N}, dt::f32,
+            (nnz_blocks - 1) * k_blk * n_blk, {k_blk, n_blk}, dt::s32,
+            dt::s32);
+    memory small_wei_mem(small_wei_md, eng);
+    EXPECT_ANY_THROW(reorder(dense_wei_mem, small_wei_mem)
+                             .execute(strm, dense_wei_mem, small_wei_mem));
+}
+
+TEST(iface_sparse_test_t, TestCOOReorderAndMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // M * K needs more than one radix sort pass.
+    const memory::dim M = 70, K = 300, N = 20;
+
+    // Every 7th element is non-zero, the entries are shuffled.
+    std::vector<float> src(M * K, 0.f);
+    std::vector<int32_t> coo_rows, coo_cols;
+    std::vector<float> coo_values;
+    for (memory::dim i = 0; i < M * K; i += 7)
+        src[i] = float((i * 5) % 13) - 6.f;
+    const memory::dim dense_nnz = (M * K + 6) / 7;
+    for (memory::dim j = 0; j < dense_nnz; j++) {
+        // 37 is coprime with the number of entries, so this is a permutation.
+        const memory::dim i = ((j * 37) % dense_nnz) * 7;
+        coo_rows.push_back((int32_t)(i / K));
+        coo_cols.push_back((int32_t)(i % K));
+        coo_values.push_back(src[i]);
+    }
+    const memory::dim nnz = (memory::dim)coo_values.size();
+
+    std::vector<float> wei(K * N), dst(M * N), dst_ref(M * N);
+    for (memory::dim i = 0; i < K * N; i++)
+        wei[i] = float((i * 3) % 11) - 5.f;
+    for (memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            float acc = 0.f;
+            for (memory::dim k = 0; k < K; k++)
+                acc += src[m * K + k] * wei[k * N + n];
+            dst_ref[m * N + n] = acc;
+        }
+
+    const auto coo_md = memory::desc::coo({M, K}, dt::f32, nnz, dt::s32);
+    const auto csr_md
+            = memory::desc::csr({M, K}, dt::f32, nnz, dt::s32, dt::s32);
+    memory coo_mem(coo_md, eng,
+            {coo_values.data(), coo_rows.data(), coo_cols.data()});
+    memory csr_mem(csr_md, eng);
+    stream strm(eng);
+
+    reorder(coo_mem, csr_mem).execute(strm, coo_mem, csr_mem);
+    strm.wait();
+
+    // Rows and columns are sorted, so CSR can be checked against the dense
+    // tensor directly. A row sorted COO is made out of it for the matmul.
+    std::vector<int32_t> sorted_rows(nnz), sorted_cols(nnz);
+    std::vector<float> sorted_values(nnz);
+    {
+        float *values = csr_mem.map_data<float>(0);
+        int32_t *indices = csr_mem.map_data<int32_t>(1);
+        int32_t *pointers = csr_mem.map_data<int32_t>(2);
+        ASSERT_EQ(pointers[0], 0);
+        ASSERT_EQ(pointers[M], nnz);
+        for (memory::dim m = 0; m < M; m++) {
+            for (int32_t e = pointers[m]; e < pointers[m + 1]; e++) {
+                if (e > pointers[m]) ASSERT_LT(indices[e - 1], indices[e]);
+                ASSERT_EQ(values[e], src[m * K + indices[e]]);
+                sorted_rows[e] = (int32_t)m;
+                sorted_cols[e] = indices[e];
+                sorted_values[e] = values[e];
+            }
+        }
+        csr_mem.unmap_data(values, 0);
+        csr_mem.unmap_data(indices, 1);
+        csr_mem.unmap_data(pointers, 2);
+    }
+
+    // Out of range coordinates are reported as an error.
+    std::vector<int32_t> bad_rows = coo_rows;
+    bad_rows[nnz / 2] = (int32_t)M;
+    memory bad_coo_mem(coo_md, eng,
+            {coo_values.data(), bad_rows.data(), coo_cols.data()});
+    EXPECT_ANY_THROW(reorder(bad_coo_mem, csr_mem)
+                             .execute(strm, bad_coo_mem, csr_mem));
+
+    const memory::desc wei_md({K, N}, dt::f32, memory::format_tag::ab);
+    const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    memory wei_mem(wei_md, eng, wei.data());
+    memory dst_mem(dst_md, eng, dst.data());
+    memory sorted_coo_mem(coo_md, eng,
+            {sorted_values.data(), sorted_rows.data(), sorted_cols.data()});
+
+    // Run every implementation available for the problem.
+    auto pd = matmul::primitive_desc(eng, coo_md, wei_md, dst_md);
+    do {
+        std::fill(dst.begin(), dst.end(), -1.f);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, sorted_coo_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(dst[i], dst_ref[i], 1e-4f * std::fabs(dst_ref[i]))
+                    << "impl: " << pd.impl_info_str() << ", index: " << i;
+    } while (pd.next_impl());
+}
+
+TEST(iface_sparse_test_t, TestGroupedMatmul) {
+    engine eng = get_test_engine();
+
+    const bool is_unimplemented = (eng.get_kind() == engine::kind::gpu
+            || DNNL_CPU_RUNTIME == DNNL_RUNTIME_SYCL);
+    if (is_unimplemented) return;
+
+    // Unbalanced groups, including an empty one, with sizes that are not
+    // multiples of the row block; N has a tail as well.
+    const std::vector<int32_t> group_sizes = {0, 1, 45, 7, 100, 32};
+    const memory::dim G = (memory::dim)group_sizes.size();
+    const memory::dim K = 33, N = 70;
+    std::vector<int32_t> offsets(G + 1, 0);
+    for (memory::dim g = 0; g < G; g++)
+        offsets[g + 1] = offsets[g] + group_sizes[g];
+    const memory::dim M = offsets[G];
+
+    std::vector<float> src(M * K), wei(G * K * N), dst(M * N), dst_ref(M * N);
+    for (memory::dim i = 0; i < M * K; i++)
+        src[i] = float((i * 5) % 13) - 6.f;
+    for (memory::dim i = 0; i < G * K * N; i++)
+        wei[i] = float((i * 3) % 11) - 5.f;
+    for (memory::dim g = 0; g < G; g++)
+        for (memory::dim m = offsets[g]; m < offsets[g + 1]; m++)
+            for (memory::dim n = 0; n < N; n++) {
+                float acc = 0.f;
+                for (memory::dim k = 0; k < K; k++)
+                    acc += src[m * K + k] * wei[(g * K + k) * N + n];
+                dst_ref[m * N + n] = acc;
+            }
+
+    const auto src_md = memory::desc::grouped({M, K}, dt::f32, G, dt::s32);
+    const memory::desc wei_md({G, K, N}, dt::f32, memory::format_tag::abc);
+    const memory::desc dst_md({M, N}, dt::f32, memory::format_tag::ab);
+    memory src_mem(src_md, eng, {src.data(), offsets.data()});
+    memory wei_mem(wei_md, eng, wei.data());
+    memory dst_mem(dst_md, eng, dst.data());
+    stream strm(eng);
+
+    // The weights must have a matrix per group.
+    const memory::desc bad_wei_md(
+            {G + 1, K, N}, dt::f32, memory::format_tag::abc);
+    EXPECT_ANY_THROW(matmul::primitive_desc(eng, src_md, bad_wei_md, dst_md));
+
+    // Run every implementation available for the problem.
+    auto pd = matmul::primitive_desc(eng, src_md, wei_md, dst_md);
+    do {
+        std::fill(dst.begin(), dst.end(), -1.f);
+        matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}});
+        strm.wait();
+        for (memory::dim i = 0; i < M * N; i++)
+            ASSERT_NEAR(dst[i], dst_ref[i], 1e-4f * std::fabs(dst_ref[i]))
+                    << "impl: " << pd.impl_info_str() << ", index: " << i;
+
+        // Offsets that do not cover all the rows are reported as an error.
+        std::vector<int32_t> bad_offsets = offsets;
+        bad_offsets[G] = (int32_t)(M - 1);
+        memory bad_src_mem(src_md, eng, {src.data(), bad_offsets.data()});
+        EXPECT_ANY_THROW(matmul(pd).execute(strm,
+                {{DNNL_ARG_SRC, bad_src_mem}, {DNNL_ARG_WEIGHTS, wei_mem},
+                        {DNNL_ARG_DST, dst_mem}}));
+    } while (pd.next_impl());
+}
+
 } // namespace dnnl
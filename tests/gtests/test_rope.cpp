@@ -0,0 +1,289 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct rope_test_params_t {
+    algorithm aalgorithm;
+    memory::dims dims;
+    int axis;
+    bool with_positions;
+    // Empty strides stand for a dense row-major layout.
+    memory::dims src_strides;
+    memory::dims dst_strides;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class rope_test_t : public ::testing::TestWithParam<rope_test_params_t> {
+private:
+    rope_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<rope_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static const float theta;
+
+    memory::desc make_md(const memory::dims &strides) const {
+        if (strides.empty())
+            return memory::desc(p.dims, data_dt,
+                    p.dims.size() == 3 ? memory::format_tag::abc
+                                       : memory::format_tag::abcd);
+        return memory::desc(p.dims, data_dt, strides);
+    }
+
+    static memory::dim offset(
+            const memory::desc &md, const memory::dims &pos) {
+        const auto strides = md.get_strides();
+        memory::dim off = 0;
+        for (size_t d = 0; d < pos.size(); d++)
+            off += pos[d] * strides[d];
+        return off;
+    }
+
+    void check(const memory &src, const memory &cos_sin, const memory &dst) {
+        const auto src_md = src.get_desc();
+        const auto dst_md = dst.get_desc();
+        auto src_ptr = map_memory<data_t>(src);
+        auto dst_ptr = map_memory<data_t>(dst);
+
+        const int ndims = static_cast<int>(p.dims.size());
+        const memory::dim T = p.dims[p.axis];
+        const memory::dim D = p.dims[ndims - 1];
+        const memory::dim half = D / 2;
+        const bool is_interleaved
+                = p.aalgorithm == algorithm::rope_interleaved;
+
+        std::vector<float> cs(T * D);
+        if (p.with_positions) {
+            auto pos_ptr = map_memory<int32_t>(cos_sin);
+            for (memory::dim t = 0; t < T; t++)
+                for (memory::dim i = 0; i < half; i++) {
+                    const float angle = static_cast<float>(pos_ptr[t])
+                            * std::pow(theta,
+                                    -2.f * static_cast<float>(i) / D);
+                    cs[t * D + i] = std::cos(angle);
+                    cs[t * D + half + i] = std::sin(angle);
+                }
+        } else {
+            auto cs_ptr = map_memory<float>(cos_sin);
+            for (memory::dim j = 0; j < T * D; j++)
+                cs[j] = cs_ptr[j];
+        }
+
+        const float eps = data_dt == memory::data_type::f32 ? 1e-5f
+                : data_dt == memory::data_type::f16         ? 2e-3f
+                                                            : 2e-2f;
+
+        memory::dim nrows = 1;
+        for (int d = 0; d < ndims - 1; d++)
+            nrows *= p.dims[d];
+        memory::dims pos(ndims, 0);
+        for (memory::dim r = 0; r < nrows; r++) {
+            memory::dim rem = r;
+            for (int d = ndims - 2; d >= 0; d--) {
+                pos[d] = rem % p.dims[d];
+                rem /= p.dims[d];
+            }
+            const memory::dim t = pos[p.axis];
+            for (memory::dim i = 0; i < half; i++) {
+                const float c = cs[t * D + i];
+                const float s = cs[t * D + half + i];
+                const memory::dim j0 = is_interleaved ? 2 * i : i;
+                const memory::dim j1 = is_interleaved ? 2 * i + 1 : half + i;
+
+                pos[ndims - 1] = j0;
+                const float x0 = static_cast<float>(
+                        src_ptr[offset(src_md, pos)]);
+                const float got0 = static_cast<float>(
+                        dst_ptr[offset(dst_md, pos)]);
+                pos[ndims - 1] = j1;
+                const float x1 = static_cast<float>(
+                        src_ptr[offset(src_md, pos)]);
+                const float got1 = static_cast<float>(
+                        dst_ptr[offset(dst_md, pos)]);
+
+                const float exp0 = x0 * c - x1 * s;
+                const float exp1 = x0 * s + x1 * c;
+                ASSERT_NEAR(got0, exp0, eps * std::max(1.f, std::fabs(exp0)));
+                ASSERT_NEAR(got1, exp1, eps * std::max(1.f, std::fabs(exp1)));
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = rope::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const int ndims = static_cast<int>(p.dims.size());
+        const memory::dim T = p.dims[std::min(p.axis, ndims - 1)];
+        const memory::dim D = p.dims[ndims - 1];
+
+        auto desc_src = make_md(p.src_strides);
+        auto desc_dst = make_md(p.dst_strides);
+        auto desc_cs = p.with_positions
+                ? memory::desc(
+                        {T}, memory::data_type::s32, memory::format_tag::a)
+                : memory::desc({T, D}, memory::data_type::f32,
+                        memory::format_tag::ab);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_cs, p.axis,
+                theta);
+        // test all pd ctors
+        test_fwd_pd_constructors<pd_t>(pd, allowed_attributes, p.aalgorithm,
+                desc_src, desc_dst, desc_cs, p.axis, theta);
+
+        EXPECT_ANY_THROW(rope(pd, {}));
+        // default primitive ctor
+        auto prim = rope();
+        // regular primitive ctor
+        prim = rope(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto cs_desc = pd.cos_sin_desc();
+        const auto dst_desc = pd.dst_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_SRC_1) == cs_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_cs = memory(cs_desc, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), mem_src);
+        if (p.with_positions) {
+            auto pos_ptr = map_memory<int32_t>(mem_cs);
+            for (memory::dim t = 0; t < T; t++)
+                pos_ptr[t] = static_cast<int32_t>(5 + 3 * t);
+        } else {
+            auto cs_ptr = map_memory<float>(mem_cs);
+            for (memory::dim t = 0; t < T; t++)
+                for (memory::dim i = 0; i < D / 2; i++) {
+                    const float angle = 0.1f * (t + 1) * (i + 1);
+                    cs_ptr[t * D + i] = std::cos(angle);
+                    cs_ptr[t * D + D / 2 + i] = std::sin(angle);
+                }
+        }
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_SRC_1, mem_cs},
+                        {DNNL_ARG_DST, mem_dst}});
+        strm.wait();
+
+        check(mem_src, mem_cs, mem_dst);
+    }
+};
+
+template <typename data_t>
+const float rope_test_t<data_t>::theta = 10000.f;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // the last dimension is the axis
+            rope_test_params_t {algorithm::rope_half, {2, 3, 4, 8}, 3, false,
+                    {}, {}, true, dnnl_invalid_arguments},
+            // odd size of rows
+            rope_test_params_t {algorithm::rope_half, {2, 3, 4, 7}, 2, false,
+                    {}, {}, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            rope_test_params_t {algorithm::reduction_max, {2, 3, 4, 8}, 2,
+                    false, {}, {}, true, dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(rope_test_params_t {
+            algorithm::rope_half, {2, 0, 4, 8}, 2, false});
+};
+
+// Layouts are [batch, heads, positions, row] and [batch, positions, heads,
+// row]. Rows of 48 elements have tails for both algorithms.
+static auto simple_cases = []() {
+    return ::testing::Values(
+            rope_test_params_t {
+                    algorithm::rope_half, {2, 3, 5, 64}, 2, false},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {2, 3, 5, 64}, 2, false},
+            rope_test_params_t {algorithm::rope_half, {2, 5, 3, 48}, 1, true},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {2, 5, 3, 48}, 1, true},
+            rope_test_params_t {
+                    algorithm::rope_interleaved, {7, 12}, 0, true},
+            rope_test_params_t {
+                    algorithm::rope_half, {1, 1, 32, 128}, 1, true});
+};
+
+// Queries and keys are read as one view of a fused QKV buffer of 8 heads,
+// and the result is written to a key-value cache of 7 positions.
+static auto strided_cases = []() {
+    return ::testing::Values(
+            rope_test_params_t {algorithm::rope_half, {2, 3, 5, 16}, 1, true,
+                    {3 * 8 * 16, 8 * 16, 16, 1}, {5 * 7 * 16, 16, 7 * 16, 1}},
+            rope_test_params_t {algorithm::rope_interleaved, {2, 3, 5, 16},
+                    1, false, {3 * 8 * 16, 8 * 16, 16, 1},
+                    {5 * 7 * 16, 16, 7 * 16, 1}});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsRoPE) {} \
+    INSTANTIATE_TEST_SUITE_P(TestRoPEEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestRoPEZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestRoPESimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestRoPEStrided, test, strided_cases());
+
+using rope_test_f32 = rope_test_t<float>;
+using rope_test_bf16 = rope_test_t<bfloat16_t>;
+using rope_test_f16 = rope_test_t<float16_t>;
+
+INST_TEST_CASE(rope_test_f32)
+INST_TEST_CASE(rope_test_bf16)
+INST_TEST_CASE(rope_test_f16)
+
+} // namespace dnnl
@@ -0,0 +1,251 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+struct topk_test_params_t {
+    memory::format_tag src_format;
+    memory::format_tag dst_format;
+    algorithm aalgorithm;
+    int axis;
+    memory::dims src_dims;
+    memory::dim k;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+template <typename data_t>
+class topk_test_t : public ::testing::TestWithParam<topk_test_params_t> {
+private:
+    topk_test_params_t p;
+    memory::data_type data_dt;
+
+protected:
+    void SetUp() override {
+        data_dt = data_traits<data_t>::data_type;
+
+        p = ::testing::TestWithParam<topk_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(data_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine().get_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    static memory::dim offset(
+            const memory::desc &md, const memory::dims &pos) {
+        const auto strides = md.get_strides();
+        memory::dim off = 0;
+        for (size_t d = 0; d < pos.size(); d++)
+            off += pos[d] * strides[d];
+        return off;
+    }
+
+    // Selected values are expected in the order of selection, ties are
+    // resolved in favor of smaller indices.
+    void check(const memory &src, const memory &dst, const memory &indices) {
+        const auto src_md = src.get_desc();
+        const auto dst_md = dst.get_desc();
+        const auto idx_md = indices.get_desc();
+        if (src_md.get_inner_nblks() != 0 || dst_md.get_inner_nblks() != 0
+                || idx_md.get_inner_nblks() != 0)
+            return;
+
+        auto src_ptr = map_memory<data_t>(src);
+        auto dst_ptr = map_memory<data_t>(dst);
+        auto idx_ptr = map_memory<int32_t>(indices);
+
+        const bool is_max = p.aalgorithm == algorithm::topk_max;
+        const int ndims = static_cast<int>(p.src_dims.size());
+        const memory::dim axis_size = p.src_dims[p.axis];
+        memory::dim rows = 1;
+        for (int d = 0; d < ndims; d++)
+            if (d != p.axis) rows *= p.src_dims[d];
+
+        std::vector<std::pair<float, int32_t>> row(axis_size);
+        for (memory::dim r = 0; r < rows; r++) {
+            memory::dims pos(ndims, 0);
+            memory::dim rem = r;
+            for (int d = ndims - 1; d >= 0; d--) {
+                if (d == p.axis) continue;
+                pos[d] = rem % p.src_dims[d];
+                rem /= p.src_dims[d];
+            }
+
+            for (memory::dim a = 0; a < axis_size; a++) {
+                pos[p.axis] = a;
+                row[a] = {static_cast<float>(src_ptr[offset(src_md, pos)]),
+                        static_cast<int32_t>(a)};
+            }
+            std::stable_sort(row.begin(), row.end(),
+                    [&](const std::pair<float, int32_t> &a,
+                            const std::pair<float, int32_t> &b) {
+                        return is_max ? a.first > b.first : a.first < b.first;
+                    });
+
+            for (memory::dim a = 0; a < p.k; a++) {
+                pos[p.axis] = a;
+                const float got = static_cast<float>(
+                        dst_ptr[offset(dst_md, pos)]);
+                ASSERT_EQ(got, row[a].first);
+                ASSERT_EQ(idx_ptr[offset(idx_md, pos)], row[a].second);
+            }
+        }
+    }
+
+    void Test() {
+        using pd_t = topk::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        memory::dims dst_dims = p.src_dims;
+        if (p.axis >= 0 && p.axis < static_cast<int>(dst_dims.size()))
+            dst_dims[p.axis] = p.k;
+
+        auto desc_src = memory::desc(p.src_dims, data_dt, p.src_format);
+        auto desc_dst = memory::desc(dst_dims, data_dt, p.dst_format);
+        auto desc_idx = memory::desc(
+                dst_dims, memory::data_type::s32, p.dst_format);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, desc_src, desc_dst, desc_idx, p.axis);
+        // test all pd ctors
+        test_fwd_pd_constructors<pd_t>(pd, allowed_attributes, p.aalgorithm,
+                desc_src, desc_dst, desc_idx, p.axis);
+
+        EXPECT_ANY_THROW(topk(pd, {}));
+        // default primitive ctor
+        auto prim = topk();
+        // regular primitive ctor
+        prim = topk(pd);
+
+        const auto src_desc = pd.src_desc();
+        const auto dst_desc = pd.dst_desc();
+        const auto idx_desc = pd.indices_desc();
+
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC) == src_desc);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DST) == dst_desc);
+        ASSERT_TRUE(
+                pd.query_md(query::exec_arg_md, DNNL_ARG_DST_1) == idx_desc);
+        ASSERT_EQ(idx_desc.get_data_type(), memory::data_type::s32);
+
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_axis(), p.axis);
+
+        const auto test_engine = pd.get_engine();
+
+        auto mem_src = memory(src_desc, test_engine);
+        auto mem_dst = memory(dst_desc, test_engine);
+        auto mem_idx = memory(idx_desc, test_engine);
+
+        fill_data<data_t>(src_desc.get_size() / sizeof(data_t), mem_src);
+
+        prim.execute(strm,
+                {{DNNL_ARG_SRC, mem_src}, {DNNL_ARG_DST, mem_dst},
+                        {DNNL_ARG_DST_1, mem_idx}});
+        strm.wait();
+
+        check(mem_src, mem_dst, mem_idx);
+    }
+};
+
+using tag = memory::format_tag;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // k exceeds the axis size
+            topk_test_params_t {tag::nc, tag::nc, algorithm::topk_max, 1,
+                    {2, 4}, 5, true, dnnl_invalid_arguments},
+            // not supported alg_kind
+            topk_test_params_t {tag::nc, tag::nc, algorithm::reduction_max,
+                    1, {2, 4}, 1, true, dnnl_invalid_arguments},
+            // invalid axis
+            topk_test_params_t {tag::nc, tag::nc, algorithm::topk_max, 2,
+                    {2, 4}, 1, true, dnnl_invalid_arguments},
+            // invalid tag
+            topk_test_params_t {tag::any, tag::nc, algorithm::topk_max, 1,
+                    {2, 4}, 1, true, dnnl_invalid_arguments});
+};
+
+static auto zero_dim = []() {
+    return ::testing::Values(topk_test_params_t {
+            tag::nc, tag::nc, algorithm::topk_max, 1, {0, 4}, 2});
+};
+
+static auto simple_cases = []() {
+    return ::testing::Values(topk_test_params_t {tag::nc, tag::nc,
+                                     algorithm::topk_max, 1, {3, 7}, 1},
+            topk_test_params_t {
+                    tag::nc, tag::any, algorithm::topk_min, 1, {3, 40}, 5},
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_max, 0, {17, 3}, 4},
+            topk_test_params_t {tag::nchw, tag::nchw, algorithm::topk_min, 1,
+                    {2, 19, 3, 2}, 3},
+            topk_test_params_t {tag::nhwc, tag::any, algorithm::topk_max, 1,
+                    {2, 37, 2, 3}, 6},
+            topk_test_params_t {tag::nChw16c, tag::any, algorithm::topk_max,
+                    3, {2, 20, 2, 9}, 2});
+};
+
+// Long axes exercise the selection threshold and the split of the axis
+// between threads.
+static auto long_axis_cases = []() {
+    return ::testing::Values(topk_test_params_t {tag::nc, tag::nc,
+                                     algorithm::topk_max, 1, {2, 50000}, 1},
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_max, 1, {1, 70001}, 9},
+            topk_test_params_t {
+                    tag::nc, tag::nc, algorithm::topk_min, 1, {3, 20011}, 50},
+            topk_test_params_t {tag::abc, tag::abc, algorithm::topk_max, 2,
+                    {2, 3, 4099}, 500});
+};
+
+#define INST_TEST_CASE(test) \
+    TEST_P(test, TestsTopK) {} \
+    INSTANTIATE_TEST_SUITE_P(TestTopKEF, test, expected_failures()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKZero, test, zero_dim()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKSimple, test, simple_cases()); \
+    INSTANTIATE_TEST_SUITE_P(TestTopKLongAxis, test, long_axis_cases());
+
+using topk_test_f32 = topk_test_t<float>;
+using topk_test_bf16 = topk_test_t<bfloat16_t>;
+using topk_test_f16 = topk_test_t<float16_t>;
+using topk_test_s8 = topk_test_t<int8_t>;
+using topk_test_u8 = topk_test_t<uint8_t>;
+
+INST_TEST_CASE(topk_test_f32)
+INST_TEST_CASE(topk_test_bf16)
+INST_TEST_CASE(topk_test_f16)
+INST_TEST_CASE(topk_test_s8)
+INST_TEST_CASE(topk_test_u8)
+
+} // namespace dnnl